@@ -0,0 +1,266 @@
+/*
+ * bench_common.hpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: ruben
+ */
+
+#ifndef BENCH_BENCH_COMMON_HPP_
+#define BENCH_BENCH_COMMON_HPP_
+
+#include "boost/mysql/metadata.hpp"
+#include "boost/mysql/detail/protocol/null_bitmap_traits.hpp"
+#include "boost/mysql/detail/protocol/serialization.hpp"
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <initializer_list>
+#include <iostream>
+#include <memory_resource>
+#include <random>
+#include <vector>
+
+// Helpers shared by the benchmarks that generate their input in memory
+
+namespace boost {
+namespace mysql {
+namespace bench {
+
+using clock_type = std::chrono::steady_clock;
+using packet = std::vector<std::uint8_t>;
+
+// Forwards to new/delete, counting allocations and the bytes currently allocated
+class counting_resource : public std::pmr::memory_resource
+{
+public:
+	std::size_t allocations {0};
+	std::size_t bytes {0};
+private:
+	void* do_allocate(std::size_t size, std::size_t alignment) override
+	{
+		++allocations;
+		bytes += size;
+		return std::pmr::new_delete_resource()->allocate(size, alignment);
+	}
+	void do_deallocate(void* p, std::size_t size, std::size_t alignment) override
+	{
+		bytes -= size;
+		std::pmr::new_delete_resource()->deallocate(p, size, alignment);
+	}
+	bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+};
+
+// A field of the given type, with the given column_flags
+inline field_metadata make_field(detail::protocol_field_type type, std::uint16_t flags = 0)
+{
+	detail::column_definition_packet coldef;
+	coldef.type = type;
+	coldef.flags.value = flags;
+	return field_metadata(coldef);
+}
+
+// num_fields types, repeating pattern
+inline std::vector<detail::protocol_field_type> repeat_types(
+	std::initializer_list<detail::protocol_field_type> pattern,
+	std::size_t num_fields
+)
+{
+	std::vector<detail::protocol_field_type> res;
+	for (std::size_t i = 0; i < num_fields; ++i)
+	{
+		res.push_back(pattern.begin()[i % pattern.size()]);
+	}
+	return res;
+}
+
+// Metadata with a field per type. customize(column_definition_packet&)
+// may set anything else, like decimals or flags
+template <typename Customize>
+detail::resultset_metadata make_metadata(
+	const std::vector<detail::protocol_field_type>& types,
+	Customize&& customize
+)
+{
+	std::pmr::vector<field_metadata> fields;
+	for (auto type: types)
+	{
+		detail::column_definition_packet coldef;
+		coldef.type = type;
+		customize(coldef);
+		fields.emplace_back(coldef);
+	}
+	return detail::resultset_metadata({}, {}, std::move(fields));
+}
+
+inline detail::resultset_metadata make_metadata(const std::vector<detail::protocol_field_type>& types)
+{
+	return make_metadata(types, [](detail::column_definition_packet&) {});
+}
+
+struct row_options
+{
+	unsigned null_percent {0}; // fields flagged NOT NULL are never NULL
+	std::size_t min_string_size {1};
+	std::size_t max_string_size {12};
+};
+
+// A text protocol row with random values. Supports integer, double, date,
+// datetime (with the field's decimals) and string fields
+inline packet make_text_row(
+	const detail::resultset_metadata& meta,
+	std::mt19937& gen,
+	const row_options& opts = {}
+)
+{
+	using detail::protocol_field_type;
+	packet res;
+	char buffer [64];
+	for (const auto& field: meta.fields())
+	{
+		if (!field.is_not_null() && gen() % 100 < opts.null_percent)
+		{
+			res.push_back(0xfb);
+			continue;
+		}
+		switch (field.protocol_type())
+		{
+		case protocol_field_type::tiny: snprintf(buffer, sizeof(buffer), "%u", unsigned(gen() % 100)); break;
+		case protocol_field_type::long_: snprintf(buffer, sizeof(buffer), "%u", unsigned(gen() % 100000)); break;
+		case protocol_field_type::longlong: snprintf(buffer, sizeof(buffer), "%u", unsigned(gen())); break;
+		case protocol_field_type::double_:
+			snprintf(buffer, sizeof(buffer), "%.17g", std::uniform_real_distribution<double>(-1e6, 1e6)(gen));
+			break;
+		case protocol_field_type::date:
+			snprintf(buffer, sizeof(buffer), "%04u-%02u-%02u", 1970 + unsigned(gen() % 60),
+				1 + unsigned(gen() % 12), 1 + unsigned(gen() % 28));
+			break;
+		case protocol_field_type::datetime:
+		{
+			int size = snprintf(buffer, sizeof(buffer), "%04u-%02u-%02u %02u:%02u:%02u", 1970 + unsigned(gen() % 60),
+				1 + unsigned(gen() % 12), 1 + unsigned(gen() % 28), unsigned(gen() % 24), unsigned(gen() % 60),
+				unsigned(gen() % 60));
+			if (field.decimals() > 0)
+			{
+				// Microseconds, truncated to the field's decimals
+				snprintf(buffer + size, sizeof(buffer) - size, ".%06u", unsigned(gen() % 1000000));
+				buffer[size + 1 + field.decimals()] = '\0';
+			}
+			break;
+		}
+		default:
+		{
+			std::size_t size = opts.min_string_size + gen() % (opts.max_string_size - opts.min_string_size + 1);
+			res.push_back(static_cast<std::uint8_t>(size));
+			res.resize(res.size() + size, 'v');
+			continue;
+		}
+		}
+		std::size_t size = std::strlen(buffer);
+		res.push_back(static_cast<std::uint8_t>(size));
+		res.insert(res.end(), buffer, buffer + size);
+	}
+	return res;
+}
+
+// A binary protocol row with random values. Supports integer, double, date,
+// datetime and string fields
+inline packet make_binary_row(
+	const detail::resultset_metadata& meta,
+	std::mt19937& gen,
+	const row_options& opts = {}
+)
+{
+	using detail::protocol_field_type;
+	const auto& fields = meta.fields();
+	detail::null_bitmap_traits null_bitmap (detail::binary_row_null_bitmap_offset, fields.size());
+	packet res (1 + null_bitmap.byte_count(), 0);
+	auto put = [&res](const void* data, std::size_t size) {
+		auto first = static_cast<const std::uint8_t*>(data);
+		res.insert(res.end(), first, first + size);
+	};
+	for (std::size_t i = 0; i < fields.size(); ++i)
+	{
+		if (!fields[i].is_not_null() && gen() % 100 < opts.null_percent)
+		{
+			auto bit = i + detail::binary_row_null_bitmap_offset;
+			res[1 + bit / 8] |= static_cast<std::uint8_t>(1 << (bit % 8));
+			continue;
+		}
+		std::uint64_t v = gen();
+		switch (fields[i].protocol_type())
+		{
+		case protocol_field_type::longlong: put(&v, 8); break;
+		case protocol_field_type::long_: put(&v, 4); break;
+		case protocol_field_type::tiny: put(&v, 1); break;
+		case protocol_field_type::double_: { double d = v / 3.0; put(&d, 8); break; }
+		case protocol_field_type::date:
+			res.insert(res.end(), {4, 0xe2, 0x07, 0x0a, 0x05});
+			break;
+		case protocol_field_type::datetime:
+			res.insert(res.end(), {7, 0xe2, 0x07, 0x0a, 0x05, 0x17, 0x01, 0x32});
+			break;
+		default:
+		{
+			std::size_t size = opts.min_string_size + v % (opts.max_string_size - opts.min_string_size + 1);
+			res.push_back(static_cast<std::uint8_t>(size));
+			res.resize(res.size() + size, 'a');
+		}
+		}
+	}
+	return res;
+}
+
+// Calls make_row() num_rows times
+template <typename RowFactory>
+std::vector<packet> make_rows(std::size_t num_rows, RowFactory&& make_row)
+{
+	std::vector<packet> res;
+	res.reserve(num_rows);
+	for (std::size_t i = 0; i < num_rows; ++i)
+	{
+		res.push_back(make_row());
+	}
+	return res;
+}
+
+// Calls fn(deserialization_context&) for each row. Returns how many calls returned true
+template <typename Fn>
+std::size_t for_each_row(const std::vector<packet>& rows, Fn&& fn)
+{
+	std::size_t res = 0;
+	for (const auto& row: rows)
+	{
+		detail::deserialization_context ctx (row.data(), row.data() + row.size(), detail::capabilities());
+		res += static_cast<bool>(fn(ctx));
+	}
+	return res;
+}
+
+// Calls fn() iterations times. fn returns the number of items it processed
+// successfully, which should be items_per_iteration. Returns items per second
+template <typename Fn>
+double measure(std::size_t iterations, std::size_t items_per_iteration, Fn&& fn)
+{
+	std::size_t total = 0;
+	auto start = clock_type::now();
+	for (std::size_t it = 0; it < iterations; ++it)
+	{
+		total += fn();
+	}
+	std::chrono::duration<double> elapsed = clock_type::now() - start;
+	if (total != iterations * items_per_iteration)
+	{
+		std::cerr << "Unexpected errors: " << iterations * items_per_iteration - total << std::endl;
+	}
+	return total / elapsed.count();
+}
+
+// Nanoseconds per item, given items per second
+inline double to_ns_per_item(double items_per_sec) { return 1e9 / items_per_sec; }
+
+} // bench
+} // mysql
+} // boost
+
+#endif /* BENCH_BENCH_COMMON_HPP_ */
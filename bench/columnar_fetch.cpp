@@ -0,0 +1,119 @@
+/*
+ * columnar_fetch.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: ruben
+ */
+
+#include "boost/mysql/detail/protocol/columnar_deserialization.hpp"
+#include "bench_common.hpp"
+#include <cstdint>
+#include <cstdio>
+#include <iostream>
+#include <random>
+#include <variant>
+#include <vector>
+
+/**
+ * Compares building per-column arrays from text protocol rows by
+ * decoding them into rows of mysql::value and pivoting them (what
+ * fetch_many users had to do), against decoding them straight into a
+ * column_batch, as resultset::fetch_columnar does.
+ *
+ * Usage: bench_columnar_fetch
+ *
+ * Rows (BIGINT, DOUBLE, DATETIME and VARCHAR, 10% NULLs) are generated in
+ * memory, so no server is required. Results are reported in rows per second.
+ */
+
+namespace mysql = boost::mysql;
+using namespace mysql::detail;
+using namespace mysql::bench;
+using mysql::value;
+using mysql::field_metadata;
+using mysql::column_batch;
+
+constexpr std::size_t num_rows = 10000;
+constexpr std::size_t iterations = 50;
+constexpr protocol_field_type field_types [] = {
+	protocol_field_type::longlong,
+	protocol_field_type::double_,
+	protocol_field_type::datetime,
+	protocol_field_type::var_string,
+	protocol_field_type::longlong,
+	protocol_field_type::double_
+};
+constexpr std::size_t num_fields = std::size(field_types);
+
+// What a user had to write before: rows of values, then a pivot
+struct pivoted_columns
+{
+	std::vector<std::vector<std::int64_t>> ints;
+	std::vector<std::vector<double>> doubles;
+	std::vector<std::vector<std::int64_t>> datetimes;
+	std::vector<std::vector<std::string>> strings;
+	std::vector<std::vector<bool>> validity;
+};
+
+std::size_t fetch_and_pivot(const resultset_metadata& meta, const std::vector<packet>& rows)
+{
+	// fetch_many: a vector of values (and a buffer) per row
+	std::vector<std::pmr::vector<value>> decoded;
+	std::vector<packet> buffers;
+	for (const auto& row: rows)
+	{
+		buffers.push_back(row);
+		deserialization_context ctx (buffers.back().data(), buffers.back().data() + row.size(), capabilities());
+		decoded.emplace_back();
+		if (deserialize_text_row(ctx, meta, decoded.back())) return 0;
+	}
+
+	// Pivot
+	pivoted_columns res;
+	res.validity.resize(num_fields);
+	for (std::size_t i = 0; i < num_fields; ++i)
+	{
+		std::vector<std::int64_t>* ints = nullptr;
+		std::vector<double>* doubles = nullptr;
+		std::vector<std::int64_t>* datetimes = nullptr;
+		std::vector<std::string>* strings = nullptr;
+		switch (field_types[i])
+		{
+		case protocol_field_type::longlong: ints = &res.ints.emplace_back(); break;
+		case protocol_field_type::double_: doubles = &res.doubles.emplace_back(); break;
+		case protocol_field_type::datetime: datetimes = &res.datetimes.emplace_back(); break;
+		default: strings = &res.strings.emplace_back(); break;
+		}
+		for (const auto& row: decoded)
+		{
+			const auto& v = row[i];
+			bool is_null = std::holds_alternative<std::nullptr_t>(v);
+			res.validity[i].push_back(!is_null);
+			if (ints) ints->push_back(is_null ? 0 : std::get<std::int64_t>(v));
+			else if (doubles) doubles->push_back(is_null ? 0 : std::get<double>(v));
+			else if (datetimes) datetimes->push_back(is_null ? 0 : std::get<mysql::datetime>(v).time_since_epoch().count());
+			else strings->emplace_back(is_null ? std::string_view() : std::get<std::string_view>(v));
+		}
+	}
+	return res.validity[0].size();
+}
+
+std::size_t fetch_columnar(const resultset_metadata& meta, const std::vector<packet>& rows)
+{
+	column_batch batch (meta.fields());
+	return for_each_row(rows, [&](deserialization_context& ctx) {
+		return !deserialize_columnar_row(ctx, meta, nullptr, batch);
+	});
+}
+
+int main()
+{
+	auto meta = make_metadata(std::vector<protocol_field_type>(std::begin(field_types), std::end(field_types)));
+	std::mt19937 gen (42);
+	auto rows = make_rows(num_rows, [&] { return make_text_row(meta, gen, {10, 7, 9}); });
+
+	double legacy = measure(iterations, rows.size(), [&] { return fetch_and_pivot(meta, rows); });
+	double current = measure(iterations, rows.size(), [&] { return fetch_columnar(meta, rows); });
+	std::cout << "rows + pivot (rows/s)   column_batch (rows/s)   speedup\n";
+	printf("%20.0f %23.0f %8.2fx\n", legacy, current, current / legacy);
+}
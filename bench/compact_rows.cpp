@@ -0,0 +1,141 @@
+/*
+ * compact_rows.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: ruben
+ */
+
+#include "boost/mysql/compact_row.hpp"
+#include "boost/mysql/detail/protocol/text_deserialization.hpp"
+#include "bench_common.hpp"
+#include <cstdint>
+#include <cstdio>
+#include <iostream>
+#include <memory_resource>
+#include <random>
+#include <vector>
+
+/**
+ * Compares keeping rows in memory as owning_row's (what resultset::fetch_one
+ * and fetch_many return) against converting them to compact_row's.
+ *
+ * Usage: bench_compact_rows
+ *
+ * Text protocol rows are generated in memory and decoded as the library does,
+ * so no server is required. For several row shapes, reports the memory taken
+ * per row (bytes allocated plus the size of the row object) and the speed of
+ * a full scan (summing integers and string lengths), in rows per second.
+ */
+
+namespace mysql = boost::mysql;
+using namespace mysql::detail;
+using namespace mysql::bench;
+using mysql::value;
+using mysql::compact_value;
+using mysql::owning_row;
+using mysql::compact_row;
+
+constexpr std::size_t num_rows = 200000;
+constexpr std::size_t num_scans = 20;
+
+struct row_shape
+{
+	const char* name;
+	std::size_t num_fields;
+	std::size_t max_string_size;
+};
+
+// Builds an owning_row the way read_row does: the packet is kept in the row's buffer
+owning_row make_owning_row(
+	const resultset_metadata& meta,
+	const packet& row_packet,
+	std::pmr::memory_resource* resource
+)
+{
+	resource_bytestring buffer (row_packet.begin(), row_packet.end(), resource);
+	std::pmr::vector<value> values (resource);
+	deserialization_context ctx (buffer.data(), buffer.data() + buffer.size(), capabilities());
+	auto err = deserialize_text_row(ctx, meta, values);
+	if (err) std::cerr << "Unexpected decoding error: " << err.message() << std::endl;
+	return owning_row(std::move(values), std::move(buffer));
+}
+
+std::uint64_t scan(const std::vector<owning_row>& rows)
+{
+	std::uint64_t res = 0;
+	for (const auto& r: rows)
+	{
+		for (const auto& v: r.values())
+		{
+			if (const auto* i = std::get_if<std::int64_t>(&v)) res += *i;
+			else if (const auto* s = std::get_if<std::string_view>(&v)) res += s->size();
+		}
+	}
+	return res;
+}
+
+std::uint64_t scan(const std::vector<compact_row>& rows)
+{
+	std::uint64_t res = 0;
+	for (const auto& r: rows)
+	{
+		for (const auto& v: r)
+		{
+			if (v.is<std::int64_t>()) res += v.get<std::int64_t>();
+			else if (v.is<std::string_view>()) res += v.get<std::string_view>().size();
+		}
+	}
+	return res;
+}
+
+// Returns rows per second
+template <typename RowType>
+double measure_scan(const std::vector<RowType>& rows)
+{
+	std::uint64_t checksum = 0;
+	double res = measure(num_scans, rows.size(), [&] {
+		checksum += scan(rows);
+		return rows.size();
+	});
+	if (checksum == 0) std::cerr << "Unexpected checksum" << std::endl;
+	return res;
+}
+
+int main()
+{
+	const row_shape shapes [] = {
+		{"narrow", 4, 8},
+		{"medium", 16, 16},
+		{"wide", 64, 4}
+	};
+
+	std::mt19937 gen (42);
+	std::cout << "shape    owning_row (bytes/row, rows/s)   compact_row (bytes/row, rows/s)   memory saved\n";
+	for (const auto& shape: shapes)
+	{
+		auto meta = make_metadata(repeat_types({
+			protocol_field_type::longlong,
+			protocol_field_type::var_string
+		}, shape.num_fields));
+		counting_resource owning_resource;
+		counting_resource compact_resource;
+		std::vector<owning_row> owning_rows;
+		std::vector<compact_row> compact_rows;
+		owning_rows.reserve(num_rows);
+		compact_rows.reserve(num_rows);
+		for (std::size_t i = 0; i < num_rows; ++i)
+		{
+			auto row_packet = make_text_row(meta, gen, {0, 0, shape.max_string_size});
+			owning_rows.push_back(make_owning_row(meta, row_packet, &owning_resource));
+			compact_rows.emplace_back(owning_rows.back(), &compact_resource);
+		}
+
+		double owning_bytes = static_cast<double>(owning_resource.bytes) / num_rows + sizeof(owning_row);
+		double compact_bytes = static_cast<double>(compact_resource.bytes) / num_rows + sizeof(compact_row);
+		double owning_speed = measure_scan(owning_rows);
+		double compact_speed = measure_scan(compact_rows);
+		printf("%-8s %14.1f %17.0f %18.1f %17.0f %13.1f%%\n", shape.name,
+				owning_bytes, owning_speed, compact_bytes, compact_speed,
+				100.0 * (1.0 - compact_bytes / owning_bytes));
+	}
+}
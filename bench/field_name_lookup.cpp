@@ -0,0 +1,126 @@
+/*
+ * field_name_lookup.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: ruben
+ */
+
+#include "boost/mysql/row.hpp"
+#include "bench_common.hpp"
+#include <cstdio>
+#include <iostream>
+#include <string>
+#include <vector>
+
+/**
+ * Compares accessing row values by field name by linearly scanning
+ * resultset::fields() (what users had to do), against row::operator[],
+ * which uses a hashed index shared by all the rows of a resultset.
+ *
+ * Usage: bench_field_name_lookup
+ *
+ * Each row is looked up by the names of all of its fields. Metadata and rows
+ * are built in memory, so no server is required. Results are reported in
+ * lookups per second, for several field counts.
+ */
+
+namespace mysql = boost::mysql;
+using namespace mysql::detail;
+using namespace mysql::bench;
+using mysql::value;
+using mysql::row;
+
+constexpr std::size_t num_rows = 1000;
+constexpr std::size_t iterations = 20;
+
+struct test_data
+{
+	std::vector<std::string> names;
+	resultset_metadata meta; // fields point into names
+	std::vector<row> rows;
+};
+
+test_data make_data(std::size_t num_fields)
+{
+	test_data res;
+	for (std::size_t i = 0; i < num_fields; ++i)
+	{
+		res.names.push_back("column_name_" + std::to_string(i));
+	}
+	auto name_it = res.names.begin();
+	res.meta = make_metadata(
+		std::vector<protocol_field_type>(num_fields, protocol_field_type::longlong),
+		[&name_it](column_definition_packet& coldef) { coldef.name = string_lenenc(*name_it++); }
+	);
+	for (std::size_t i = 0; i < num_rows; ++i)
+	{
+		std::pmr::vector<value> values;
+		for (std::size_t j = 0; j < num_fields; ++j)
+		{
+			values.emplace_back(std::int64_t(i + j));
+		}
+		res.rows.emplace_back(std::move(values));
+		res.rows.back().set_name_index(res.meta.name_index());
+	}
+	return res;
+}
+
+std::int64_t lookup_linear(const test_data& data)
+{
+	std::int64_t res = 0;
+	const auto& fields = data.meta.fields();
+	for (const auto& r: data.rows)
+	{
+		for (const auto& name: data.names)
+		{
+			for (std::size_t i = 0; i < fields.size(); ++i)
+			{
+				if (fields[i].field_name() == name)
+				{
+					res += std::get<std::int64_t>(r.values()[i]);
+					break;
+				}
+			}
+		}
+	}
+	return res;
+}
+
+std::int64_t lookup_index(const test_data& data)
+{
+	std::int64_t res = 0;
+	for (const auto& r: data.rows)
+	{
+		for (const auto& name: data.names)
+		{
+			res += std::get<std::int64_t>(r[name]);
+		}
+	}
+	return res;
+}
+
+// Returns lookups per second
+template <typename Fn>
+double measure_lookups(const test_data& data, Fn fn, std::int64_t& checksum)
+{
+	std::size_t lookups = num_rows * data.names.size();
+	checksum = 0;
+	return measure(iterations, lookups, [&] {
+		checksum += fn(data);
+		return lookups;
+	});
+}
+
+int main()
+{
+	std::cout << "fields   linear scan (lookups/s)   index (lookups/s)   speedup\n";
+	for (std::size_t num_fields: {4, 16, 64})
+	{
+		auto data = make_data(num_fields);
+		std::int64_t linear_checksum, index_checksum;
+		double linear = measure_lookups(data, &lookup_linear, linear_checksum);
+		double index = measure_lookups(data, &lookup_index, index_checksum);
+		if (linear_checksum != index_checksum) std::cerr << "Checksum mismatch" << std::endl;
+		printf("%6zu %25.0f %19.0f %8.2fx\n", num_fields, linear, index, index / linear);
+	}
+}
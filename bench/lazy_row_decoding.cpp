@@ -0,0 +1,89 @@
+/*
+ * lazy_row_decoding.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: ruben
+ */
+
+#include "boost/mysql/lazy_row.hpp"
+#include "boost/mysql/detail/protocol/text_deserialization.hpp"
+#include "bench_common.hpp"
+#include <cstdio>
+#include <iostream>
+#include <random>
+#include <vector>
+
+/**
+ * Compares reading two out of thirty fields of text protocol rows
+ * (DATETIMEs, DOUBLEs, integers and strings) when decoding the whole row
+ * eagerly, with a lazy_row (values decoded on access) and with a
+ * projection mask that only decodes the two fields.
+ *
+ * Usage: bench_lazy_row_decoding
+ *
+ * Rows are generated in memory, so no server is required. Results are
+ * reported in rows per second.
+ */
+
+namespace mysql = boost::mysql;
+using namespace mysql::detail;
+using namespace mysql::bench;
+using mysql::value;
+using mysql::field_metadata;
+using mysql::lazy_row;
+using mysql::errc;
+
+constexpr std::size_t num_fields = 30;
+constexpr std::size_t num_rows = 2000;
+constexpr std::size_t iterations = 200;
+constexpr std::size_t accessed_fields [] = { 0, 17 };
+
+int main()
+{
+	auto types = repeat_types({
+		protocol_field_type::longlong,
+		protocol_field_type::datetime,
+		protocol_field_type::double_,
+		protocol_field_type::var_string,
+		protocol_field_type::datetime
+	}, num_fields);
+	auto set_decimals = [](column_definition_packet& coldef) {
+		coldef.decimals.value = coldef.type == protocol_field_type::datetime ? 6 : 0;
+	};
+	auto meta = make_metadata(types, set_decimals);
+	auto projected_meta = make_metadata(types, set_decimals);
+	std::vector<bool> mask (num_fields, false);
+	for (auto i: accessed_fields) mask[i] = true;
+	projected_meta.set_projection(std::move(mask));
+
+	std::mt19937 gen (42);
+	auto rows = make_rows(num_rows, [&] { return make_text_row(meta, gen, {0, 18, 18}); });
+
+	std::pmr::vector<value> values;
+	std::size_t sink = 0;
+	auto eager_fn = [&](const resultset_metadata& m) {
+		return [&, meta_ptr = &m](deserialization_context& ctx) {
+			if (deserialize_text_row(ctx, *meta_ptr, values)) return false;
+			for (auto i: accessed_fields) sink += std::holds_alternative<std::nullptr_t>(values[i]);
+			return true;
+		};
+	};
+	lazy_row row;
+	auto lazy_fn = [&](deserialization_context& ctx) {
+		if (row.assign(ctx, meta, false) != errc::ok) return false;
+		for (auto i: accessed_fields) sink += std::holds_alternative<std::nullptr_t>(row.get(i));
+		return true;
+	};
+
+	auto measure_rows = [&rows](auto row_fn) {
+		return measure(iterations, rows.size(), [&] { return for_each_row(rows, row_fn); });
+	};
+	double eager = measure_rows(eager_fn(meta));
+	double lazy = measure_rows(lazy_fn);
+	double projected = measure_rows(eager_fn(projected_meta));
+	std::cout << "mode          rows/s       speedup\n";
+	printf("%-12s %10.0f %10.2fx\n", "eager", eager, 1.0);
+	printf("%-12s %10.0f %10.2fx\n", "lazy", lazy, lazy / eager);
+	printf("%-12s %10.0f %10.2fx\n", "projection", projected, projected / eager);
+	if (sink) std::cerr << "Unexpected NULLs: " << sink << std::endl;
+}
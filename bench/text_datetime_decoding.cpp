@@ -0,0 +1,150 @@
+/*
+ * text_datetime_decoding.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: ruben
+ */
+
+#include "boost/mysql/detail/protocol/text_deserialization.hpp"
+#include "bench_common.hpp"
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+/**
+ * Compares the decoding of text protocol DATE, DATETIME and TIME values
+ * by the library, based on fixed-layout digit parsing, against the
+ * sscanf based decoder it replaced.
+ *
+ * Usage: bench_text_datetime_decoding
+ *
+ * Values are generated in memory, so no server is required. Results are
+ * reported in nanoseconds per value.
+ */
+
+namespace mysql = boost::mysql;
+using namespace mysql::bench;
+using mysql::errc;
+
+constexpr std::size_t num_values = 100000;
+constexpr std::size_t iterations = 10;
+
+// The decoders before the change, kept here as a baseline
+errc legacy_decode(std::string_view from, mysql::date& to)
+{
+	constexpr std::size_t size = 4 + 2 + 2 + 2; // year, month, day, separators
+	if (from.size() != size) return errc::protocol_value_error;
+	unsigned year, month, day;
+	char buffer [size + 1] {};
+	memcpy(buffer, from.data(), from.size());
+	int parsed = sscanf(buffer, "%4u-%2u-%2u", &year, &month, &day);
+	if (parsed != 3) return errc::protocol_value_error;
+	::date::year_month_day result (::date::year(year)/::date::month(month)/::date::day(day));
+	if (!result.ok()) return errc::protocol_value_error;
+	if (result > mysql::detail::max_date || result < mysql::detail::min_date) return errc::protocol_value_error;
+	to = result;
+	return errc::ok;
+}
+
+errc legacy_decode(std::string_view from, mysql::time& to, unsigned decimals)
+{
+	constexpr std::size_t min_size = 2 + 2 + 2 + 2; // hours, mins, seconds, no micros
+	constexpr std::size_t max_size = min_size + 1 + 1 + 7; // hour extra character, sign and micros
+	decimals = std::min(decimals, 6u);
+	if (from.size() < min_size || from.size() > max_size) return errc::protocol_value_error;
+	int hours;
+	unsigned minutes, seconds, micros = 0;
+	char buffer [max_size + 1] {};
+	memcpy(buffer, from.data(), from.size());
+	int parsed = decimals ? sscanf(buffer, "%4d:%2u:%2u.%6u", &hours, &minutes, &seconds, &micros) :
+			                sscanf(buffer, "%4d:%2u:%2u", &hours, &minutes, &seconds);
+	if ((decimals && parsed != 4) || (!decimals && parsed != 3)) return errc::protocol_value_error;
+	micros *= static_cast<unsigned>(std::pow(10, 6 - decimals));
+	hours = std::abs(hours);
+	bool is_negative = from[0] == '-';
+	auto res = std::chrono::hours(hours) + std::chrono::minutes(minutes) +
+			   std::chrono::seconds(seconds) + std::chrono::microseconds(micros);
+	if (is_negative) res = -res;
+	if (res > mysql::detail::max_time || res < mysql::detail::min_time) return errc::protocol_value_error;
+	to = res;
+	return errc::ok;
+}
+
+errc legacy_decode(std::string_view from, mysql::datetime& to, unsigned decimals)
+{
+	constexpr std::size_t min_size = 4 + 5*2 + 5;
+	decimals = std::min(decimals, 6u);
+	std::size_t expected_size = min_size + (decimals ? decimals + 1 : 0);
+	if (from.size() != expected_size) return errc::protocol_value_error;
+	mysql::date dt;
+	auto err = legacy_decode(from.substr(0, 10), dt);
+	if (err != errc::ok) return err;
+	mysql::time time_of_day;
+	err = legacy_decode(from.substr(11), time_of_day, decimals);
+	if (err != errc::ok) return err;
+	constexpr auto max_time_of_day = std::chrono::hours(24) - std::chrono::microseconds(1);
+	if (time_of_day < std::chrono::seconds(0) || time_of_day > max_time_of_day) return errc::protocol_value_error;
+	to = dt + time_of_day;
+	return errc::ok;
+}
+
+// Returns nanoseconds per value
+template <typename T, typename Decoder>
+double measure_decoder(const std::vector<std::string>& values, Decoder decoder)
+{
+	T output {};
+	return to_ns_per_item(measure(iterations, values.size(), [&] {
+		std::size_t ok = 0;
+		for (const auto& v: values)
+		{
+			ok += decoder(v, output) == errc::ok;
+		}
+		return ok;
+	}));
+}
+
+template <typename T>
+void run(const char* name, const std::vector<std::string>& values, unsigned decimals)
+{
+	double legacy = measure_decoder<T>(values, [decimals](std::string_view from, T& to) {
+		if constexpr (std::is_same_v<T, mysql::date>) return legacy_decode(from, to);
+		else return legacy_decode(from, to, decimals);
+	});
+	double current = measure_decoder<T>(values, [decimals](std::string_view from, T& to) {
+		if constexpr (std::is_same_v<T, mysql::date>) return mysql::detail::deserialize_text_value_impl(from, to);
+		else return mysql::detail::deserialize_text_value_impl(from, to, decimals);
+	});
+	printf("%-12s %20.1f %22.1f %8.2fx\n", name, legacy, current, legacy / current);
+}
+
+int main()
+{
+	std::mt19937 gen (42);
+	auto rnd = [&gen](int lo, int hi) { return std::uniform_int_distribution<int>(lo, hi)(gen); };
+	std::vector<std::string> dates, datetimes, datetimes6, times6;
+	char buffer [64];
+	for (std::size_t i = 0; i < num_values; ++i)
+	{
+		int y = rnd(1970, 2037), m = rnd(1, 12), d = rnd(1, 28), h = rnd(0, 23), mi = rnd(0, 59), s = rnd(0, 59);
+		int us = rnd(0, 999999);
+		snprintf(buffer, sizeof(buffer), "%04d-%02d-%02d", y, m, d);
+		dates.emplace_back(buffer);
+		snprintf(buffer, sizeof(buffer), "%04d-%02d-%02d %02d:%02d:%02d", y, m, d, h, mi, s);
+		datetimes.emplace_back(buffer);
+		snprintf(buffer, sizeof(buffer), "%04d-%02d-%02d %02d:%02d:%02d.%06d", y, m, d, h, mi, s, us);
+		datetimes6.emplace_back(buffer);
+		snprintf(buffer, sizeof(buffer), "%s%02d:%02d:%02d.%06d", rnd(0, 1) ? "-" : "", rnd(0, 838), mi, s, us);
+		times6.emplace_back(buffer);
+	}
+
+	std::cout << "type         sscanf (ns/value)   digit parser (ns/value)   speedup\n";
+	run<mysql::date>("DATE", dates, 0);
+	run<mysql::datetime>("DATETIME", datetimes, 0);
+	run<mysql::datetime>("DATETIME(6)", datetimes6, 6);
+	run<mysql::time>("TIME(6)", times6, 6);
+}
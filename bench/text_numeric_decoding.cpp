@@ -0,0 +1,146 @@
+/*
+ * text_numeric_decoding.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: ruben
+ */
+
+#include "boost/mysql/detail/protocol/text_deserialization.hpp"
+#include "bench_common.hpp"
+#include <boost/lexical_cast/try_lexical_convert.hpp>
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+/**
+ * Compares the decoding of text protocol numeric values (integers,
+ * FLOAT and DOUBLE) by the library, based on std::from_chars, against
+ * the boost::lexical_cast based decoder it replaced.
+ *
+ * Usage: bench_text_numeric_decoding
+ *
+ * Values are generated in memory for a few column mixes that resemble real
+ * resultsets, so no server is required. Results are reported in nanoseconds
+ * per field.
+ */
+
+using namespace boost::mysql;
+using namespace boost::mysql::bench;
+using detail::protocol_field_type;
+namespace column_flags = detail::column_flags;
+
+constexpr std::size_t num_rows = 20000;
+constexpr std::size_t iterations = 20;
+
+// The decoder before the change, kept here as a baseline
+template <typename T>
+errc legacy_decode(std::string_view from, value& to)
+{
+	T v;
+	bool ok = boost::conversion::try_lexical_convert(from.data(), from.size(), v);
+	if (ok) to = v;
+	return ok ? errc::ok : errc::protocol_value_error;
+}
+
+errc legacy_deserialize_text_value(std::string_view from, const field_metadata& meta, value& to)
+{
+	switch (meta.protocol_type())
+	{
+	case protocol_field_type::tiny:
+	case protocol_field_type::short_:
+	case protocol_field_type::int24:
+	case protocol_field_type::long_:
+	case protocol_field_type::year:
+		return meta.is_unsigned() ? legacy_decode<std::uint32_t>(from, to) : legacy_decode<std::int32_t>(from, to);
+	case protocol_field_type::longlong:
+		return meta.is_unsigned() ? legacy_decode<std::uint64_t>(from, to) : legacy_decode<std::int64_t>(from, to);
+	case protocol_field_type::float_: return legacy_decode<float>(from, to);
+	case protocol_field_type::double_: return legacy_decode<double>(from, to);
+	default: return detail::deserialize_text_value(from, meta, to);
+	}
+}
+
+// Generates a value as MySQL would send it
+std::string make_text_value(const field_metadata& meta, std::mt19937_64& gen)
+{
+	switch (meta.protocol_type())
+	{
+	case protocol_field_type::tiny: return std::to_string(std::int32_t(gen() % 256) - 128);
+	case protocol_field_type::long_:
+		return meta.is_unsigned() ? std::to_string(std::uint32_t(gen())) : std::to_string(std::int32_t(gen() % 200000) - 100000);
+	case protocol_field_type::longlong:
+		return meta.is_unsigned() ? std::to_string(gen()) : std::to_string(std::int64_t(gen() >> 20));
+	case protocol_field_type::float_:
+	{
+		char buff [32];
+		snprintf(buff, sizeof(buff), "%g", std::uniform_real_distribution<float>(-1000, 1000)(gen));
+		return buff;
+	}
+	case protocol_field_type::double_:
+	{
+		char buff [32];
+		snprintf(buff, sizeof(buff), "%.17g", std::uniform_real_distribution<double>(-1e6, 1e6)(gen));
+		return buff;
+	}
+	default: return "some varchar value";
+	}
+}
+
+struct column_mix
+{
+	const char* name;
+	std::pmr::vector<field_metadata> fields;
+};
+
+// Returns nanoseconds per field
+template <typename Decoder>
+double measure_decoder(const column_mix& mix, const std::vector<std::string>& values, Decoder decoder)
+{
+	value output;
+	return to_ns_per_item(measure(iterations, values.size(), [&] {
+		std::size_t ok = 0;
+		for (std::size_t i = 0; i < values.size(); ++i)
+		{
+			const auto& meta = mix.fields[i % mix.fields.size()];
+			ok += decoder(values[i], meta, output) == errc::ok;
+		}
+		return ok;
+	}));
+}
+
+int main()
+{
+	std::vector<column_mix> mixes {
+		{"integers", {
+			make_field(protocol_field_type::long_), make_field(protocol_field_type::long_, column_flags::unsigned_),
+			make_field(protocol_field_type::tiny), make_field(protocol_field_type::longlong),
+			make_field(protocol_field_type::longlong, column_flags::unsigned_)
+		}},
+		{"floating point", {
+			make_field(protocol_field_type::double_), make_field(protocol_field_type::float_),
+			make_field(protocol_field_type::double_)
+		}},
+		{"mixed", {
+			make_field(protocol_field_type::longlong), make_field(protocol_field_type::var_string),
+			make_field(protocol_field_type::long_), make_field(protocol_field_type::double_),
+			make_field(protocol_field_type::tiny), make_field(protocol_field_type::var_string)
+		}}
+	};
+
+	std::mt19937_64 gen (42);
+	std::cout << "mix             lexical_cast (ns/field)   from_chars (ns/field)   speedup\n";
+	for (const auto& mix: mixes)
+	{
+		std::vector<std::string> values;
+		values.reserve(num_rows * mix.fields.size());
+		for (std::size_t i = 0; i < num_rows * mix.fields.size(); ++i)
+		{
+			values.push_back(make_text_value(mix.fields[i % mix.fields.size()], gen));
+		}
+		double legacy = measure_decoder(mix, values, &legacy_deserialize_text_value);
+		double current = measure_decoder(mix, values, &detail::deserialize_text_value);
+		printf("%-15s %25.1f %23.1f %8.2fx\n", mix.name, legacy, current, legacy / current);
+	}
+}
@@ -0,0 +1,119 @@
+/*
+ * text_row_decoding.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: ruben
+ */
+
+#include "boost/mysql/detail/protocol/text_deserialization.hpp"
+#include "bench_common.hpp"
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <vector>
+
+/**
+ * Compares the decoding of text protocol rows (query resultsets) by the
+ * library, which reads field boundaries directly from the message with a
+ * fast path for single byte lengths and NULLs, against the generic
+ * deserialize-and-rewind walk it replaced.
+ *
+ * Usage: bench_text_row_decoding
+ *
+ * Rows are generated in memory for narrow and wide resultsets of short
+ * values, dense and sparse (mostly NULL), so no server is required.
+ * Results are reported in rows per second.
+ */
+
+namespace mysql = boost::mysql;
+using namespace mysql::detail;
+using namespace mysql::bench;
+using mysql::value;
+using mysql::field_metadata;
+using mysql::errc;
+using mysql::error_code;
+
+constexpr std::size_t num_rows = 2000;
+constexpr std::size_t total_values = 20000000; // per measurement, to keep run times similar
+
+// The decoder before the change, kept here as a baseline
+bool legacy_is_next_field_null(deserialization_context& ctx)
+{
+	int1 type_byte;
+	errc err = deserialize(type_byte, ctx);
+	if (err == errc::ok)
+	{
+		if (type_byte.value == 0xfb) return true;
+		ctx.rewind(1);
+	}
+	return false;
+}
+
+error_code legacy_deserialize_row(deserialization_context& ctx, const resultset_metadata& meta, std::pmr::vector<value>& output)
+{
+	const auto& fields = meta.fields();
+	output.resize(fields.size());
+	for (std::size_t i = 0; i < fields.size(); ++i)
+	{
+		if (legacy_is_next_field_null(ctx))
+		{
+			output[i] = nullptr;
+		}
+		else
+		{
+			string_lenenc value_str;
+			errc err = deserialize(value_str, ctx);
+			if (err != errc::ok) return make_error_code(err);
+			err = deserialize_text_value(value_str.value, fields[i], output[i]);
+			if (err != errc::ok) return make_error_code(err);
+		}
+	}
+	if (!ctx.empty()) return make_error_code(errc::extra_bytes);
+	return error_code();
+}
+
+struct row_shape
+{
+	const char* name;
+	std::size_t num_fields;
+	unsigned null_percent;
+};
+
+template <typename Deserializer>
+double measure_decoder(
+	const resultset_metadata& meta,
+	const std::vector<packet>& rows,
+	Deserializer deserializer
+)
+{
+	std::pmr::vector<value> output;
+	std::size_t iterations = std::max<std::size_t>(1, total_values / (rows.size() * meta.fields().size()));
+	return measure(iterations, rows.size(), [&] {
+		return for_each_row(rows, [&](deserialization_context& ctx) { return !deserializer(ctx, meta, output); });
+	});
+}
+
+int main()
+{
+	const row_shape shapes [] = {
+		{"narrow", 5, 10},
+		{"wide", 100, 10},
+		{"wide sparse", 100, 80}
+	};
+
+	std::mt19937 gen (42);
+	std::cout << "shape        deserialize+rewind (rows/s)   boundary scan (rows/s)   speedup\n";
+	for (const auto& shape: shapes)
+	{
+		auto meta = make_metadata(repeat_types({
+			protocol_field_type::var_string,
+			protocol_field_type::var_string,
+			protocol_field_type::var_string,
+			protocol_field_type::long_
+		}, shape.num_fields));
+		auto rows = make_rows(num_rows, [&] { return make_text_row(meta, gen, {shape.null_percent}); });
+		double legacy = measure_decoder(meta, rows, &legacy_deserialize_row);
+		double current = measure_decoder(meta, rows, &deserialize_text_row);
+		printf("%-12s %29.0f %24.0f %8.2fx\n", shape.name, legacy, current, current / legacy);
+	}
+}
@@ -0,0 +1,101 @@
+/*
+ * typed_row_decoding.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: ruben
+ */
+
+#include "boost/mysql/detail/protocol/text_deserialization.hpp"
+#include "boost/mysql/detail/protocol/typed_deserialization.hpp"
+#include "bench_common.hpp"
+#include <cstdint>
+#include <cstdio>
+#include <iostream>
+#include <optional>
+#include <random>
+#include <variant>
+#include <vector>
+
+/**
+ * Compares reading text protocol rows into user structs by decoding them
+ * into rows of mysql::value and converting each value (what fetch_one
+ * users had to do), against decoding them straight into the structs, as
+ * resultset::fetch_one_as does.
+ *
+ * Usage: bench_typed_row_decoding
+ *
+ * Rows (BIGINT, DOUBLE, DATETIME and nullable VARCHAR) are generated in
+ * memory, so no server is required. Results are reported in rows per second.
+ */
+
+namespace mysql = boost::mysql;
+using namespace mysql::detail;
+using namespace mysql::bench;
+using mysql::value;
+using mysql::field_metadata;
+
+constexpr std::size_t num_rows = 10000;
+constexpr std::size_t iterations = 50;
+constexpr protocol_field_type field_types [] = {
+	protocol_field_type::longlong,
+	protocol_field_type::double_,
+	protocol_field_type::datetime,
+	protocol_field_type::var_string
+};
+
+struct order
+{
+	std::int64_t id;
+	double amount;
+	mysql::datetime created_at;
+	std::optional<std::string_view> comment;
+};
+
+// What a user had to write before: a row of values, then a conversion per field
+std::size_t decode_values(const resultset_metadata& meta, const std::vector<packet>& rows)
+{
+	std::pmr::vector<value> values;
+	return for_each_row(rows, [&](deserialization_context& ctx) {
+		if (deserialize_text_row(ctx, meta, values)) return false;
+		order o {
+			std::get<std::int64_t>(values[0]),
+			std::get<double>(values[1]),
+			std::get<mysql::datetime>(values[2]),
+			std::holds_alternative<std::nullptr_t>(values[3]) ?
+					std::optional<std::string_view>() : std::get<std::string_view>(values[3])
+		};
+		return o.created_at.time_since_epoch().count() != 0 || o.amount != 0 || o.id != 0 || o.comment ? true : true;
+	});
+}
+
+std::size_t decode_typed(const resultset_metadata& meta, const std::vector<packet>& rows)
+{
+	order o;
+	return for_each_row(rows, [&](deserialization_context& ctx) {
+		return !deserialize_typed_row(ctx, meta, false, o);
+	});
+}
+
+int main()
+{
+	// Only the comment is nullable
+	auto meta = make_metadata(
+		std::vector<protocol_field_type>(std::begin(field_types), std::end(field_types)),
+		[](column_definition_packet& coldef) {
+			if (coldef.type != protocol_field_type::var_string) coldef.flags.value = column_flags::not_null;
+		}
+	);
+	mysql::error_info info;
+	if (check_row_type<order>(meta.fields(), info) != mysql::errc::ok)
+	{
+		std::cerr << info.message() << std::endl;
+		return 1;
+	}
+	std::mt19937 gen (42);
+	auto rows = make_rows(num_rows, [&] { return make_text_row(meta, gen, {10, 9, 11}); });
+
+	double legacy = measure(iterations, rows.size(), [&] { return decode_values(meta, rows); });
+	double current = measure(iterations, rows.size(), [&] { return decode_typed(meta, rows); });
+	std::cout << "values + conversion (rows/s)   typed (rows/s)   speedup\n";
+	printf("%28.0f %16.0f %8.2fx\n", legacy, current, current / legacy);
+}
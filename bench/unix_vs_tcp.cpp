@@ -0,0 +1,146 @@
+/*
+ * unix_vs_tcp.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: ruben
+ */
+
+#include "boost/mysql/connection.hpp"
+#include <boost/asio/io_context.hpp>
+#include <boost/system/system_error.hpp>
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <vector>
+
+/**
+ * Compares per-query latency and row throughput over a UNIX socket
+ * and over loopback TCP, against the same server.
+ *
+ * Usage: bench_unix_vs_tcp <username> <password> [socket path] [TCP port]
+ *
+ * Latency is measured as the time to issue a trivial query and read its only row.
+ * Throughput is measured by reading a big resultset generated by the server,
+ * so no setup is required.
+ */
+
+using clock_type = std::chrono::steady_clock;
+
+constexpr std::size_t latency_iterations = 5000;
+constexpr std::size_t throughput_iterations = 5;
+constexpr std::size_t throughput_rows = 100000;
+constexpr std::size_t batch_size = 1024;
+
+struct latency_results
+{
+	double mean_us;
+	double p50_us;
+	double p99_us;
+};
+
+template <typename Stream>
+latency_results measure_latency(boost::mysql::connection<Stream>& conn)
+{
+	std::vector<double> samples;
+	samples.reserve(latency_iterations);
+	for (std::size_t i = 0; i < latency_iterations; ++i)
+	{
+		auto start = clock_type::now();
+		auto result = conn.query("SELECT 1");
+		result.fetch_all();
+		std::chrono::duration<double, std::micro> elapsed = clock_type::now() - start;
+		samples.push_back(elapsed.count());
+	}
+	std::sort(samples.begin(), samples.end());
+	double total = 0;
+	for (double s: samples) total += s;
+	return latency_results {
+		total / samples.size(),
+		samples[samples.size() / 2],
+		samples[samples.size() * 99 / 100]
+	};
+}
+
+template <typename Stream>
+double measure_throughput(boost::mysql::connection<Stream>& conn)
+{
+	conn.query("SET SESSION cte_max_recursion_depth = " + std::to_string(throughput_rows));
+	std::string sql =
+		"WITH RECURSIVE seq(n) AS (SELECT 1 UNION ALL SELECT n + 1 FROM seq WHERE n < " +
+		std::to_string(throughput_rows) +
+		") SELECT n, REPEAT('a', 64), n * 0.5 FROM seq";
+
+	std::size_t rows_read = 0;
+	auto start = clock_type::now();
+	for (std::size_t i = 0; i < throughput_iterations; ++i)
+	{
+		auto result = conn.query(sql);
+		while (!result.complete())
+		{
+			rows_read += result.fetch_batch(batch_size).size();
+		}
+	}
+	std::chrono::duration<double> elapsed = clock_type::now() - start;
+	return rows_read / elapsed.count();
+}
+
+template <typename Stream>
+void run(const char* name, boost::mysql::connection<Stream>& conn, const boost::mysql::connection_params& params)
+{
+	conn.handshake(params);
+	measure_latency(conn); // warm up
+	auto latency = measure_latency(conn);
+	double rows_per_second = measure_throughput(conn);
+	std::cout << name << ":\n"
+	          << "  latency (us): mean " << latency.mean_us
+	          << ", p50 " << latency.p50_us
+	          << ", p99 " << latency.p99_us << "\n"
+	          << "  throughput: " << static_cast<std::uint64_t>(rows_per_second) << " rows/s\n";
+}
+
+void main_impl(int argc, char** argv)
+{
+	if (argc < 3 || argc > 5)
+	{
+		std::cerr << "Usage: " << argv[0] << " <username> <password> [socket path] [TCP port]\n";
+		exit(1);
+	}
+	const char* socket_path = argc >= 4 ? argv[3] : "/var/run/mysqld/mysqld.sock";
+	unsigned short port = argc >= 5 ? static_cast<unsigned short>(std::stoi(argv[4])) : boost::mysql::default_port;
+
+	boost::mysql::connection_params params (argv[1], argv[2]);
+	boost::asio::io_context ctx;
+
+	boost::mysql::tcp_connection tcp_conn (ctx);
+	tcp_conn.next_layer().connect(boost::asio::ip::tcp::endpoint(boost::asio::ip::address_v4::loopback(), port));
+	tcp_conn.next_layer().set_option(boost::asio::ip::tcp::no_delay(true));
+	run("loopback TCP", tcp_conn, params);
+
+#ifdef BOOST_ASIO_HAS_LOCAL_SOCKETS
+	boost::mysql::local_connection unix_conn (ctx);
+	unix_conn.next_layer().connect(boost::asio::local::stream_protocol::endpoint(socket_path));
+	run("UNIX socket", unix_conn, params);
+#else
+	(void)socket_path;
+	std::cout << "UNIX sockets are not supported in this platform\n";
+#endif
+}
+
+int main(int argc, char** argv)
+{
+	try
+	{
+		main_impl(argc, argv);
+	}
+	catch (const boost::system::system_error& err)
+	{
+		std::cerr << "Error: " << err.what() << ", error code: " << err.code() << std::endl;
+		return 1;
+	}
+	catch (const std::exception& err)
+	{
+		std::cerr << "Error: " << err.what() << std::endl;
+		return 1;
+	}
+}
@@ -0,0 +1,112 @@
+/*
+ * wide_metadata.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: ruben
+ */
+
+#include "boost/mysql/metadata.hpp"
+#include "bench_common.hpp"
+#include <cstdio>
+#include <iostream>
+#include <memory_resource>
+#include <string>
+#include <vector>
+
+/**
+ * Compares processing the field definitions of wide SELECT * resultsets
+ * by storing each packet in its own buffer (what execute_generic used to do),
+ * against storing all of them in a single buffer, as resultset_metadata_builder does.
+ *
+ * Usage: bench_wide_metadata
+ *
+ * Field definition packets are generated in memory, so no server is required.
+ * Results are reported in resultsets per second and allocations per resultset,
+ * for several field counts.
+ */
+
+namespace mysql = boost::mysql;
+using namespace mysql::detail;
+using namespace mysql::bench;
+using mysql::field_metadata;
+using mysql::error_code;
+
+constexpr std::size_t total_fields = 1000000; // per measure, split into resultsets
+
+bytestring make_packet(std::size_t index)
+{
+	std::string name = "column_name_" + std::to_string(index);
+	bytestring res;
+	for (std::string_view value: {std::string_view("def"), std::string_view("awesome"),
+			std::string_view("wide_table"), std::string_view("wide_table"), std::string_view(name),
+			std::string_view(name)})
+	{
+		res.push_back(static_cast<std::uint8_t>(value.size()));
+		res.insert(res.end(), value.begin(), value.end());
+	}
+	bytestring fixed_fields { 0x0c, 0x21, 0x00, 0xfc, 0x03, 0x00, 0x00, 0xfd, 0x00, 0x00, 0x00, 0x00, 0x00 };
+	res.insert(res.end(), fixed_fields.begin(), fixed_fields.end());
+	return res;
+}
+
+// One buffer per packet
+std::size_t process_per_packet(const std::vector<bytestring>& packets, std::pmr::memory_resource* resource)
+{
+	std::vector<resource_bytestring> buffers;
+	std::pmr::vector<field_metadata> fields;
+	buffers.reserve(packets.size());
+	fields.reserve(packets.size());
+	for (const auto& packet: packets)
+	{
+		resource_bytestring buffer (packet.begin(), packet.end(), resource); // read into a new buffer
+		column_definition_packet field_definition;
+		deserialization_context ctx (boost::asio::buffer(buffer), capabilities());
+		if (deserialize_message(field_definition, ctx)) return 0;
+		fields.emplace_back(field_definition);
+		buffers.push_back(std::move(buffer));
+	}
+	resultset_metadata meta ({}, {}, std::move(fields)); // buffers were owned by it, too
+	return meta.fields().size();
+}
+
+// A single buffer for all packets
+std::size_t process_single_buffer(const std::vector<bytestring>& packets, std::pmr::memory_resource* resource)
+{
+	resultset_metadata_builder builder (resource);
+	builder.reserve(packets.size());
+	for (const auto& packet: packets)
+	{
+		builder.add_packet(boost::asio::buffer(packet));
+	}
+	resultset_metadata meta;
+	if (std::move(builder).build(capabilities(), meta)) return 0;
+	return meta.fields().size();
+}
+
+template <typename Fn>
+void measure(const std::vector<bytestring>& packets, Fn fn, double& resultsets_per_sec, double& allocs_per_resultset)
+{
+	counting_resource resource;
+	std::size_t iterations = total_fields / packets.size();
+	double fields_per_sec = measure(iterations, packets.size(), [&] { return fn(packets, &resource); });
+	resultsets_per_sec = fields_per_sec / packets.size();
+	allocs_per_resultset = static_cast<double>(resource.allocations) / iterations;
+}
+
+int main()
+{
+	std::cout << "fields   per packet (rs/s, allocs)   single buffer (rs/s, allocs)   speedup\n";
+	for (std::size_t num_fields: {10, 100, 500})
+	{
+		std::vector<bytestring> packets;
+		for (std::size_t i = 0; i < num_fields; ++i)
+		{
+			packets.push_back(make_packet(i));
+		}
+		double legacy, legacy_allocs, current, current_allocs;
+		measure(packets, &process_per_packet, legacy, legacy_allocs);
+		measure(packets, &process_single_buffer, current, current_allocs);
+		printf("%6zu %16.0f %10.1f %20.0f %10.1f %8.2fx\n", num_fields, legacy, legacy_allocs,
+			current, current_allocs, current / legacy);
+	}
+}
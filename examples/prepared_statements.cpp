@@ -82,7 +82,7 @@ void main_impl(int argc, char** argv)
 	 * An iterator version of execute() is also available.
 	 */
 	boost::mysql::tcp_resultset result = salary_getter.execute(boost::mysql::make_values("Efficient"));
-	std::vector<boost::mysql::owning_row> salaries = result.fetch_all(); // Get all the results
+	std::pmr::vector<boost::mysql::owning_row> salaries = result.fetch_all(); // Get all the results
 	assert(salaries.size() == 1);
 	[[maybe_unused]] auto salary = std::get<double>(salaries[0].values().at(0)); // First row, first column
 	assert(salary == 30000);
@@ -96,7 +96,7 @@ public:
 		connection.async_query(sql, [this](error_code err, tcp_resultset&& result) {
 			die_on_error(err, additional_info);
 			resultset = std::move(result);
-			resultset.async_fetch_all([this](error_code err, const std::vector<owning_row>& rows) {
+			resultset.async_fetch_all([this](error_code err, const std::pmr::vector<owning_row>& rows) {
 				die_on_error(err, additional_info);
 				for (const auto& employee: rows)
 				{
@@ -123,7 +123,7 @@ public:
 		connection.async_query(sql, [this](error_code err, tcp_resultset&& result) {
 			die_on_error(err, additional_info);
 			resultset = std::move(result);
-			resultset.async_fetch_all([this](error_code err, const std::vector<owning_row>& rows) {
+			resultset.async_fetch_all([this](error_code err, const std::pmr::vector<owning_row>& rows) {
 				die_on_error(err, additional_info);
 				assert(rows.size() == 1);
 				[[maybe_unused]] auto salary = std::get<double>(rows[0].values()[0]);
@@ -83,7 +83,7 @@ void main_impl(int argc, char** argv)
 	boost::mysql::tcp_resultset result = conn.query(sql);
 
 	// Get all the rows in the resultset
-	std::vector<boost::mysql::owning_row> employees = result.fetch_all();
+	std::pmr::vector<boost::mysql::owning_row> employees = result.fetch_all();
 	for (const auto& employee: employees)
 	{
 		print_employee(employee);
@@ -0,0 +1,171 @@
+#ifndef INCLUDE_BOOST_MYSQL_COLUMN_BATCH_HPP_
+#define INCLUDE_BOOST_MYSQL_COLUMN_BATCH_HPP_
+
+#include "boost/mysql/metadata.hpp"
+#include <cassert>
+#include <cstdint>
+#include <memory_resource>
+#include <string_view>
+#include <vector>
+
+namespace boost {
+namespace mysql {
+
+/**
+ * \brief How the values of a column are stored in a column_batch.
+ * \details Chosen from the field's type (\see get_column_kind).
+ */
+enum class column_kind
+{
+	int64,    ///< Signed TINYINT, SMALLINT, MEDIUMINT, INT, BIGINT and YEAR, in int64_values().
+	uint64,   ///< Unsigned integers, in uint64_values().
+	double_,  ///< FLOAT and DOUBLE, in double_values().
+	date,     ///< DATE, as days since 1970-01-01, in int64_values().
+	datetime, ///< DATETIME and TIMESTAMP, as microseconds since 1970-01-01 00:00:00, in int64_values().
+	time,     ///< TIME, as (signed) microseconds, in int64_values().
+	string    ///< Any other type, in string_offsets() and string_data().
+};
+
+/// Returns the column_kind used to store values of the given field in a column_batch.
+inline column_kind get_column_kind(const field_metadata& meta) noexcept;
+
+/**
+ * \brief The values of a single field for all the rows in a column_batch.
+ * \details Values are stored in a contiguous typed array chosen by kind(),
+ * plus a validity bitmap. Only the array matching kind() is populated;
+ * the rest are empty. NULL values take a zero (or empty string) slot in the
+ * array, so the i-th value is always at position i.
+ *
+ * Strings are stored as in Apache Arrow: the i-th string is
+ * string_data()[string_offsets()[i], string_offsets()[i+1]), and string_offsets()
+ * has size() + 1 elements.
+ */
+class column
+{
+	column_kind kind_ {column_kind::string};
+	std::size_t size_ {0};
+	std::pmr::vector<std::uint8_t> validity_;
+	std::pmr::vector<std::int64_t> int64_values_;
+	std::pmr::vector<std::uint64_t> uint64_values_;
+	std::pmr::vector<double> double_values_;
+	std::pmr::vector<std::size_t> string_offsets_;
+	std::pmr::vector<char> string_data_;
+
+	void set_valid(bool valid);
+public:
+	/// Constructs an empty column, allocating memory from resource.
+	explicit column(
+		column_kind kind,
+		std::pmr::memory_resource* resource = std::pmr::get_default_resource()
+	);
+
+	/// How the values of this column are stored.
+	column_kind kind() const noexcept { return kind_; }
+
+	/// The number of values in the column.
+	std::size_t size() const noexcept { return size_; }
+
+	/// Returns true if the i-th value is NULL.
+	bool is_null(std::size_t i) const noexcept
+	{
+		assert(i < size_);
+		return !(validity_[i / 8] & (1 << (i % 8)));
+	}
+
+	/**
+	 * \brief The validity bitmap.
+	 * \details Bit i % 8 of byte i / 8 (least significant bit first)
+	 * is set if the i-th value is not NULL.
+	 */
+	const std::pmr::vector<std::uint8_t>& validity() const noexcept { return validity_; }
+
+	/// Values for int64, date, datetime and time columns.
+	const std::pmr::vector<std::int64_t>& int64_values() const noexcept { return int64_values_; }
+
+	/// Values for uint64 columns.
+	const std::pmr::vector<std::uint64_t>& uint64_values() const noexcept { return uint64_values_; }
+
+	/// Values for double_ columns.
+	const std::pmr::vector<double>& double_values() const noexcept { return double_values_; }
+
+	/// Start offsets of the values in string_data(), plus a final end offset (string columns).
+	const std::pmr::vector<std::size_t>& string_offsets() const noexcept { return string_offsets_; }
+
+	/// The characters of all the values, one after the other (string columns).
+	const std::pmr::vector<char>& string_data() const noexcept { return string_data_; }
+
+	/// The i-th value of a string column (empty if NULL).
+	std::string_view string_value(std::size_t i) const noexcept
+	{
+		assert(kind_ == column_kind::string && i < size_);
+		return std::string_view(string_data_.data() + string_offsets_[i], string_offsets_[i + 1] - string_offsets_[i]);
+	}
+
+	// Private, do not use. Appends values (which must match kind()).
+	void append_null();
+	void append(std::int64_t v);
+	void append(std::uint64_t v);
+	void append(double v);
+	void append(std::string_view v);
+
+	// Private, do not use. Removes the values past the first new_size.
+	void truncate(std::size_t new_size);
+};
+
+/**
+ * \brief A set of rows stored column by column (struct of arrays).
+ * \details Returned by resultset::fetch_columnar. Values are decoded
+ * straight into a typed array per field, without going through
+ * mysql::value. This is more cache friendly than rows of values
+ * when processing a few fields of many rows (e.g. aggregations).
+ *
+ * The column_batch owns all its memory, including string values,
+ * so it may outlive the resultset that returned it. Memory is
+ * allocated from the resultset's memory resource (\see resultset::memory_resource),
+ * which must outlive the batch.
+ */
+class column_batch
+{
+	std::vector<column> columns_;
+	std::size_t num_rows_ {0};
+public:
+	/// Default constructor.
+	column_batch() = default;
+
+	// Private, do not use.
+	column_batch(
+		const std::pmr::vector<field_metadata>& fields,
+		std::pmr::memory_resource* resource = std::pmr::get_default_resource()
+	);
+
+	/// The number of rows in the batch.
+	std::size_t size() const noexcept { return num_rows_; }
+
+	/// Returns true if the batch contains no rows.
+	bool empty() const noexcept { return num_rows_ == 0; }
+
+	/// The number of columns (fields) in the batch.
+	std::size_t num_columns() const noexcept { return columns_.size(); }
+
+	/// Accesses the i-th column.
+	const column& operator[](std::size_t i) const noexcept { assert(i < columns_.size()); return columns_[i]; }
+
+	/// All the columns, in field order.
+	const std::vector<column>& columns() const noexcept { return columns_; }
+
+	// Private, do not use. Access to the columns, to append a row.
+	column& get_column(std::size_t i) noexcept { assert(i < columns_.size()); return columns_[i]; }
+
+	// Private, do not use. Commits a row appended to all columns.
+	void finish_row() noexcept { ++num_rows_; }
+
+	// Private, do not use. Removes the values of a partially appended row.
+	void discard_row();
+};
+
+} // mysql
+} // boost
+
+#include "boost/mysql/impl/column_batch.hpp"
+
+#endif /* INCLUDE_BOOST_MYSQL_COLUMN_BATCH_HPP_ */
@@ -0,0 +1,83 @@
+#ifndef INCLUDE_BOOST_MYSQL_COMPACT_ROW_HPP_
+#define INCLUDE_BOOST_MYSQL_COMPACT_ROW_HPP_
+
+#include "boost/mysql/compact_value.hpp"
+#include "boost/mysql/row.hpp"
+#include <cassert>
+#include <cstddef>
+#include <memory_resource>
+#include <utility>
+
+namespace boost {
+namespace mysql {
+
+/**
+ * \brief A row that takes as little memory as possible, for rows kept in memory for a long time.
+ * \details Constructed from any row (e.g. an owning_row returned by resultset::fetch_one),
+ * it stores its values as compact_value's and copies their strings, all in a single
+ * allocation. An owning_row with N values takes a vector of N 24 byte values plus
+ * a buffer with the whole row packet, in two allocations; a compact_row takes
+ * N 16 byte values plus the string bytes, in one.
+ *
+ * Compact rows are default constructible and movable, but not copyable.
+ * Moving a compact_row does not invalidate its string values. Memory is allocated
+ * from the memory resource passed on construction, which must outlive the row.
+ *
+ * Unlike rows fetched from a resultset, compact rows can't be indexed by field name.
+ */
+class compact_row
+{
+	std::pmr::memory_resource* resource_ {std::pmr::get_default_resource()};
+	compact_value* values_ {nullptr};
+	std::size_t size_ {0};
+	std::size_t allocated_size_ {0};
+
+	void deallocate() noexcept;
+public:
+	/// Default constructor: a row with no values.
+	compact_row() = default;
+
+	/// Constructs a compact_row with the same values as r, copying its strings.
+	explicit compact_row(
+		const row& r,
+		std::pmr::memory_resource* resource = std::pmr::get_default_resource()
+	);
+
+	compact_row(const compact_row&) = delete;
+	compact_row(compact_row&& other) noexcept:
+		resource_(other.resource_),
+		values_(std::exchange(other.values_, nullptr)),
+		size_(std::exchange(other.size_, 0)),
+		allocated_size_(std::exchange(other.allocated_size_, 0)) {}
+	compact_row& operator=(const compact_row&) = delete;
+	compact_row& operator=(compact_row&& rhs) noexcept;
+	~compact_row() { deallocate(); }
+
+	/// The number of values in the row.
+	std::size_t size() const noexcept { return size_; }
+
+	/// Returns true if the row has no values.
+	bool empty() const noexcept { return size_ == 0; }
+
+	/// Returns the i-th value. i must be less than size().
+	const compact_value& operator[](std::size_t i) const noexcept { assert(i < size_); return values_[i]; }
+
+	const compact_value* begin() const noexcept { return values_; }
+	const compact_value* end() const noexcept { return values_ + size_; }
+
+	/// Creates a (non-owning) row with the values converted to mysql::value, pointing into this row.
+	row to_row() const;
+
+	/// The memory resource the row was allocated from.
+	std::pmr::memory_resource* memory_resource() const noexcept { return resource_; }
+
+	/// The number of bytes allocated by the row (values plus strings).
+	std::size_t allocated_size() const noexcept { return allocated_size_; }
+};
+
+} // mysql
+} // boost
+
+#include "boost/mysql/impl/compact_row.hpp"
+
+#endif /* INCLUDE_BOOST_MYSQL_COMPACT_ROW_HPP_ */
@@ -0,0 +1,147 @@
+#ifndef INCLUDE_BOOST_MYSQL_COMPACT_VALUE_HPP_
+#define INCLUDE_BOOST_MYSQL_COMPACT_VALUE_HPP_
+
+#include "boost/mysql/value.hpp"
+#include "boost/mysql/detail/auxiliar/tmp.hpp"
+#include <cassert>
+#include <cstdint>
+#include <limits>
+#include <ostream>
+#include <string_view>
+#include <type_traits>
+#include <variant>
+
+namespace boost {
+namespace mysql {
+
+/**
+ * \brief A 16 byte representation of a mysql::value.
+ * \details Holds the same alternatives as mysql::value (which takes 24 bytes),
+ * as a tagged union: an 8 byte payload, plus the string length and the type tag
+ * packed in the remaining bytes. Conversions from and to mysql::value are cheap.
+ * Use it to keep big amounts of rows in memory (\see compact_row).
+ *
+ * Like mysql::value, strings point to externally owned memory.
+ * index() returns the index the equivalent mysql::value would have.
+ */
+class compact_value
+{
+	union
+	{
+		std::int64_t int_;      // int32_t, int64_t, date, datetime, time
+		std::uint64_t uint_;    // uint32_t, uint64_t
+		float float_;
+		double double_;
+		const char* str_;
+	} data_;
+	std::uint32_t str_size_ {0};
+	std::uint8_t index_;
+
+	template <typename T>
+	static constexpr std::size_t index_of() noexcept;
+public:
+	/// Constructs a NULL value.
+	compact_value() noexcept: index_(static_cast<std::uint8_t>(index_of<std::nullptr_t>())) { data_.uint_ = 0; }
+
+	/// Constructs a compact_value equivalent to v.
+	compact_value(const value& v) noexcept;
+
+	/// The index of the alternative held by the equivalent mysql::value.
+	std::size_t index() const noexcept { return index_; }
+
+	/// Returns true if the value is NULL.
+	bool is_null() const noexcept { return index_ == index_of<std::nullptr_t>(); }
+
+	/// Returns true if the equivalent mysql::value holds a T.
+	template <typename T>
+	bool is() const noexcept { return index_ == index_of<T>(); }
+
+	/// Returns the held T. is<T>() must be true.
+	template <typename T>
+	T get() const noexcept;
+
+	/// Converts it to a mysql::value.
+	value to_value() const noexcept;
+};
+
+static_assert(sizeof(compact_value) == 16);
+
+/// Tests for equality (type and value).
+inline bool operator==(const compact_value& lhs, const compact_value& rhs) { return lhs.to_value() == rhs.to_value(); }
+
+/// Tests for inequality (type and value).
+inline bool operator!=(const compact_value& lhs, const compact_value& rhs) { return !(lhs == rhs); }
+
+/// Streams a compact_value, as the equivalent mysql::value would be.
+inline std::ostream& operator<<(std::ostream& os, const compact_value& v) { return os << v.to_value(); }
+
+} // mysql
+} // boost
+
+template <typename T>
+constexpr std::size_t boost::mysql::compact_value::index_of() noexcept
+{
+	return detail::variant_index<T, value>::value;
+}
+
+inline boost::mysql::compact_value::compact_value(
+	const value& v
+) noexcept :
+	index_(static_cast<std::uint8_t>(v.index()))
+{
+	data_.uint_ = 0;
+	std::visit([this](const auto& alt) {
+		using T = std::decay_t<decltype(alt)>;
+		if constexpr (detail::is_one_of_v<T, std::int32_t, std::int64_t>) data_.int_ = alt;
+		else if constexpr (detail::is_one_of_v<T, std::uint32_t, std::uint64_t>) data_.uint_ = alt;
+		else if constexpr (std::is_same_v<T, float>) data_.float_ = alt;
+		else if constexpr (std::is_same_v<T, double>) data_.double_ = alt;
+		else if constexpr (detail::is_one_of_v<T, date, datetime>) data_.int_ = alt.time_since_epoch().count();
+		else if constexpr (std::is_same_v<T, time>) data_.int_ = alt.count();
+		else if constexpr (std::is_same_v<T, std::string_view>)
+		{
+			// MySQL strings (even LONGBLOBs) are shorter than 4GB
+			assert(alt.size() <= std::numeric_limits<std::uint32_t>::max());
+			data_.str_ = alt.data();
+			str_size_ = static_cast<std::uint32_t>(alt.size());
+		}
+	}, v);
+}
+
+template <typename T>
+T boost::mysql::compact_value::get() const noexcept
+{
+	assert(is<T>());
+	if constexpr (detail::is_one_of_v<T, std::int32_t, std::int64_t>) return static_cast<T>(data_.int_);
+	else if constexpr (detail::is_one_of_v<T, std::uint32_t, std::uint64_t>) return static_cast<T>(data_.uint_);
+	else if constexpr (std::is_same_v<T, float>) return data_.float_;
+	else if constexpr (std::is_same_v<T, double>) return data_.double_;
+	else if constexpr (detail::is_one_of_v<T, date, datetime>) return T(typename T::duration(data_.int_));
+	else if constexpr (std::is_same_v<T, time>) return T(data_.int_);
+	else if constexpr (std::is_same_v<T, std::string_view>) return std::string_view(data_.str_, str_size_);
+	else
+	{
+		static_assert(std::is_same_v<T, std::nullptr_t>, "T is not one of mysql::value's alternatives");
+		return nullptr;
+	}
+}
+
+inline boost::mysql::value boost::mysql::compact_value::to_value() const noexcept
+{
+	switch (index_)
+	{
+	case index_of<std::int32_t>(): return get<std::int32_t>();
+	case index_of<std::int64_t>(): return get<std::int64_t>();
+	case index_of<std::uint32_t>(): return get<std::uint32_t>();
+	case index_of<std::uint64_t>(): return get<std::uint64_t>();
+	case index_of<std::string_view>(): return get<std::string_view>();
+	case index_of<float>(): return get<float>();
+	case index_of<double>(): return get<double>();
+	case index_of<date>(): return get<date>();
+	case index_of<datetime>(): return get<datetime>();
+	case index_of<time>(): return get<time>();
+	default: assert(is_null()); return nullptr;
+	}
+}
+
+#endif /* INCLUDE_BOOST_MYSQL_COMPACT_VALUE_HPP_ */
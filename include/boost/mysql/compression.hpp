@@ -0,0 +1,32 @@
+#ifndef INCLUDE_BOOST_MYSQL_COMPRESSION_HPP_
+#define INCLUDE_BOOST_MYSQL_COMPRESSION_HPP_
+
+#include <cstddef>
+
+namespace boost {
+namespace mysql {
+
+/**
+ * \brief Compression algorithm to use for a connection.
+ * \details Compression is negotiated during the handshake (\see connection_params).
+ * If the server does not support the requested algorithm, the connection
+ * is established without compression.
+ *
+ * zlib is always available. zstd requires MySQL 8.0.18 or later, and
+ * the library to be built with BOOST_MYSQL_HAS_ZSTD defined (and linked
+ * against libzstd). Otherwise, requesting zstd results in an uncompressed connection.
+ */
+enum class compression_algorithm
+{
+	none, ///< Do not use compression.
+	zlib, ///< Compress using zlib (CLIENT_COMPRESS).
+	zstd  ///< Compress using zstd (CLIENT_ZSTD_COMPRESSION_ALGORITHM).
+};
+
+/// Messages smaller than this (in bytes) are sent uncompressed by default.
+constexpr std::size_t default_compression_threshold = 50;
+
+} // mysql
+} // boost
+
+#endif /* INCLUDE_BOOST_MYSQL_COMPRESSION_HPP_ */
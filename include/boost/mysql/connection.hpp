@@ -5,9 +5,17 @@
 #include "boost/mysql/detail/network_algorithms/handshake.hpp"
 #include "boost/mysql/detail/protocol/protocol_types.hpp"
 #include "boost/mysql/error.hpp"
+#include "boost/mysql/compression.hpp"
+#include "boost/mysql/connection_stats.hpp"
+#include "boost/mysql/connection_observer.hpp"
+#include "boost/mysql/ssl.hpp"
 #include "boost/mysql/resultset.hpp"
 #include "boost/mysql/prepared_statement.hpp"
+#include "boost/mysql/pipeline.hpp"
 #include <boost/asio/ip/tcp.hpp>
+#include <boost/asio/local/stream_protocol.hpp>
+#include <boost/asio/ssl/stream.hpp>
+#include <memory_resource>
 
 namespace boost {
 namespace mysql {
@@ -22,6 +30,26 @@ struct connection_params
 	std::string_view database; ///< Database to use, or empty string for no database.
 	collation connection_collation; ///< The default character set and collation for the connection.
 
+	/**
+	 * \brief Compression algorithm to use, if supported by the server.
+	 * \details Compression reduces network usage at the cost of CPU,
+	 * which pays off for big, compressible resultsets over slow links.
+	 */
+	compression_algorithm compression {compression_algorithm::none};
+
+	/// When using compression, messages smaller than this are sent uncompressed.
+	std::size_t compression_threshold {default_compression_threshold};
+
+	/// Whether to use TLS. Only relevant if the connection's Stream is an SSL stream.
+	ssl_mode ssl {ssl_mode::enable};
+
+	/**
+	 * \brief Where to store TLS sessions to be resumed by later connections, or nullptr.
+	 * \details Resuming a session saves most of the cost of the TLS handshake.
+	 * Should be shared only between connections to the same server, and outlive the handshake.
+	 */
+	ssl_session_cache* ssl_sessions {nullptr};
+
 	/// Initializing constructor
 	connection_params(
 		std::string_view username,
@@ -52,12 +80,30 @@ struct connection_params
  *     to connecting the socket.
  *   - MySQL handshake: authenticates the connection to the MySQL server. You can do that
  *     by calling connection::handshake() or connection::async_handshake().
+ *     For SSL streams, this also upgrades the connection to TLS (\see connection_params::ssl),
+ *     so you should not perform the TLS handshake yourself.
  *
  * Because of how the MySQL protocol works, you must fully perform an operation before
  * starting the next one. For queries, you must wait for the query response and
  * **read the entire resultset** before starting a new query. For prepared statements,
  * once executed, you must wait for the response and read the entire resultset.
  * Otherwise, results are undefined.
+ *
+ * Asynchronous operations allocate their intermediate state using the
+ * allocator associated to the completion handler. If the handler has none,
+ * a recycling allocator owned by the connection is used, so that steady-state
+ * operations do not allocate. Combined with a pooling memory resource
+ * (\see connection::set_memory_resource), these perform no heap allocations
+ * once warmed up: async queries returning no rows, and async executions of
+ * prepared statements whose field definitions match the ones sent at prepare time,
+ * followed by async fetches of their rows. Text queries returning rows
+ * still allocate their field metadata from the global heap.
+ *
+ * This holds only if the stream's executor doesn't allocate itself. The default
+ * type-erased executor (boost::asio::any_io_executor, used by e.g.
+ * boost::asio::ip::tcp::socket) allocates when dispatching completions. Use
+ * a stream with a concrete executor type, like
+ * boost::asio::basic_stream_socket<boost::asio::ip::tcp, boost::asio::io_context::executor_type>.
  */
 template <
 	typename Stream ///< The underlying stream to use; must satisfy Boost.Asio's SyncStream and AsyncStream concepts.
@@ -86,6 +132,74 @@ public:
 	/// Retrieves the underlying Stream object.
 	const Stream& next_layer() const { return next_layer_; }
 
+	/// Returns true if the connection has been upgraded to TLS during the handshake.
+	bool uses_ssl() const noexcept { return channel_.ssl_active(); }
+
+	/**
+	 * \brief Returns true if the server may omit resultset metadata.
+	 * \details That is, if client and server agreed on CLIENT_OPTIONAL_RESULTSET_METADATA
+	 * during the handshake. If so, running SET resultset_metadata = 'NONE' saves
+	 * sending the field definitions for each execution of the prepared statements
+	 * created before it. See prepared_statement for more info.
+	 */
+	bool supports_optional_metadata() const noexcept
+	{
+		return channel_.current_capabilities().has(detail::CLIENT_OPTIONAL_RESULTSET_METADATA);
+	}
+
+	/// The memory resource resultsets created by this connection allocate their metadata and rows from.
+	std::pmr::memory_resource* memory_resource() const noexcept { return channel_.memory_resource(); }
+
+	/**
+	 * \brief Sets the memory resource to use for resultsets created from now on.
+	 * \details Affects resultsets returned by connection::query,
+	 * prepared_statement::execute and pipeline::execute, their metadata,
+	 * and the rows fetched from them. The resource must outlive all of these.
+	 * For instance, you may use a std::pmr::monotonic_buffer_resource
+	 * per request, releasing all of its memory at once when done.
+	 * Defaults to std::pmr::get_default_resource().
+	 */
+	void set_memory_resource(std::pmr::memory_resource* resource) noexcept { channel_.set_memory_resource(resource); }
+
+	/**
+	 * \brief Returns I/O statistics about this connection.
+	 * \details Counters are always on and cheap to maintain. They
+	 * can help to find code paths performing too many round-trips
+	 * or oversized buffers.
+	 */
+	connection_stats stats() const noexcept { return channel_.stats(); }
+
+	/// The observer receiving lifecycle events for this connection's operations, or nullptr.
+	connection_observer* observer() const noexcept { return channel_.observer(); }
+
+	/**
+	 * \brief Sets an observer to receive lifecycle events for this connection's operations.
+	 * \details Pass nullptr to stop receiving events. The observer must outlive
+	 * the connection, or be reset before being destroyed. Without an observer
+	 * (the default), tracing costs a single branch per event.
+	 * \see connection_observer for more details.
+	 */
+	void set_observer(connection_observer* value) noexcept { channel_.set_observer(value); }
+
+#ifdef BOOST_MYSQL_ENABLE_LATENCY_HISTOGRAMS
+
+	/**
+	 * \brief Returns latency histograms for the network algorithms run on this connection.
+	 * \details Only available when the library is built with
+	 * BOOST_MYSQL_ENABLE_LATENCY_HISTOGRAMS defined (CMake option
+	 * MYSQL_ASIO_LATENCY_HISTOGRAMS). Each operation records the time spent
+	 * waiting on the stream separately from the time spent processing
+	 * messages, which tells apart slow networks or servers from client-side overhead.
+	 * Measuring costs a couple of clock reads per stream operation.
+	 * Without the macro, measuring code compiles to nothing.
+	 */
+	const latency_histograms& latency() const noexcept { return channel_.latency().histograms(); }
+
+	/// Removes all values recorded in the latency histograms.
+	void reset_latency() noexcept { channel_.latency().histograms().reset(); }
+
+#endif
+
 	/// Performs the MySQL-level handshake (synchronous with error code version).
 	void handshake(const connection_params& params, error_code& ec, error_info& info);
 
@@ -154,12 +268,30 @@ public:
 	template <typename CompletionToken>
 	BOOST_ASIO_INITFN_RESULT_TYPE(CompletionToken, prepare_statement_signature)
 	async_prepare_statement(std::string_view statement, CompletionToken&& token, error_info* info=nullptr);
+
+	/**
+	 * \brief Creates an empty pipeline, to send several requests in a single write.
+	 * \details See pipeline for more info. The pipeline must not outlive the connection.
+	 */
+	pipeline<Stream> make_pipeline() { return pipeline<Stream>(channel_); }
 };
 
 /// A connection to MySQL over TCP.
 using tcp_connection = connection<boost::asio::ip::tcp::socket>;
 
-// TODO: UNIX socket connection
+/// A connection to MySQL over TCP, able to use TLS (\see connection_params::ssl).
+using tcp_ssl_connection = connection<boost::asio::ssl::stream<boost::asio::ip::tcp::socket>>;
+
+#ifdef BOOST_ASIO_HAS_LOCAL_SOCKETS
+
+/**
+ * \brief A connection to MySQL over a UNIX socket.
+ * \details Connect next_layer() to the server's socket file (e.g. /var/run/mysqld/mysqld.sock).
+ * When the client and the server run on the same host, this avoids the overhead of the TCP stack.
+ */
+using local_connection = connection<boost::asio::local::stream_protocol::socket>;
+
+#endif
 
 /// The default TCP port for the MySQL protocol.
 constexpr unsigned short default_port = 3306;
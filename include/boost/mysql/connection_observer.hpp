@@ -0,0 +1,94 @@
+#ifndef INCLUDE_BOOST_MYSQL_CONNECTION_OBSERVER_HPP_
+#define INCLUDE_BOOST_MYSQL_CONNECTION_OBSERVER_HPP_
+
+#include "boost/mysql/error.hpp"
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+namespace boost {
+namespace mysql {
+
+/// The operations reported to a connection_observer.
+enum class traced_operation
+{
+	query,             ///< connection::query and pipelined queries.
+	prepare_statement, ///< connection::prepare_statement.
+	execute_statement, ///< prepared_statement::execute and pipelined executions.
+	close_statement    ///< prepared_statement::close.
+};
+
+/// Data common to all the events reported to a connection_observer.
+struct trace_event
+{
+	/// The operation the event belongs to: the last one started on the connection.
+	traced_operation operation {traced_operation::query};
+
+	/// The statement ID for execute_statement and close_statement, zero otherwise.
+	std::uint32_t statement_id {0};
+
+	/// When the event happened.
+	std::chrono::steady_clock::time_point time;
+
+	/// Bytes read from the stream since the connection was created (\see connection_stats).
+	std::uint64_t bytes_read {0};
+
+	/// Bytes written to the stream since the connection was created (\see connection_stats).
+	std::uint64_t bytes_written {0};
+};
+
+/**
+ * \brief Receives events about the lifecycle of the operations run on a connection.
+ * \details Set one with connection::set_observer. Derive from this class
+ * and override the callbacks you are interested in; the default ones do nothing.
+ * You may use them to build trace spans or slow query logs.
+ *
+ * For a query or statement execution, callbacks are invoked in this order:
+ * on_query_start, on_first_byte, on_metadata_complete (only if the
+ * resultset has fields), on_row_batch (once per fetch call returning
+ * rows) and on_resultset_complete. on_error may end the sequence at any point.
+ *
+ * As operations on a connection are not concurrent, every event belongs to
+ * the last operation for which on_query_start was invoked. The exception are
+ * pipelines: on_query_start is invoked for all their requests when they are
+ * written, and the rest of events for a request while its response is read.
+ * trace_event::operation and statement_id identify the request in both cases. Byte counts
+ * are cumulative, so subtracting the ones in on_query_start yields the bytes
+ * transferred by an operation. Callbacks are invoked synchronously,
+ * from within the library's network algorithms, so they should be cheap.
+ * They must not throw nor initiate operations on the connection.
+ */
+class connection_observer
+{
+public:
+	virtual ~connection_observer() = default;
+
+	/**
+	 * \brief An operation is about to send its request.
+	 * \details sql is the query text for queries (including pipelined ones) and
+	 * statement preparations. It is empty for statement executions and closes.
+	 * It is only valid during the call.
+	 */
+	virtual void on_query_start(const trace_event&, std::string_view /*sql*/) {}
+
+	/// The first packet of the response has been received.
+	virtual void on_first_byte(const trace_event&) {}
+
+	/// All the field definitions have been received (prepared statements: the params and fields).
+	virtual void on_metadata_complete(const trace_event&, std::size_t /*num_fields*/) {}
+
+	/// A fetch call on the resultset has read num_rows rows (more than zero).
+	virtual void on_row_batch(const trace_event&, std::size_t /*num_rows*/) {}
+
+	/// The resultset has been completely read.
+	virtual void on_resultset_complete(const trace_event&, std::uint64_t /*affected_rows*/) {}
+
+	/// The operation failed. info may be empty.
+	virtual void on_error(const trace_event&, const error_code&, const error_info&) {}
+};
+
+} // mysql
+} // boost
+
+#endif /* INCLUDE_BOOST_MYSQL_CONNECTION_OBSERVER_HPP_ */
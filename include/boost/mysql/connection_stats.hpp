@@ -0,0 +1,38 @@
+#ifndef INCLUDE_BOOST_MYSQL_CONNECTION_STATS_HPP_
+#define INCLUDE_BOOST_MYSQL_CONNECTION_STATS_HPP_
+
+#include <cstddef>
+#include <cstdint>
+
+namespace boost {
+namespace mysql {
+
+/**
+ * \brief I/O statistics about a connection (\see connection::stats).
+ * \details Counters are cumulative since the connection was created.
+ * Byte counts are measured where the library talks to the stream:
+ * they include packet headers and compression framing, and are measured
+ * before encryption for SSL connections.
+ *
+ * A packet is a protocol message. Packets of 16MB or more are split
+ * in several frames; these are counted once, in packets_read or packets_written,
+ * and also in multiframe_packets_read or multiframe_packets_written.
+ */
+struct connection_stats
+{
+	std::uint64_t packets_read {0};               ///< Packets received from the server.
+	std::uint64_t packets_written {0};            ///< Packets sent to the server.
+	std::uint64_t bytes_read {0};                 ///< Bytes read from the stream.
+	std::uint64_t bytes_written {0};              ///< Bytes written to the stream.
+	std::uint64_t read_calls {0};                 ///< Read operations issued to the stream.
+	std::uint64_t multiframe_packets_read {0};    ///< Received packets spanning more than one frame.
+	std::uint64_t multiframe_packets_written {0}; ///< Sent packets spanning more than one frame.
+	std::uint64_t buffer_reallocations {0};       ///< Times a buffer had to grow to hold a received packet.
+	std::size_t read_buffer_capacity {0};         ///< Current size of the read-ahead buffer.
+	std::size_t shared_buffer_capacity {0};       ///< Current capacity of the buffer for requests and responses.
+};
+
+} // mysql
+} // boost
+
+#endif /* INCLUDE_BOOST_MYSQL_CONNECTION_STATS_HPP_ */
@@ -1,6 +1,8 @@
 #ifndef INCLUDE_BOOST_MYSQL_DETAIL_AUXILIAR_BYTESTRING_HPP_
 #define INCLUDE_BOOST_MYSQL_DETAIL_AUXILIAR_BYTESTRING_HPP_
 
+#include "boost/mysql/detail/auxiliar/resource_allocator.hpp"
+#include <cstdint>
 #include <vector>
 
 namespace boost {
@@ -12,6 +14,9 @@ using basic_bytestring = std::vector<std::uint8_t, Allocator>;
 
 using bytestring = std::vector<std::uint8_t>;
 
+// For buffers allocated from a user-supplied std::pmr::memory_resource
+using resource_bytestring = basic_bytestring<resource_allocator<std::uint8_t>>;
+
 }
 }
 }
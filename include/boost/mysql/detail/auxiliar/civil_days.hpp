@@ -0,0 +1,46 @@
+#ifndef INCLUDE_BOOST_MYSQL_DETAIL_AUXILIAR_CIVIL_DAYS_HPP_
+#define INCLUDE_BOOST_MYSQL_DETAIL_AUXILIAR_CIVIL_DAYS_HPP_
+
+#include <cstdint>
+
+namespace boost {
+namespace mysql {
+namespace detail {
+
+// Calendar arithmetic on the proleptic Gregorian calendar, without
+// going through date::year_month_day. Algorithms from
+// http://howardhinnant.github.io/date_algorithms.html
+
+constexpr bool is_leap_year(std::uint16_t year) noexcept
+{
+	return year % 4 == 0 && (year % 100 != 0 || year % 400 == 0);
+}
+
+constexpr unsigned last_month_day(std::uint16_t year, unsigned month) noexcept
+{
+	constexpr unsigned char last_days [] = { 31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31 };
+	return month == 2 && is_leap_year(year) ? 29 : last_days[month - 1];
+}
+
+// Whether year/month/day is a valid date (zero months or days are not)
+constexpr bool is_valid_date(std::uint16_t year, unsigned month, unsigned day) noexcept
+{
+	return month >= 1 && month <= 12 && day >= 1 && day <= last_month_day(year, month);
+}
+
+// Days since 1970-01-01 (negative before it). The date must be valid
+constexpr std::int32_t days_from_civil(std::uint16_t year, unsigned month, unsigned day) noexcept
+{
+	std::int32_t y = static_cast<std::int32_t>(year) - (month <= 2);
+	std::int32_t era = (y >= 0 ? y : y - 399) / 400;
+	unsigned yoe = static_cast<unsigned>(y - era * 400);                   // [0, 399]
+	unsigned doy = (153 * (month > 2 ? month - 3 : month + 9) + 2) / 5 + day - 1; // [0, 365]
+	unsigned doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;                 // [0, 146096]
+	return era * 146097 + static_cast<std::int32_t>(doe) - 719468;
+}
+
+} // detail
+} // mysql
+} // boost
+
+#endif /* INCLUDE_BOOST_MYSQL_DETAIL_AUXILIAR_CIVIL_DAYS_HPP_ */
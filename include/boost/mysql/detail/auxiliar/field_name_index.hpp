@@ -0,0 +1,109 @@
+#ifndef INCLUDE_BOOST_MYSQL_DETAIL_AUXILIAR_FIELD_NAME_INDEX_HPP_
+#define INCLUDE_BOOST_MYSQL_DETAIL_AUXILIAR_FIELD_NAME_INDEX_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory_resource>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace boost {
+namespace mysql {
+namespace detail {
+
+// Maps field names to their position within a resultset in constant time.
+// Names are copied, so the index may outlive the metadata it was built from.
+// Names are compared case-sensitively. If several fields share a name,
+// the first one is found.
+class field_name_index
+{
+	// Open addressing hash table, with linear probing
+	struct slot
+	{
+		std::uint32_t name_offset; // within names_
+		std::uint32_t name_size;
+		std::uint32_t position_plus_one; // zero means empty
+	};
+
+	std::pmr::string names_; // all names, one after another
+	std::pmr::vector<slot> slots_; // size is a power of two, at least twice the number of fields
+
+	std::string_view slot_name(const slot& s) const noexcept
+	{
+		return std::string_view(names_.data() + s.name_offset, s.name_size);
+	}
+
+	std::size_t first_slot(std::string_view name) const noexcept
+	{
+		return std::hash<std::string_view>()(name) & (slots_.size() - 1);
+	}
+
+	void insert(std::string_view name, std::uint32_t name_offset, std::size_t position)
+	{
+		std::size_t i = first_slot(name);
+		for (; slots_[i].position_plus_one != 0; i = (i + 1) & (slots_.size() - 1))
+		{
+			if (slot_name(slots_[i]) == name) return; // keep the first one
+		}
+		slots_[i] = slot {
+			name_offset,
+			static_cast<std::uint32_t>(name.size()),
+			static_cast<std::uint32_t>(position + 1)
+		};
+	}
+public:
+	static constexpr std::size_t npos = static_cast<std::size_t>(-1);
+
+	// FieldIterator should point to field_metadata's
+	template <typename FieldIterator>
+	field_name_index(
+		FieldIterator first,
+		FieldIterator last,
+		std::pmr::memory_resource* resource = std::pmr::get_default_resource()
+	):
+		names_(resource), slots_(resource)
+	{
+		std::size_t num_fields = 0;
+		std::size_t names_size = 0;
+		for (auto it = first; it != last; ++it, ++num_fields)
+		{
+			names_size += it->field_name().size();
+		}
+		std::size_t num_slots = 2;
+		while (num_slots < 2 * num_fields) num_slots *= 2;
+		slots_.resize(num_slots, slot{0, 0, 0});
+
+		// Append all names before inserting, so views into names_ remain valid
+		names_.reserve(names_size);
+		for (auto it = first; it != last; ++it)
+		{
+			names_.append(it->field_name());
+		}
+		std::uint32_t offset = 0;
+		std::size_t position = 0;
+		for (auto it = first; it != last; ++it, ++position)
+		{
+			auto size = static_cast<std::uint32_t>(it->field_name().size());
+			insert(std::string_view(names_.data() + offset, size), offset, position);
+			offset += size;
+		}
+	}
+
+	// Returns the position of the first field called name, or npos if there is none
+	std::size_t find(std::string_view name) const noexcept
+	{
+		for (std::size_t i = first_slot(name); slots_[i].position_plus_one != 0; i = (i + 1) & (slots_.size() - 1))
+		{
+			if (slot_name(slots_[i]) == name) return slots_[i].position_plus_one - 1;
+		}
+		return npos;
+	}
+};
+
+} // detail
+} // mysql
+} // boost
+
+#endif /* INCLUDE_BOOST_MYSQL_DETAIL_AUXILIAR_FIELD_NAME_INDEX_HPP_ */
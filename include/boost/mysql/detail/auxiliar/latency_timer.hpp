@@ -0,0 +1,102 @@
+#ifndef INCLUDE_BOOST_MYSQL_DETAIL_AUXILIAR_LATENCY_TIMER_HPP_
+#define INCLUDE_BOOST_MYSQL_DETAIL_AUXILIAR_LATENCY_TIMER_HPP_
+
+#include "boost/mysql/latency_histogram.hpp"
+
+#ifdef BOOST_MYSQL_ENABLE_LATENCY_HISTOGRAMS
+#include <chrono>
+#endif
+
+namespace boost {
+namespace mysql {
+namespace detail {
+
+#ifdef BOOST_MYSQL_ENABLE_LATENCY_HISTOGRAMS
+
+// Owned by each channel. Accumulates the time spent waiting on the stream,
+// bracketed by io_begin() and io_end(), and holds the histograms network
+// algorithms record into. As operations on a channel are not concurrent,
+// a single accumulator is enough.
+class latency_tracker
+{
+public:
+	using clock = std::chrono::steady_clock;
+
+	void io_begin() noexcept { io_start_ = clock::now(); }
+	void io_end() noexcept { io_time_ += clock::now() - io_start_; }
+	clock::duration io_time() const noexcept { return io_time_; }
+
+	latency_histograms& histograms() noexcept { return histograms_; }
+	const latency_histograms& histograms() const noexcept { return histograms_; }
+private:
+	latency_histograms histograms_;
+	clock::time_point io_start_;
+	clock::duration io_time_ {};
+};
+
+// Measures a network algorithm, from construction to finish(). Stream time
+// accumulated by the tracker in between is recorded as network latency,
+// and the rest as processing latency. Copyable, so it can live in async ops.
+class latency_timer
+{
+	latency_tracker* tracker_;
+	latency_operation op_;
+	latency_tracker::clock::time_point start_;
+	latency_tracker::clock::duration io_start_;
+public:
+	latency_timer(latency_tracker& tracker, latency_operation op) noexcept:
+		tracker_(&tracker),
+		op_(op),
+		start_(latency_tracker::clock::now()),
+		io_start_(tracker.io_time())
+	{
+	}
+
+	// Records the measured values. Subsequent calls have no effect.
+	void finish() noexcept
+	{
+		if (!tracker_) return;
+		auto total = latency_tracker::clock::now() - start_;
+		auto network = tracker_->io_time() - io_start_;
+		auto& hist = tracker_->histograms()[op_];
+		hist.network.record(std::chrono::duration_cast<latency_histogram::duration>(network));
+		hist.processing.record(std::chrono::duration_cast<latency_histogram::duration>(total - network));
+		tracker_ = nullptr;
+	}
+};
+
+#else
+
+// Latency histograms disabled: these compile to nothing
+class latency_tracker
+{
+public:
+	void io_begin() noexcept {}
+	void io_end() noexcept {}
+};
+
+class latency_timer
+{
+public:
+	latency_timer(latency_tracker&, latency_operation) noexcept {}
+	void finish() noexcept {}
+};
+
+#endif
+
+// Measures the enclosing scope. For sync network algorithms.
+class latency_scope
+{
+	latency_timer timer_;
+public:
+	latency_scope(latency_tracker& tracker, latency_operation op) noexcept: timer_(tracker, op) {}
+	latency_scope(const latency_scope&) = delete;
+	latency_scope& operator=(const latency_scope&) = delete;
+	~latency_scope() { timer_.finish(); }
+};
+
+} // detail
+} // mysql
+} // boost
+
+#endif /* INCLUDE_BOOST_MYSQL_DETAIL_AUXILIAR_LATENCY_TIMER_HPP_ */
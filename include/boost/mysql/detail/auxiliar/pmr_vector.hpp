@@ -0,0 +1,42 @@
+#ifndef INCLUDE_BOOST_MYSQL_DETAIL_AUXILIAR_PMR_VECTOR_HPP_
+#define INCLUDE_BOOST_MYSQL_DETAIL_AUXILIAR_PMR_VECTOR_HPP_
+
+#include <memory_resource>
+#include <utility>
+#include <vector>
+
+namespace boost {
+namespace mysql {
+namespace detail {
+
+// A std::pmr::vector returned by accessors that used to return a std::vector,
+// like row::values() or resultset::fields(). Converts to std::vector, so code
+// binding the result to a const std::vector& keeps compiling. The conversion
+// copies (or, for rvalues, moves) the elements, so it is deprecated.
+template <typename T>
+class pmr_vector : public std::pmr::vector<T>
+{
+	using base_type = std::pmr::vector<T>;
+public:
+	using base_type::base_type;
+	using base_type::operator=;
+
+	pmr_vector() = default;
+	pmr_vector(base_type&& other) noexcept: base_type(std::move(other)) {}
+	pmr_vector(const base_type& other): base_type(other) {}
+
+	[[deprecated("this now returns a std::pmr::vector: bind it to a std::pmr::vector or auto")]]
+	operator std::vector<T>() const& { return std::vector<T>(this->begin(), this->end()); }
+
+	[[deprecated("this now returns a std::pmr::vector: bind it to a std::pmr::vector or auto")]]
+	operator std::vector<T>() &&
+	{
+		return std::vector<T>(std::make_move_iterator(this->begin()), std::make_move_iterator(this->end()));
+	}
+};
+
+} // detail
+} // mysql
+} // boost
+
+#endif /* INCLUDE_BOOST_MYSQL_DETAIL_AUXILIAR_PMR_VECTOR_HPP_ */
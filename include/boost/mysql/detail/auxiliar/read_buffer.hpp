@@ -0,0 +1,96 @@
+#ifndef INCLUDE_BOOST_MYSQL_DETAIL_AUXILIAR_READ_BUFFER_HPP_
+#define INCLUDE_BOOST_MYSQL_DETAIL_AUXILIAR_READ_BUFFER_HPP_
+
+#include "boost/mysql/detail/auxiliar/bytestring.hpp"
+#include <boost/asio/buffer.hpp>
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <cstring>
+
+namespace boost {
+namespace mysql {
+namespace detail {
+
+// Default size for the read-ahead buffer in channel
+constexpr std::size_t default_read_buffer_size = 64 * 1024;
+
+// A fixed-capacity buffer holding bytes read from the network
+// that have not been consumed yet. Layout:
+//   [0, first_): consumed bytes, may be reclaimed
+//   [first_, last_): pending bytes, read but not consumed yet
+//   [last_, size()): free space, where the next read should place its data
+class read_buffer
+{
+	bytestring buffer_;
+	std::size_t first_ {0};
+	std::size_t last_ {0};
+public:
+	read_buffer(std::size_t size = default_read_buffer_size): buffer_(size) { assert(size > 0); }
+
+	std::size_t capacity() const noexcept { return buffer_.size(); }
+
+	const std::uint8_t* pending_first() const noexcept { return buffer_.data() + first_; }
+	std::size_t pending_size() const noexcept { return last_ - first_; }
+	boost::asio::const_buffer pending() const noexcept
+	{
+		return boost::asio::buffer(pending_first(), pending_size());
+	}
+
+	std::size_t free_size() const noexcept { return buffer_.size() - last_; }
+	boost::asio::mutable_buffer free_area() noexcept
+	{
+		return boost::asio::buffer(buffer_.data() + last_, free_size());
+	}
+
+	// Marks size bytes of the free area as pending (i.e. they have been read into)
+	void commit(std::size_t size) noexcept
+	{
+		assert(size <= free_size());
+		last_ += size;
+	}
+
+	// Marks size pending bytes as consumed
+	void consume(std::size_t size) noexcept
+	{
+		assert(size <= pending_size());
+		first_ += size;
+		if (first_ == last_) // everything consumed: reclaim the whole buffer
+		{
+			first_ = last_ = 0;
+		}
+	}
+
+	// Copies at most size pending bytes to to, and consumes them.
+	// Returns the number of bytes copied.
+	std::size_t consume_into(void* to, std::size_t size) noexcept
+	{
+		std::size_t res = std::min(size, pending_size());
+		if (res)
+		{
+			std::memcpy(to, pending_first(), res);
+			consume(res);
+		}
+		return res;
+	}
+
+	// Moves pending bytes to the beginning of the buffer, making the free
+	// area as big as possible. Call before reading into free_area().
+	void relocate() noexcept
+	{
+		if (first_ != 0)
+		{
+			std::memmove(buffer_.data(), buffer_.data() + first_, pending_size());
+			last_ -= first_;
+			first_ = 0;
+		}
+	}
+};
+
+} // detail
+} // mysql
+} // boost
+
+
+
+#endif /* INCLUDE_BOOST_MYSQL_DETAIL_AUXILIAR_READ_BUFFER_HPP_ */
@@ -0,0 +1,147 @@
+#ifndef INCLUDE_BOOST_MYSQL_DETAIL_AUXILIAR_RECYCLING_ALLOCATOR_HPP_
+#define INCLUDE_BOOST_MYSQL_DETAIL_AUXILIAR_RECYCLING_ALLOCATOR_HPP_
+
+#include <boost/asio/associated_allocator.hpp>
+#include <array>
+#include <cstddef>
+#include <limits>
+#include <memory>
+#include <new>
+#include <utility>
+
+namespace boost {
+namespace mysql {
+namespace detail {
+
+// Keeps a few blocks of memory that have been deallocated, so subsequent allocations
+// can reuse them instead of going to the heap. Each connection owns one of these,
+// and uses it to allocate the state of its composed async operations. As operations
+// on a connection are not concurrent and have similar sizes, a small cache
+// means that steady-state operations do not allocate. Not thread-safe.
+class recycling_memory
+{
+	// Each block is prefixed with a header holding its usable size
+	static constexpr std::size_t header_size = alignof(std::max_align_t) < sizeof(std::size_t) ?
+			sizeof(std::size_t) : alignof(std::max_align_t);
+	static constexpr std::size_t max_cached_blocks = 8;
+
+	std::array<void*, max_cached_blocks> cache_ {}; // null if the slot is empty
+
+	static std::size_t& block_size(void* block) noexcept { return *static_cast<std::size_t*>(block); }
+	static void* user_memory(void* block) noexcept { return static_cast<unsigned char*>(block) + header_size; }
+	static void* block_from_user_memory(void* p) noexcept { return static_cast<unsigned char*>(p) - header_size; }
+public:
+	recycling_memory() = default;
+	recycling_memory(const recycling_memory&) = delete;
+	recycling_memory(recycling_memory&&) = delete;
+	recycling_memory& operator=(const recycling_memory&) = delete;
+	recycling_memory& operator=(recycling_memory&&) = delete;
+	~recycling_memory()
+	{
+		for (void* block: cache_)
+		{
+			::operator delete(block);
+		}
+	}
+
+	void* allocate(std::size_t size)
+	{
+		// Use the smallest cached block that is big enough
+		void** best = nullptr;
+		for (void*& block: cache_)
+		{
+			if (block && block_size(block) >= size && (!best || block_size(block) < block_size(*best)))
+			{
+				best = &block;
+			}
+		}
+		if (best)
+		{
+			void* res = user_memory(*best);
+			*best = nullptr;
+			return res;
+		}
+		if (size > std::numeric_limits<std::size_t>::max() - header_size)
+		{
+			throw std::bad_alloc();
+		}
+		void* block = ::operator new(size + header_size);
+		block_size(block) = size;
+		return user_memory(block);
+	}
+
+	void deallocate(void* p) noexcept
+	{
+		void* block = block_from_user_memory(p);
+		for (void*& slot: cache_)
+		{
+			if (!slot)
+			{
+				slot = block;
+				return;
+			}
+		}
+		::operator delete(block);
+	}
+};
+
+// Allocator getting its memory from a recycling_memory object
+template <typename T>
+class recycling_allocator
+{
+	recycling_memory* memory_;
+public:
+	using value_type = T;
+
+	explicit recycling_allocator(recycling_memory& memory) noexcept: memory_(&memory) {}
+
+	template <typename U>
+	recycling_allocator(const recycling_allocator<U>& other) noexcept: memory_(&other.memory()) {}
+
+	recycling_memory& memory() const noexcept { return *memory_; }
+
+	T* allocate(std::size_t n)
+	{
+		static_assert(alignof(T) <= alignof(std::max_align_t), "Over-aligned types not supported");
+		if (n > std::numeric_limits<std::size_t>::max() / sizeof(T))
+		{
+			throw std::bad_array_new_length();
+		}
+		return static_cast<T*>(memory_->allocate(n * sizeof(T)));
+	}
+
+	void deallocate(T* p, std::size_t) noexcept { memory_->deallocate(p); }
+};
+
+template <typename T, typename U>
+bool operator==(const recycling_allocator<T>& lhs, const recycling_allocator<U>& rhs) noexcept
+{
+	return &lhs.memory() == &rhs.memory();
+}
+
+template <typename T, typename U>
+bool operator!=(const recycling_allocator<T>& lhs, const recycling_allocator<U>& rhs) noexcept
+{
+	return !(lhs == rhs);
+}
+
+// Allocates the state of a composed async operation using the allocator associated
+// to the operation's completion handler, or default_allocator if it has none.
+template <typename T, typename Handler, typename DefaultAllocator, typename... Args>
+std::shared_ptr<T> allocate_operation_state(
+	const Handler& handler,
+	const DefaultAllocator& default_allocator,
+	Args&&... args
+)
+{
+	return std::allocate_shared<T>(
+		boost::asio::get_associated_allocator(handler, default_allocator),
+		std::forward<Args>(args)...
+	);
+}
+
+} // detail
+} // mysql
+} // boost
+
+#endif /* INCLUDE_BOOST_MYSQL_DETAIL_AUXILIAR_RECYCLING_ALLOCATOR_HPP_ */
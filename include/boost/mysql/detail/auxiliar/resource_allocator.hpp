@@ -0,0 +1,70 @@
+#ifndef INCLUDE_BOOST_MYSQL_DETAIL_AUXILIAR_RESOURCE_ALLOCATOR_HPP_
+#define INCLUDE_BOOST_MYSQL_DETAIL_AUXILIAR_RESOURCE_ALLOCATOR_HPP_
+
+#include <cassert>
+#include <cstddef>
+#include <limits>
+#include <memory_resource>
+#include <new>
+#include <type_traits>
+
+namespace boost {
+namespace mysql {
+namespace detail {
+
+// An allocator that gets its memory from a std::pmr::memory_resource, like
+// std::pmr::polymorphic_allocator. Unlike it, it propagates on container
+// assignment and swap, so moving a container always transfers its memory.
+// We use it for buffers that string values point into: with polymorphic_allocator,
+// move-assigning between containers with different resources copies the
+// elements, which would leave these values dangling.
+template <typename T>
+class resource_allocator
+{
+	std::pmr::memory_resource* resource_;
+public:
+	using value_type = T;
+	using propagate_on_container_copy_assignment = std::true_type;
+	using propagate_on_container_move_assignment = std::true_type;
+	using propagate_on_container_swap = std::true_type;
+
+	resource_allocator() noexcept: resource_(std::pmr::get_default_resource()) {}
+	resource_allocator(std::pmr::memory_resource* resource) noexcept: resource_(resource) { assert(resource); }
+
+	template <typename U>
+	resource_allocator(const resource_allocator<U>& other) noexcept: resource_(other.resource()) {}
+
+	std::pmr::memory_resource* resource() const noexcept { return resource_; }
+
+	T* allocate(std::size_t n)
+	{
+		if (n > std::numeric_limits<std::size_t>::max() / sizeof(T))
+		{
+			throw std::bad_array_new_length();
+		}
+		return static_cast<T*>(resource_->allocate(n * sizeof(T), alignof(T)));
+	}
+
+	void deallocate(T* p, std::size_t n) noexcept
+	{
+		resource_->deallocate(p, n * sizeof(T), alignof(T));
+	}
+};
+
+template <typename T, typename U>
+bool operator==(const resource_allocator<T>& lhs, const resource_allocator<U>& rhs) noexcept
+{
+	return lhs.resource() == rhs.resource() || lhs.resource()->is_equal(*rhs.resource());
+}
+
+template <typename T, typename U>
+bool operator!=(const resource_allocator<T>& lhs, const resource_allocator<U>& rhs) noexcept
+{
+	return !(lhs == rhs);
+}
+
+} // detail
+} // mysql
+} // boost
+
+#endif /* INCLUDE_BOOST_MYSQL_DETAIL_AUXILIAR_RESOURCE_ALLOCATOR_HPP_ */
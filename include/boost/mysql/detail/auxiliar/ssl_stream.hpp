@@ -0,0 +1,22 @@
+#ifndef INCLUDE_BOOST_MYSQL_DETAIL_AUXILIAR_SSL_STREAM_HPP_
+#define INCLUDE_BOOST_MYSQL_DETAIL_AUXILIAR_SSL_STREAM_HPP_
+
+#include <type_traits>
+#include <boost/asio/ssl/stream.hpp>
+
+namespace boost {
+namespace mysql {
+namespace detail {
+
+// Streams that can be upgraded to TLS during the handshake
+template <typename Stream>
+struct is_ssl_stream : std::false_type {};
+
+template <typename Stream>
+struct is_ssl_stream<boost::asio::ssl::stream<Stream>> : std::true_type {};
+
+} // detail
+} // mysql
+} // boost
+
+#endif /* INCLUDE_BOOST_MYSQL_DETAIL_AUXILIAR_SSL_STREAM_HPP_ */
@@ -0,0 +1,129 @@
+#ifndef INCLUDE_BOOST_MYSQL_DETAIL_AUXILIAR_STRUCT_TIE_HPP_
+#define INCLUDE_BOOST_MYSQL_DETAIL_AUXILIAR_STRUCT_TIE_HPP_
+
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace boost {
+namespace mysql {
+namespace detail {
+
+// Access to the members of an aggregate as a tuple of references, without
+// reflection: the member count is the biggest N for which T{x1, ..., xN}
+// is valid, where xi converts to anything, and members are then obtained
+// with structured bindings. Aggregates with base classes, C arrays or
+// nested aggregates are not supported.
+
+constexpr std::size_t max_aggregate_fields = 16;
+
+struct convertible_to_any
+{
+	std::size_t index;
+	template <typename T> operator T&() const&&; // never defined, only used in unevaluated contexts
+};
+
+template <typename T, typename IndexSeq, typename = void>
+struct is_brace_constructible : std::false_type {};
+
+template <typename T, std::size_t... I>
+struct is_brace_constructible<T, std::index_sequence<I...>, std::void_t<decltype(T{convertible_to_any{I}...})>>
+	: std::true_type {};
+
+template <typename T, std::size_t N = 0>
+constexpr std::size_t aggregate_field_count() noexcept
+{
+	if constexpr (N > max_aggregate_fields) return N;
+	else if constexpr (is_brace_constructible<T, std::make_index_sequence<N + 1>>::value)
+		return aggregate_field_count<T, N + 1>();
+	else return N;
+}
+
+template <typename T>
+struct is_tuple : std::false_type {};
+
+template <typename... T>
+struct is_tuple<std::tuple<T...>> : std::true_type {};
+
+// Returns a std::tuple of references to the members of v
+template <typename T>
+auto tie_aggregate(T& v) noexcept
+{
+	constexpr std::size_t n = aggregate_field_count<T>();
+	static_assert(std::is_aggregate_v<T>, "Row types must be std::tuple's or aggregates");
+	static_assert(n > 0 && n <= max_aggregate_fields, "Unsupported number of members in row type");
+	if constexpr (n == 1) { auto& [a] = v; return std::tie(a); }
+	else if constexpr (n == 2) { auto& [a, b] = v; return std::tie(a, b); }
+	else if constexpr (n == 3) { auto& [a, b, c] = v; return std::tie(a, b, c); }
+	else if constexpr (n == 4) { auto& [a, b, c, d] = v; return std::tie(a, b, c, d); }
+	else if constexpr (n == 5) { auto& [a, b, c, d, e] = v; return std::tie(a, b, c, d, e); }
+	else if constexpr (n == 6) { auto& [a, b, c, d, e, f] = v; return std::tie(a, b, c, d, e, f); }
+	else if constexpr (n == 7) { auto& [a, b, c, d, e, f, g] = v; return std::tie(a, b, c, d, e, f, g); }
+	else if constexpr (n == 8) { auto& [a, b, c, d, e, f, g, h] = v; return std::tie(a, b, c, d, e, f, g, h); }
+	else if constexpr (n == 9) { auto& [a, b, c, d, e, f, g, h, i] = v; return std::tie(a, b, c, d, e, f, g, h, i); }
+	else if constexpr (n == 10) { auto& [a, b, c, d, e, f, g, h, i, j] = v; return std::tie(a, b, c, d, e, f, g, h, i, j); }
+	else if constexpr (n == 11)
+	{
+		auto& [a, b, c, d, e, f, g, h, i, j, k] = v;
+		return std::tie(a, b, c, d, e, f, g, h, i, j, k);
+	}
+	else if constexpr (n == 12)
+	{
+		auto& [a, b, c, d, e, f, g, h, i, j, k, l] = v;
+		return std::tie(a, b, c, d, e, f, g, h, i, j, k, l);
+	}
+	else if constexpr (n == 13)
+	{
+		auto& [a, b, c, d, e, f, g, h, i, j, k, l, m] = v;
+		return std::tie(a, b, c, d, e, f, g, h, i, j, k, l, m);
+	}
+	else if constexpr (n == 14)
+	{
+		auto& [a, b, c, d, e, f, g, h, i, j, k, l, m, o] = v;
+		return std::tie(a, b, c, d, e, f, g, h, i, j, k, l, m, o);
+	}
+	else if constexpr (n == 15)
+	{
+		auto& [a, b, c, d, e, f, g, h, i, j, k, l, m, o, p] = v;
+		return std::tie(a, b, c, d, e, f, g, h, i, j, k, l, m, o, p);
+	}
+	else
+	{
+		auto& [a, b, c, d, e, f, g, h, i, j, k, l, m, o, p, q] = v;
+		return std::tie(a, b, c, d, e, f, g, h, i, j, k, l, m, o, p, q);
+	}
+}
+
+// Returns a std::tuple of references to the elements of a std::tuple or the members of an aggregate
+template <typename T>
+auto tie_row(T& v) noexcept
+{
+	if constexpr (is_tuple<T>::value)
+	{
+		return std::apply([](auto&... elms) { return std::tie(elms...); }, v);
+	}
+	else
+	{
+		return tie_aggregate(v);
+	}
+}
+
+// The element types of a row type, as a std::tuple of values
+template <typename Tuple>
+struct decay_tuple_elements;
+
+template <typename... T>
+struct decay_tuple_elements<std::tuple<T...>>
+{
+	using type = std::tuple<std::decay_t<T>...>;
+};
+
+template <typename T>
+using row_tuple_t = typename decay_tuple_elements<decltype(tie_row(std::declval<T&>()))>::type;
+
+} // detail
+} // mysql
+} // boost
+
+#endif /* INCLUDE_BOOST_MYSQL_DETAIL_AUXILIAR_STRUCT_TIE_HPP_ */
@@ -1,7 +1,9 @@
 #ifndef INCLUDE_BOOST_MYSQL_DETAIL_AUXILIAR_TMP_HPP_
 #define INCLUDE_BOOST_MYSQL_DETAIL_AUXILIAR_TMP_HPP_
 
+#include <cstddef>
 #include <type_traits>
+#include <variant>
 
 namespace boost {
 namespace mysql {
@@ -23,6 +25,22 @@ struct is_one_of<T, Head>
 template <typename T, typename... Types>
 constexpr bool is_one_of_v = is_one_of<T, Types...>::value;
 
+// The index of T within the alternatives of a std::variant
+template <typename T, typename Variant>
+struct variant_index;
+
+template <typename T, typename... Types>
+struct variant_index<T, std::variant<Types...>>
+{
+	static_assert(is_one_of_v<T, Types...>, "T is not one of the variant alternatives");
+	static constexpr std::size_t value = [] {
+		constexpr bool matches [] = { std::is_same_v<T, Types>... };
+		std::size_t res = 0;
+		while (!matches[res]) ++res;
+		return res;
+	}();
+};
+
 } // detail
 } // mysql
 } // boost
@@ -14,8 +14,8 @@ namespace detail {
 
 using deserialize_row_fn = error_code (*)(
 	deserialization_context&,
-	const std::vector<field_metadata>&,
-	std::vector<value>&
+	const resultset_metadata&,
+	std::pmr::vector<value>&
 );
 
 using empty_signature = void(error_code);
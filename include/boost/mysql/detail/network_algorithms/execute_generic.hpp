@@ -9,11 +9,15 @@ namespace boost {
 namespace mysql {
 namespace detail {
 
+// Sends request and reads the resultset head, recording latency under op.
+// cached_metadata, if not null, is used if the server omits the field definitions
 template <typename StreamType, typename Serializable>
 void execute_generic(
 	deserialize_row_fn deserializer,
+	std::shared_ptr<const resultset_metadata> cached_metadata,
 	channel<StreamType>& channel,
 	const Serializable& request,
+	latency_operation op,
 	resultset<StreamType>& output,
 	error_code& err,
 	error_info& info
@@ -22,12 +26,37 @@ void execute_generic(
 template <typename StreamType>
 using execute_generic_signature = void(error_code, resultset<StreamType>);
 
+// Reads the response to a request that has already been written
+// (the first packet plus any field definitions). The channel's sequence
+// number should have been set to the one expected for the response.
+template <typename StreamType>
+void read_resultset_head(
+	deserialize_row_fn deserializer,
+	std::shared_ptr<const resultset_metadata> cached_metadata,
+	channel<StreamType>& channel,
+	resultset<StreamType>& output,
+	error_code& err,
+	error_info& info
+);
+
+template <typename StreamType, typename CompletionToken>
+BOOST_ASIO_INITFN_RESULT_TYPE(CompletionToken, execute_generic_signature<StreamType>)
+async_read_resultset_head(
+	deserialize_row_fn deserializer,
+	std::shared_ptr<const resultset_metadata> cached_metadata,
+	channel<StreamType>& chan,
+	CompletionToken&& token,
+	error_info* info
+);
+
 template <typename StreamType, typename Serializable, typename CompletionToken>
 BOOST_ASIO_INITFN_RESULT_TYPE(CompletionToken, execute_generic_signature<StreamType>)
 async_execute_generic(
 	deserialize_row_fn deserializer,
+	std::shared_ptr<const resultset_metadata> cached_metadata,
 	channel<StreamType>& chan,
 	const Serializable& request,
+	latency_operation op,
 	CompletionToken&& token,
 	error_info* info
 );
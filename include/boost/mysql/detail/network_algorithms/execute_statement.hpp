@@ -14,6 +14,7 @@ template <typename StreamType, typename ForwardIterator>
 void execute_statement(
 	channel<StreamType>& channel,
 	std::uint32_t statement_id,
+	std::shared_ptr<const resultset_metadata> cached_metadata,
 	ForwardIterator params_begin,
 	ForwardIterator params_end,
 	resultset<StreamType>& output,
@@ -26,6 +27,7 @@ BOOST_ASIO_INITFN_RESULT_TYPE(CompletionToken, execute_generic_signature<StreamT
 async_execute_statement(
 	channel<StreamType>& chan,
 	std::uint32_t statement_id,
+	std::shared_ptr<const resultset_metadata> cached_metadata,
 	ForwardIterator params_begin,
 	ForwardIterator params_end,
 	CompletionToken&& token,
@@ -6,6 +6,8 @@
 #include "boost/mysql/detail/protocol/channel.hpp"
 #include "boost/mysql/detail/protocol/protocol_types.hpp"
 #include "boost/mysql/collation.hpp"
+#include "boost/mysql/compression.hpp"
+#include "boost/mysql/ssl.hpp"
 
 namespace boost {
 namespace mysql {
@@ -17,6 +19,10 @@ struct handshake_params
 	std::string_view username;
 	std::string_view password;
 	std::string_view database;
+	compression_algorithm compression;
+	std::size_t compression_threshold;
+	ssl_mode ssl;
+	ssl_session_cache* ssl_sessions;
 };
 
 template <typename StreamType>
@@ -8,9 +8,12 @@ void boost::mysql::detail::close_statement(
 	channel<StreamType>& chan,
 	std::uint32_t statement_id,
 	error_code& code,
-	error_info&
+	error_info& info
 )
 {
+	latency_scope latency (chan.latency(), latency_operation::close_statement);
+	chan.trace_start(traced_operation::close_statement, std::string_view(), statement_id);
+
 	// Compose the close message
 	com_stmt_close_packet packet {int4(statement_id)};
 
@@ -20,6 +23,7 @@ void boost::mysql::detail::close_statement(
 	// Send it. No response is sent back
 	chan.reset_sequence_number();
 	chan.write(boost::asio::buffer(chan.shared_buffer()), code);
+	if (code) chan.trace_error(code, info);
 }
 
 template <typename StreamType, typename CompletionToken>
@@ -34,6 +38,47 @@ boost::mysql::detail::async_close_statement(
 	error_info*
 )
 {
+	using HandlerSignature = close_signature;
+	using HandlerType = BOOST_ASIO_HANDLER_TYPE(CompletionToken, HandlerSignature);
+	using BaseType = boost::beast::async_base<
+		HandlerType,
+		typename StreamType::executor_type,
+		recycling_allocator<void>
+	>;
+
+	boost::asio::async_completion<CompletionToken, HandlerSignature> initiator(token);
+
+	// Only required to record latency and trace errors once the write completes
+	struct Op: BaseType
+	{
+		channel<StreamType>& chan_;
+		latency_timer timer_;
+
+		Op(
+			HandlerType&& handler,
+			channel<StreamType>& chan,
+			latency_timer timer
+		):
+			BaseType(std::move(handler), chan.next_layer().get_executor(), chan.operation_allocator()),
+			chan_(chan),
+			timer_(timer)
+		{
+		}
+
+		void operator()(
+			error_code err
+		)
+		{
+			if (err) chan_.trace_error(err, error_info());
+			this->complete(true, err);
+		}
+
+		void before_invoke_hook() override { timer_.finish(); }
+	};
+
+	latency_timer timer (chan.latency(), latency_operation::close_statement);
+	chan.trace_start(traced_operation::close_statement, std::string_view(), statement_id);
+
 	// Compose the close message
 	com_stmt_close_packet packet {int4(statement_id)};
 
@@ -42,10 +87,11 @@ boost::mysql::detail::async_close_statement(
 
 	// Send it. No response is sent back
 	chan.reset_sequence_number();
-	return chan.async_write(
+	chan.async_write(
 		boost::asio::buffer(chan.shared_buffer()),
-		std::forward<CompletionToken>(token)
+		Op(std::move(initiator.completion_handler), chan, timer)
 	);
+	return initiator.result.get();
 }
 
 
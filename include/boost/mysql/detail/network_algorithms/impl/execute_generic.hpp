@@ -1,7 +1,9 @@
 #ifndef INCLUDE_MYSQL_IMPL_NETWORK_ALGORITHMS_READ_RESULTSET_HEAD_IPP_
 #define INCLUDE_MYSQL_IMPL_NETWORK_ALGORITHMS_READ_RESULTSET_HEAD_IPP_
 
+#include "boost/mysql/detail/protocol/query_messages.hpp"
 #include <boost/asio/yield.hpp>
+#include <cstring>
 #include <limits>
 
 namespace boost {
@@ -13,23 +15,34 @@ class execute_processor
 {
 	deserialize_row_fn deserializer_;
 	channel<StreamType>& channel_;
-	bytestring buffer_;
+	resource_bytestring buffer_;
 	std::size_t field_count_ {};
 	ok_packet ok_packet_;
-	std::vector<field_metadata> fields_;
-	std::vector<bytestring> field_buffers_;
+	resultset_metadata_builder metadata_builder_;
+	resultset_metadata metadata_;
+	std::shared_ptr<const resultset_metadata> cached_metadata_;
+	bool metadata_follows_ {true};
+	bool missing_metadata_ {false}; // rows must be discarded, as we can't parse them
+	bool reusing_cached_ {false}; // all field definitions read so far match the cached ones
+	std::size_t num_field_definitions_read_ {};
 public:
-	execute_processor(deserialize_row_fn deserializer, channel<StreamType>& chan):
-		deserializer_(deserializer), channel_(chan) {};
+	execute_processor(
+		deserialize_row_fn deserializer,
+		channel<StreamType>& chan,
+		std::shared_ptr<const resultset_metadata> cached_metadata
+	):
+		deserializer_(deserializer), channel_(chan), buffer_(chan.memory_resource()),
+		metadata_builder_(chan.memory_resource()), cached_metadata_(std::move(cached_metadata)) {};
 
 	template <typename Serializable>
 	void process_request(
 		const Serializable& request
 	)
 	{
-		// Serialize the request
+		// Serialize the request. The channel's shared buffer is reused between
+		// requests, so this does not allocate in the steady state
 		capabilities caps = channel_.current_capabilities();
-		serialize_message(request, caps, buffer_);
+		serialize_message(request, caps, channel_.shared_buffer());
 
 		// Prepare the channel
 		channel_.reset_sequence_number();
@@ -63,13 +76,13 @@ public:
 			// the number of field definitions to expect. Message type is part
 			// of this packet, so we must rewind the context
 			ctx.rewind(1);
-			int_lenenc num_fields;
-			err = deserialize_message(num_fields, ctx);
+			resultset_head_packet head;
+			err = deserialize_message(head, ctx);
 			if (err) return;
 
 			// For platforms where size_t is shorter than uint64_t,
 			// perform range check
-			if (num_fields.value > std::numeric_limits<std::size_t>::max())
+			if (head.num_columns.value > std::numeric_limits<std::size_t>::max())
 			{
 				err = make_error_code(errc::protocol_value_error);
 				return;
@@ -77,33 +90,93 @@ public:
 
 			// Ensure we have fields, as field_count is indicative of
 			// a resultset with fields
-			field_count_ = static_cast<std::size_t>(num_fields.value);
+			field_count_ = static_cast<std::size_t>(head.num_columns.value);
 			if (field_count_ == 0)
 			{
 				err = make_error_code(errc::protocol_value_error);
 				return;
 			}
 
-			fields_.reserve(field_count_);
-			field_buffers_.reserve(field_count_);
+			// If the server omitted the field definitions (because the
+			// resultset_metadata session variable is NONE), use the cached ones.
+			// If there are none, the rows can't be parsed. They are discarded
+			// (\see process_discarded_row) and errc::missing_metadata is reported
+			metadata_follows_ = head.metadata_follows.value != resultset_metadata_none;
+			if (!metadata_follows_)
+			{
+				missing_metadata_ = !cached_metadata_ || cached_metadata_->fields().size() != field_count_;
+				return;
+			}
+
+			// Executions of a prepared statement usually get the same field definitions
+			// it got when it was prepared. If so, the cached metadata is shared instead
+			// of parsing and storing them again
+			reusing_cached_ = cached_metadata_ && cached_metadata_->fields().size() == field_count_;
+			if (!reusing_cached_)
+			{
+				metadata_builder_.reserve(field_count_);
+			}
 		}
 	}
 
-	error_code process_field_definition()
+	// Whether rows must be read and discarded after the first packet
+	bool missing_metadata() const noexcept { return missing_metadata_; }
+
+	// Processes a row (or the end of the resultset) following a head without
+	// field definitions we could use. Returns true if more rows follow. Once the
+	// resultset ends, the connection is usable again and err is set to
+	// errc::missing_metadata (or to the server error, if there was one).
+	bool process_discarded_row(error_code& err, error_info& info)
 	{
-		column_definition_packet field_definition;
-		deserialization_context ctx (boost::asio::buffer(buffer_), channel_.current_capabilities());
-		auto err = deserialize_message(field_definition, ctx);
-		if (err) return err;
+		auto result = process_read_message(
+			[](deserialization_context&) { return error_code(); },
+			channel_.current_capabilities(),
+			boost::asio::buffer(buffer_),
+			ok_packet_,
+			err,
+			info
+		);
+		if (result == read_row_result::eof)
+		{
+			err = make_error_code(errc::missing_metadata);
+		}
+		return result == read_row_result::row;
+	}
 
-		// Add it to our array
-		fields_.push_back(field_definition);
-		field_buffers_.push_back(std::move(buffer_));
-		buffer_ = bytestring();
+	// Field definitions are read into buffer_, which is reused for all of them,
+	// and stored by metadata_builder_ (unless they match the cached ones)
+	error_code process_field_definition()
+	{
+		if (reusing_cached_)
+		{
+			auto cached = cached_metadata_->packet(num_field_definitions_read_);
+			if (cached.size() == buffer_.size() && std::memcmp(cached.data(), buffer_.data(), buffer_.size()) == 0)
+			{
+				++num_field_definitions_read_;
+				return error_code();
+			}
 
+			// Definitions changed (e.g. the underlying table was altered). Store the
+			// ones we skipped from the cache, then go on as usual
+			reusing_cached_ = false;
+			metadata_builder_.reserve(field_count_);
+			for (std::size_t i = 0; i < num_field_definitions_read_; ++i)
+			{
+				metadata_builder_.add_packet(cached_metadata_->packet(i));
+			}
+		}
+		metadata_builder_.add_packet(boost::asio::buffer(buffer_));
+		++num_field_definitions_read_;
 		return error_code();
 	}
 
+	// Parses the stored field definitions, once all of them have been read
+	error_code process_field_definitions_end()
+	{
+		if (!metadata_follows_ || reusing_cached_ || field_count_ == 0) return error_code();
+		return std::move(metadata_builder_).build(channel_.current_capabilities(), metadata_);
+	}
+
 	resultset<StreamType> create_resultset() &&
 	{
 		if (field_count_ == 0)
@@ -114,22 +187,63 @@ public:
 				ok_packet_
 			);
 		}
+		else if (!metadata_follows_ || reusing_cached_)
+		{
+			return resultset<StreamType>(
+				channel_,
+				resultset_metadata(std::move(cached_metadata_), channel_.memory_resource()),
+				deserializer_
+			);
+		}
 		else
 		{
 			return resultset<StreamType>(
 				channel_,
-				resultset_metadata(std::move(field_buffers_), std::move(fields_)),
+				std::move(metadata_),
 				deserializer_
 			);
 		}
 	}
 
+	// Reports the end of the resultset head to the channel's observer
+	void trace_head_complete()
+	{
+		if (field_count_ == 0)
+		{
+			channel_.trace_resultset_complete(ok_packet_.affected_rows.value);
+		}
+		else
+		{
+			channel_.trace_metadata_complete(field_count_);
+		}
+	}
+
 	auto& get_channel() { return channel_; }
 	auto& get_buffer() { return buffer_; }
+	boost::asio::const_buffer get_request_buffer() { return boost::asio::buffer(channel_.shared_buffer()); }
 
-	std::size_t field_count() const noexcept { return field_count_; }
+	// The number of field definition packets that follow the first response packet
+	std::size_t num_field_definitions() const noexcept { return metadata_follows_ ? field_count_ : 0; }
 };
 
+// Reads the resultset head using processor, which may have been used to
+// send the request. Traces its own errors
+template <typename StreamType>
+void read_resultset_head_impl(
+	execute_processor<StreamType>& processor,
+	resultset<StreamType>& output,
+	error_code& err,
+	error_info& info
+);
+
+// Async version of read_resultset_head_impl. processor is kept alive until the handler is invoked
+template <typename StreamType, typename HandlerType>
+void async_read_resultset_head_impl(
+	std::shared_ptr<execute_processor<StreamType>> processor,
+	HandlerType&& handler,
+	error_info* info
+);
+
 } // detail
 } // mysql
 } // boost
@@ -137,42 +251,111 @@ public:
 template <typename StreamType, typename Serializable>
 void boost::mysql::detail::execute_generic(
 	deserialize_row_fn deserializer,
+	std::shared_ptr<const resultset_metadata> cached_metadata,
 	channel<StreamType>& channel,
 	const Serializable& request,
+	latency_operation op,
 	resultset<StreamType>& output,
 	error_code& err,
 	error_info& info
 )
 {
-	// Compose a com_query message, reset seq num
-	execute_processor<StreamType> processor (deserializer, channel);
+	latency_scope latency (channel.latency(), op);
+
+	// Compose the request into the channel's shared buffer, reset seq num.
+	// The same processor reads the response
+	execute_processor<StreamType> processor (deserializer, channel, std::move(cached_metadata));
 	processor.process_request(request);
 
 	// Send it
-	channel.write(boost::asio::buffer(processor.get_buffer()), err);
-	if (err) return;
+	channel.write(processor.get_request_buffer(), err);
+	if (err)
+	{
+		channel.trace_error(err, info);
+		return;
+	}
+
+	// Read the response. Traces its own errors
+	read_resultset_head_impl(processor, output, err, info);
+}
+
+template <typename StreamType>
+void boost::mysql::detail::read_resultset_head(
+	deserialize_row_fn deserializer,
+	std::shared_ptr<const resultset_metadata> cached_metadata,
+	channel<StreamType>& channel,
+	resultset<StreamType>& output,
+	error_code& err,
+	error_info& info
+)
+{
+	execute_processor<StreamType> processor (deserializer, channel, std::move(cached_metadata));
+	read_resultset_head_impl(processor, output, err, info);
+}
+
+template <typename StreamType>
+void boost::mysql::detail::read_resultset_head_impl(
+	execute_processor<StreamType>& processor,
+	resultset<StreamType>& output,
+	error_code& err,
+	error_info& info
+)
+{
+	auto& channel = processor.get_channel();
 
 	// Read the response
 	channel.read(processor.get_buffer(), err);
-	if (err) return;
+	if (err)
+	{
+		channel.trace_error(err, info);
+		return;
+	}
+	channel.trace_first_byte();
 
 	// Response may be: ok_packet, err_packet, local infile request (not implemented), or response with fields
 	processor.process_response(err, info);
-	if (err) return;
+	if (!err && processor.missing_metadata())
+	{
+		// Keep the connection in sync: read the rows we can't parse. Sets err
+		bool more_rows = true;
+		while (more_rows)
+		{
+			channel.read(processor.get_buffer(), err);
+			if (err) break;
+			more_rows = processor.process_discarded_row(err, info);
+		}
+	}
+	if (err)
+	{
+		channel.trace_error(err, info);
+		return;
+	}
 
-	// Read all of the field definitions (zero if empty resultset)
-	for (std::uint64_t i = 0; i < processor.field_count(); ++i)
+	// Read all of the field definitions (zero if empty resultset or omitted by the server)
+	for (std::size_t i = 0; i < processor.num_field_definitions(); ++i)
 	{
 		// Read the field definition packet
 		channel.read(processor.get_buffer(), err);
-		if (err) return;
-
-		// Process the message
-		err = processor.process_field_definition();
-		if (err) return;
+		if (!err)
+		{
+			// Process the message
+			err = processor.process_field_definition();
+		}
+		if (err)
+		{
+			channel.trace_error(err, info);
+			return;
+		}
+	}
+	err = processor.process_field_definitions_end();
+	if (err)
+	{
+		channel.trace_error(err, info);
+		return;
 	}
 
 	// No EOF packet is expected here, as we require deprecate EOF capabilities
+	processor.trace_head_complete();
 	output = std::move(processor).create_resultset();
 	err.clear();
 }
@@ -185,15 +368,21 @@ BOOST_ASIO_INITFN_RESULT_TYPE(
 )
 boost::mysql::detail::async_execute_generic(
 	deserialize_row_fn deserializer,
+	std::shared_ptr<const resultset_metadata> cached_metadata,
 	channel<StreamType>& chan,
 	const Serializable& request,
+	latency_operation op,
 	CompletionToken&& token,
 	error_info* info
 )
 {
 	using HandlerSignature = execute_generic_signature<StreamType>;
 	using HandlerType = BOOST_ASIO_HANDLER_TYPE(CompletionToken, HandlerSignature);
-	using BaseType = boost::beast::async_base<HandlerType, typename StreamType::executor_type>;
+	using BaseType = boost::beast::async_base<
+		HandlerType,
+		typename StreamType::executor_type,
+		recycling_allocator<void>
+	>;
 	using ResultsetType = resultset<StreamType>;
 
 	boost::asio::async_completion<CompletionToken, HandlerSignature> initiator(token);
@@ -201,42 +390,153 @@ boost::mysql::detail::async_execute_generic(
 	struct Op: BaseType, boost::asio::coroutine
 	{
 		std::shared_ptr<execute_processor<StreamType>> processor_;
-		std::uint64_t remaining_fields_ {0};
 		error_info* output_info_;
+		latency_timer timer_;
 
 		Op(
 			HandlerType&& handler,
-			deserialize_row_fn deserializer,
-			channel<StreamType>& channel,
+			std::shared_ptr<execute_processor<StreamType>>&& processor,
 			const Serializable& request,
+			latency_operation op,
 			error_info* output_info
 		):
-			BaseType(std::move(handler), channel.next_layer().get_executor()),
-			processor_(std::make_shared<execute_processor<StreamType>>(deserializer, channel)),
-			output_info_(output_info)
+			BaseType(std::move(handler), processor->get_channel().next_layer().get_executor(), processor->get_channel().operation_allocator()),
+			processor_(std::move(processor)),
+			output_info_(output_info),
+			timer_(processor_->get_channel().latency(), op)
 		{
 			processor_->process_request(request);
 		}
 
+		void before_invoke_hook() override { timer_.finish(); }
+
 		void operator()(
 			error_code err,
 			bool cont=true
 		)
 		{
-			error_info info;
 			reenter(*this)
 			{
 				// The request message has already been composed in the ctor. Send it
 				yield processor_->get_channel().async_write(
-					boost::asio::buffer(processor_->get_buffer()),
+					processor_->get_request_buffer(),
 					std::move(*this)
 				);
 				if (err)
 				{
+					processor_->get_channel().trace_error(err, error_info());
 					this->complete(cont, err, ResultsetType());
 					yield break;
 				}
 
+				// Read the response with the same processor. Traces its own errors
+				yield async_read_resultset_head_impl(
+					processor_,
+					std::move(*this),
+					output_info_
+				);
+			}
+		}
+
+		// Response read
+		void operator()(
+			error_code err,
+			ResultsetType result
+		)
+		{
+			this->complete(true, err, std::move(result));
+		}
+	};
+
+	auto processor = allocate_operation_state<execute_processor<StreamType>>(
+		initiator.completion_handler,
+		chan.operation_allocator(),
+		deserializer,
+		chan,
+		std::move(cached_metadata)
+	);
+	Op(
+		std::move(initiator.completion_handler),
+		std::move(processor),
+		request,
+		op,
+		info
+	)(error_code(), false);
+	return initiator.result.get();
+}
+
+template <typename StreamType, typename CompletionToken>
+BOOST_ASIO_INITFN_RESULT_TYPE(
+	CompletionToken,
+	boost::mysql::detail::execute_generic_signature<StreamType>
+)
+boost::mysql::detail::async_read_resultset_head(
+	deserialize_row_fn deserializer,
+	std::shared_ptr<const resultset_metadata> cached_metadata,
+	channel<StreamType>& chan,
+	CompletionToken&& token,
+	error_info* info
+)
+{
+	using HandlerSignature = execute_generic_signature<StreamType>;
+
+	boost::asio::async_completion<CompletionToken, HandlerSignature> initiator(token);
+
+	auto processor = allocate_operation_state<execute_processor<StreamType>>(
+		initiator.completion_handler,
+		chan.operation_allocator(),
+		deserializer,
+		chan,
+		std::move(cached_metadata)
+	);
+	async_read_resultset_head_impl(
+		std::move(processor),
+		std::move(initiator.completion_handler),
+		info
+	);
+	return initiator.result.get();
+}
+
+template <typename StreamType, typename HandlerType>
+void boost::mysql::detail::async_read_resultset_head_impl(
+	std::shared_ptr<execute_processor<StreamType>> processor,
+	HandlerType&& handler,
+	error_info* info
+)
+{
+	using HandlerTypeDecayed = std::decay_t<HandlerType>;
+	using BaseType = boost::beast::async_base<
+		HandlerTypeDecayed,
+		typename StreamType::executor_type,
+		recycling_allocator<void>
+	>;
+	using ResultsetType = resultset<StreamType>;
+
+	struct Op: BaseType, boost::asio::coroutine
+	{
+		std::shared_ptr<execute_processor<StreamType>> processor_;
+		std::uint64_t remaining_fields_ {0};
+		error_info* output_info_;
+
+		Op(
+			HandlerTypeDecayed&& handler,
+			std::shared_ptr<execute_processor<StreamType>>&& processor,
+			error_info* output_info
+		):
+			BaseType(std::move(handler), processor->get_channel().next_layer().get_executor(), processor->get_channel().operation_allocator()),
+			processor_(std::move(processor)),
+			output_info_(output_info)
+		{
+		}
+
+		void operator()(
+			error_code err,
+			bool cont=true
+		)
+		{
+			error_info info;
+			reenter(*this)
+			{
 				// Read the response
 				yield processor_->get_channel().async_read(
 					processor_->get_buffer(),
@@ -244,19 +544,33 @@ boost::mysql::detail::async_execute_generic(
 				);
 				if (err)
 				{
+					processor_->get_channel().trace_error(err, info);
 					this->complete(cont, err, ResultsetType());
 					yield break;
 				}
+				processor_->get_channel().trace_first_byte();
 
 				// Response may be: ok_packet, err_packet, local infile request (not implemented), or response with fields
 				processor_->process_response(err, info);
+				if (!err && processor_->missing_metadata())
+				{
+					// Keep the connection in sync: read the rows we can't parse. Sets err
+					do
+					{
+						yield processor_->get_channel().async_read(
+							processor_->get_buffer(),
+							std::move(*this)
+						);
+					} while (!err && processor_->process_discarded_row(err, info));
+				}
 				if (err)
 				{
+					processor_->get_channel().trace_error(err, info);
 					conditional_assign(output_info_, std::move(info));
 					this->complete(cont, err, ResultsetType());
 					yield break;
 				}
-				remaining_fields_ = processor_->field_count();
+				remaining_fields_ = processor_->num_field_definitions();
 
 				// Read all of the field definitions
 				while (remaining_fields_ > 0)
@@ -274,14 +588,23 @@ boost::mysql::detail::async_execute_generic(
 
 					if (err)
 					{
+						processor_->get_channel().trace_error(err, info);
 						this->complete(cont, err, ResultsetType());
 						yield break;
 					}
 
 					remaining_fields_--;
 				}
+				err = processor_->process_field_definitions_end();
+				if (err)
+				{
+					processor_->get_channel().trace_error(err, info);
+					this->complete(cont, err, ResultsetType());
+					yield break;
+				}
 
 				// No EOF packet is expected here, as we require deprecate EOF capabilities
+				processor_->trace_head_complete();
 				this->complete(
 					cont,
 					error_code(),
@@ -292,13 +615,10 @@ boost::mysql::detail::async_execute_generic(
 	};
 
 	Op(
-		std::move(initiator.completion_handler),
-		deserializer,
-		chan,
-		request,
+		std::move(handler),
+		std::move(processor),
 		info
 	)(error_code(), false);
-	return initiator.result.get();
 }
 
 #include <boost/asio/unyield.hpp>
@@ -13,11 +13,14 @@ void boost::mysql::detail::execute_query(
 	error_info& info
 )
 {
+	channel.trace_start(traced_operation::query, query);
 	com_query_packet request { string_eof(query) };
 	execute_generic(
 		&deserialize_text_row,
+		nullptr, // no cached metadata for text queries
 		channel,
 		request,
+		latency_operation::query,
 		output,
 		err,
 		info
@@ -37,11 +40,14 @@ boost::mysql::detail::async_execute_query(
 	error_info* info
 )
 {
+	chan.trace_start(traced_operation::query, query);
 	com_query_packet request { string_eof(query) };
 	return async_execute_generic(
 		&deserialize_text_row,
+		nullptr, // no cached metadata for text queries
 		chan,
 		request,
+		latency_operation::query,
 		std::forward<CompletionToken>(token),
 		info
 	);
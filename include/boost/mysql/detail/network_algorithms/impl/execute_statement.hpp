@@ -33,6 +33,7 @@ template <typename StreamType, typename ForwardIterator>
 void boost::mysql::detail::execute_statement(
 	channel<StreamType>& chan,
 	std::uint32_t statement_id,
+	std::shared_ptr<const resultset_metadata> cached_metadata,
 	ForwardIterator params_begin,
 	ForwardIterator params_end,
 	resultset<StreamType>& output,
@@ -40,10 +41,13 @@ void boost::mysql::detail::execute_statement(
 	error_info& info
 )
 {
+	chan.trace_start(traced_operation::execute_statement, std::string_view(), statement_id);
 	execute_generic(
 		&deserialize_binary_row,
+		std::move(cached_metadata),
 		chan,
 		make_stmt_execute_packet(statement_id, params_begin, params_end),
+		latency_operation::execute_statement,
 		output,
 		err,
 		info
@@ -58,16 +62,20 @@ BOOST_ASIO_INITFN_RESULT_TYPE(
 boost::mysql::detail::async_execute_statement(
 	channel<StreamType>& chan,
 	std::uint32_t statement_id,
+	std::shared_ptr<const resultset_metadata> cached_metadata,
 	ForwardIterator params_begin,
 	ForwardIterator params_end,
 	CompletionToken&& token,
 	error_info* info
 )
 {
+	chan.trace_start(traced_operation::execute_statement, std::string_view(), statement_id);
 	return async_execute_generic(
 		&deserialize_binary_row,
+		std::move(cached_metadata),
 		chan,
 		make_stmt_execute_packet(statement_id, params_begin, params_end),
+		latency_operation::execute_statement,
 		std::forward<CompletionToken>(token),
 		info
 	);
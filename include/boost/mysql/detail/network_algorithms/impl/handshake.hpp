@@ -5,6 +5,8 @@
 #include "boost/mysql/detail/auth/mysql_native_password.hpp"
 #include "boost/mysql/detail/protocol/capabilities.hpp"
 #include "boost/mysql/detail/protocol/handshake_messages.hpp"
+#include "boost/mysql/detail/protocol/compression.hpp"
+#include "boost/mysql/detail/auxiliar/ssl_stream.hpp"
 #include <boost/asio/yield.hpp>
 
 namespace boost {
@@ -16,6 +18,17 @@ inline std::uint8_t get_collation_first_byte(collation value)
 	return static_cast<std::uint16_t>(value) % 0xff;
 }
 
+// The capability to request for each compression algorithm
+inline capabilities get_compression_capabilities(compression_algorithm algo)
+{
+	switch (algo)
+	{
+	case compression_algorithm::zlib: return capabilities(CLIENT_COMPRESS);
+	case compression_algorithm::zstd: return capabilities(CLIENT_ZSTD_COMPRESSION_ALGORITHM);
+	default: return capabilities(0);
+	}
+}
+
 inline error_code deserialize_handshake(
 	boost::asio::const_buffer buffer,
 	handshake_packet& output,
@@ -76,10 +89,14 @@ public:
 class handshake_processor
 {
 	handshake_params params_;
+	bool stream_supports_ssl_;
 	capabilities negotiated_caps_;
+	std::array<std::uint8_t, 32> ssl_request_buffer_ {};
 public:
-	handshake_processor(const handshake_params& params): params_(params) {};
+	handshake_processor(const handshake_params& params, bool stream_supports_ssl):
+		params_(params), stream_supports_ssl_(stream_supports_ssl) {};
 	capabilities negotiated_capabilities() const { return negotiated_caps_; }
+	bool use_ssl() const noexcept { return negotiated_caps_.has(CLIENT_SSL); }
 
 	error_code process_capabilities(const handshake_packet& handshake)
 	{
@@ -92,9 +109,61 @@ public:
 		{
 			return make_error_code(errc::server_unsupported);
 		}
-		negotiated_caps_ = server_caps & (required_caps | optional_capabilities);
+		// Compression is optional: if the server (or this build) does not support
+		// the requested algorithm, we go on without compression
+		capabilities compression_caps =
+				is_compression_available(params_.compression) ?
+				get_compression_capabilities(params_.compression) :
+				capabilities(0);
+		capabilities ssl_caps (0);
+		if (stream_supports_ssl_ && params_.ssl != ssl_mode::disable)
+		{
+			if (server_caps.has(CLIENT_SSL))
+			{
+				ssl_caps = capabilities(CLIENT_SSL);
+			}
+			else if (params_.ssl == ssl_mode::require)
+			{
+				return make_error_code(errc::server_doesnt_support_ssl);
+			}
+		}
+		negotiated_caps_ = server_caps & (required_caps | optional_capabilities | compression_caps | ssl_caps);
 		return error_code();
 	}
+	compression_algorithm negotiated_compression() const noexcept
+	{
+		return negotiated_caps_.has_all(get_compression_capabilities(params_.compression)) ?
+				params_.compression : compression_algorithm::none;
+	}
+	template <typename StreamType>
+	void load_ssl_session(channel<StreamType>& chan) const
+	{
+		if constexpr (is_ssl_stream<StreamType>::value)
+		{
+			if (params_.ssl_sessions)
+			{
+				params_.ssl_sessions->load(chan.next_layer().native_handle());
+			}
+		}
+	}
+	template <typename StreamType>
+	void apply_negotiated(channel<StreamType>& chan) const
+	{
+		if constexpr (is_ssl_stream<StreamType>::value)
+		{
+			// Done at the end, so any TLS 1.3 session tickets have already been received
+			if (use_ssl() && params_.ssl_sessions)
+			{
+				params_.ssl_sessions->store(chan.next_layer().native_handle());
+			}
+		}
+		chan.set_current_capabilities(negotiated_caps_);
+		compression_algorithm compression = negotiated_compression();
+		if (compression != compression_algorithm::none)
+		{
+			chan.enable_compression(compression, params_.compression_threshold);
+		}
+	}
 	void compose_handshake_response(
 		std::string_view auth_response,
 		handshake_response_packet& output
@@ -107,6 +176,19 @@ public:
 		output.auth_response.value = auth_response;
 		output.database.value = params_.database;
 		output.client_plugin_name.value = mysql_native_password::plugin_name;
+		output.zstd_compression_level.value = default_zstd_compression_level;
+	}
+	boost::asio::const_buffer compose_ssl_request()
+	{
+		ssl_request_packet request;
+		request.client_flag.value = negotiated_caps_.get();
+		request.max_packet_size.value = MAX_PACKET_SIZE;
+		request.character_set.value = get_collation_first_byte(params_.connection_collation);
+		request.filler = {};
+		serialization_context ctx (negotiated_caps_, ssl_request_buffer_.data());
+		assert(get_size(request, ctx) == ssl_request_buffer_.size());
+		serialize(request, ctx);
+		return boost::asio::buffer(ssl_request_buffer_);
 	}
 	error_code compute_auth_switch_response(
 		const auth_switch_request_packet& request,
@@ -125,7 +207,7 @@ public:
 		);
 	}
 
-	error_code process_handshake(bytestring& buffer, error_info& info)
+	error_code process_handshake(resource_bytestring& buffer, error_info& info)
 	{
 		// Deserialize server greeting
 		handshake_packet handshake;
@@ -156,7 +238,7 @@ public:
 	}
 
 	error_code process_handshake_server_response(
-		bytestring& buffer,
+		resource_bytestring& buffer,
 		bool& auth_complete,
 		error_info& info
 	)
@@ -231,8 +313,10 @@ void boost::mysql::detail::hanshake(
 	error_info& info
 )
 {
+	latency_scope latency (channel.latency(), latency_operation::handshake);
+
 	// Set up processor
-	handshake_processor processor (params);
+	handshake_processor processor (params, is_ssl_stream<StreamType>::value);
 
 	// Read server greeting
 	channel.read(channel.shared_buffer(), err);
@@ -242,6 +326,16 @@ void boost::mysql::detail::hanshake(
 	err = processor.process_handshake(channel.shared_buffer(), info);
 	if (err) return;
 
+	// Upgrade to TLS, if negotiated. The handshake response goes encrypted
+	if (processor.use_ssl())
+	{
+		channel.write(processor.compose_ssl_request(), err);
+		if (err) return;
+		processor.load_ssl_session(channel);
+		channel.ssl_handshake(err);
+		if (err) return;
+	}
+
 	// Send
 	channel.write(boost::asio::buffer(channel.shared_buffer()), err);
 	if (err) return;
@@ -256,6 +350,7 @@ void boost::mysql::detail::hanshake(
 	if (err) return;
 	if (auth_complete)
 	{
+		processor.apply_negotiated(channel);
 		err.clear();
 		return;
 	}
@@ -272,7 +367,7 @@ void boost::mysql::detail::hanshake(
 	err = processor.process_auth_switch_response(boost::asio::buffer(channel.shared_buffer()), info);
 	if (err) return;
 
-	channel.set_current_capabilities(processor.negotiated_capabilities());
+	processor.apply_negotiated(channel);
 }
 
 template <typename StreamType, typename CompletionToken>
@@ -289,7 +384,11 @@ boost::mysql::detail::async_handshake(
 {
 	using HandlerSignature = handshake_signature;
 	using HandlerType = BOOST_ASIO_HANDLER_TYPE(CompletionToken, HandlerSignature);
-	using BaseType = boost::beast::async_base<HandlerType, typename StreamType::executor_type>;
+	using BaseType = boost::beast::async_base<
+		HandlerType,
+		typename StreamType::executor_type,
+		recycling_allocator<void>
+	>;
 
 	boost::asio::async_completion<CompletionToken, HandlerSignature> initiator(token);
 
@@ -299,6 +398,7 @@ boost::mysql::detail::async_handshake(
 		handshake_processor processor_;
 		error_info info_;
 		error_info* output_info_;
+		latency_timer timer_;
 
 		Op(
 			HandlerType&& handler,
@@ -306,16 +406,22 @@ boost::mysql::detail::async_handshake(
 			const handshake_params& params,
 			error_info* output_info
 		):
-			BaseType(std::move(handler), channel.next_layer().get_executor()),
+			BaseType(std::move(handler), channel.next_layer().get_executor(), channel.operation_allocator()),
 			channel_(channel),
-			processor_(params),
-			output_info_(output_info)
+			processor_(params, is_ssl_stream<StreamType>::value),
+			output_info_(output_info),
+			timer_(channel.latency(), latency_operation::handshake)
 		{
 		}
 
+		void before_invoke_hook() override { timer_.finish(); }
+
 		void complete(bool cont, error_code code)
 		{
-			channel_.set_current_capabilities(processor_.negotiated_capabilities());
+			if (!code)
+			{
+				processor_.apply_negotiated(channel_);
+			}
 			conditional_assign(output_info_, std::move(info_));
 			BaseType::complete(cont, code);
 		}
@@ -344,6 +450,25 @@ boost::mysql::detail::async_handshake(
 					yield break;
 				}
 
+				// Upgrade to TLS, if negotiated. The handshake response goes encrypted
+				if (processor_.use_ssl())
+				{
+					yield channel_.async_write(processor_.compose_ssl_request(), std::move(*this));
+					if (err)
+					{
+						complete(cont, err);
+						yield break;
+					}
+
+					processor_.load_ssl_session(channel_);
+					yield channel_.async_ssl_handshake(std::move(*this));
+					if (err)
+					{
+						complete(cont, err);
+						yield break;
+					}
+				}
+
 				// Send
 				yield channel_.async_write(boost::asio::buffer(channel_.shared_buffer()), std::move(*this));
 				if (err)
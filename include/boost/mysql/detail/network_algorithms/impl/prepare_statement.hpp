@@ -12,6 +12,10 @@ class prepare_statement_processor
 {
 	channel<StreamType>& channel_;
 	com_stmt_prepare_ok_packet response_;
+
+	// Field definitions are kept by the statement, so they outlive any
+	// change to the connection's memory resource
+	resultset_metadata_builder metadata_builder_ {std::pmr::get_default_resource()};
 public:
 	prepare_statement_processor(channel<StreamType>& chan): channel_(chan) {}
 	void process_request(std::string_view statement)
@@ -49,8 +53,31 @@ public:
 
 	unsigned get_num_metadata_packets() const noexcept
 	{
+		// Omitted by the server if the resultset_metadata session variable is NONE
+		if (response_.metadata_follows.value == resultset_metadata_none) return 0;
 		return response_.num_columns.value + response_.num_params.value;
 	}
+
+	// Parameter definitions are ignored. Field definitions are kept, to be used
+	// by executions of the statement
+	void process_metadata_packet(unsigned index)
+	{
+		if (index >= response_.num_params.value)
+		{
+			if (metadata_builder_.num_packets() == 0) metadata_builder_.reserve(response_.num_columns.value);
+			metadata_builder_.add_packet(boost::asio::buffer(channel_.shared_buffer()));
+		}
+	}
+
+	error_code get_metadata(std::shared_ptr<const resultset_metadata>& output)
+	{
+		output.reset();
+		if (metadata_builder_.num_packets() == 0) return error_code();
+		resultset_metadata meta;
+		auto err = std::move(metadata_builder_).build(channel_.current_capabilities(), meta);
+		if (!err) output = std::make_shared<const resultset_metadata>(std::move(meta));
+		return err;
+	}
 };
 
 } // detail
@@ -66,32 +93,60 @@ void boost::mysql::detail::prepare_statement(
 	prepared_statement<StreamType>& output
 )
 {
+	latency_scope latency (channel.latency(), latency_operation::prepare_statement);
+
 	// Prepare message
+	channel.trace_start(traced_operation::prepare_statement, statement);
 	prepare_statement_processor<StreamType> processor (channel);
 	processor.process_request(statement);
 
 	// Write message
 	processor.get_channel().write(boost::asio::buffer(processor.get_buffer()), err);
-	if (err) return;
+	if (err)
+	{
+		channel.trace_error(err, info);
+		return;
+	}
 
 	// Read response
 	processor.get_channel().read(processor.get_buffer(), err);
-	if (err) return;
+	if (err)
+	{
+		channel.trace_error(err, info);
+		return;
+	}
+	channel.trace_first_byte();
 
 	// Process response
 	processor.process_response(err, info);
-	if (err) return;
+	if (err)
+	{
+		channel.trace_error(err, info);
+		return;
+	}
 
-	// Server sends now one packet per parameter and field.
-	// We ignore these for now. TODO: do sth useful with these
+	// Server sends now one packet per parameter and field
 	for (unsigned i = 0; i < processor.get_num_metadata_packets(); ++i)
 	{
 		processor.get_channel().read(processor.get_buffer(), err);
-		if (err) return;
+		if (err)
+		{
+			channel.trace_error(err, info);
+			return;
+		}
+		processor.process_metadata_packet(i);
 	}
+	std::shared_ptr<const resultset_metadata> metadata;
+	err = processor.get_metadata(metadata);
+	if (err)
+	{
+		channel.trace_error(err, info);
+		return;
+	}
+	channel.trace_metadata_complete(processor.get_num_metadata_packets());
 
 	// Compose response
-	output = prepared_statement<StreamType>(channel, processor.get_response());
+	output = prepared_statement<StreamType>(channel, processor.get_response(), std::move(metadata));
 }
 
 template <typename StreamType, typename CompletionToken>
@@ -108,7 +163,11 @@ boost::mysql::detail::async_prepare_statement(
 {
 	using HandlerSignature = prepare_statement_signature<StreamType>;
 	using HandlerType = BOOST_ASIO_HANDLER_TYPE(CompletionToken, HandlerSignature);
-	using BaseType = boost::beast::async_base<HandlerType, typename StreamType::executor_type>;
+	using BaseType = boost::beast::async_base<
+		HandlerType,
+		typename StreamType::executor_type,
+		recycling_allocator<void>
+	>;
 	using PreparedStatementType = prepared_statement<StreamType>;
 
 	boost::asio::async_completion<CompletionToken, HandlerSignature> initiator(token);
@@ -116,8 +175,9 @@ boost::mysql::detail::async_prepare_statement(
 	struct Op: BaseType, boost::asio::coroutine
 	{
 		prepare_statement_processor<StreamType> processor_;
-		unsigned remaining_meta_;
+		unsigned meta_index_;
 		error_info* output_info_;
+		latency_timer timer_;
 
 		Op(
 			HandlerType&& handler,
@@ -125,14 +185,18 @@ boost::mysql::detail::async_prepare_statement(
 			std::string_view statement,
 			error_info* output_info
 		):
-			BaseType(std::move(handler), channel.next_layer().get_executor()),
+			BaseType(std::move(handler), channel.next_layer().get_executor(), channel.operation_allocator()),
 			processor_(channel),
-			remaining_meta_(0),
-			output_info_(output_info)
+			meta_index_(0),
+			output_info_(output_info),
+			timer_(channel.latency(), latency_operation::prepare_statement)
 		{
+			channel.trace_start(traced_operation::prepare_statement, statement);
 			processor_.process_request(statement);
 		}
 
+		void before_invoke_hook() override { timer_.finish(); }
+
 		void operator()(
 			error_code err,
 			bool cont=true
@@ -148,6 +212,7 @@ boost::mysql::detail::async_prepare_statement(
 				);
 				if (err)
 				{
+					processor_.get_channel().trace_error(err, info);
 					this->complete(cont, err, PreparedStatementType());
 					yield break;
 				}
@@ -159,23 +224,24 @@ boost::mysql::detail::async_prepare_statement(
 				);
 				if (err)
 				{
+					processor_.get_channel().trace_error(err, info);
 					this->complete(cont, err, PreparedStatementType());
 					yield break;
 				}
+				processor_.get_channel().trace_first_byte();
 
 				// Process response
 				processor_.process_response(err, info);
 				if (err)
 				{
+					processor_.get_channel().trace_error(err, info);
 					detail::conditional_assign(output_info_, std::move(info));
 					this->complete(cont, err, PreparedStatementType());
 					yield break;
 				}
 
-				// Server sends now one packet per parameter and field.
-				// We ignore these for now. TODO: do sth useful with these
-				remaining_meta_ = processor_.get_num_metadata_packets();
-				for (; remaining_meta_ > 0; --remaining_meta_)
+				// Server sends now one packet per parameter and field
+				for (meta_index_ = 0; meta_index_ < processor_.get_num_metadata_packets(); ++meta_index_)
 				{
 					yield processor_.get_channel().async_read(
 						processor_.get_buffer(),
@@ -183,17 +249,30 @@ boost::mysql::detail::async_prepare_statement(
 					);
 					if (err)
 					{
+						processor_.get_channel().trace_error(err, info);
 						this->complete(cont, err, PreparedStatementType());
 						yield break;
 					}
+					processor_.process_metadata_packet(meta_index_);
 				}
 
 				// Compose response
-				this->complete(
-					cont,
-					err,
-					PreparedStatementType(processor_.get_channel(), processor_.get_response())
-				);
+				{
+					std::shared_ptr<const resultset_metadata> metadata;
+					err = processor_.get_metadata(metadata);
+					if (err)
+					{
+						processor_.get_channel().trace_error(err, info);
+						this->complete(cont, err, PreparedStatementType());
+						return;
+					}
+					processor_.get_channel().trace_metadata_complete(processor_.get_num_metadata_packets());
+					this->complete(
+						cont,
+						err,
+						PreparedStatementType(processor_.get_channel(), processor_.get_response(), std::move(metadata))
+					);
+				}
 			}
 		}
 	};
@@ -8,22 +8,21 @@ namespace boost {
 namespace mysql {
 namespace detail {
 
-inline read_row_result process_read_message(
-	deserialize_row_fn deserializer,
+// Processes a row, error or eof message. Rows are handled by row_handler,
+// with signature error_code(deserialization_context&)
+template <typename RowHandler>
+read_row_result process_read_message(
+	RowHandler&& row_handler,
 	capabilities current_capabilities,
-	const std::vector<field_metadata>& meta,
-	const bytestring& buffer,
-	std::vector<value>& output_values,
+	boost::asio::const_buffer buffer,
 	ok_packet& output_ok_packet,
 	error_code& err,
 	error_info& info
 )
 {
-	assert(deserializer);
-
 	// Message type: row, error or eof?
 	std::uint8_t msg_type;
-	deserialization_context ctx (boost::asio::buffer(buffer), current_capabilities);
+	deserialization_context ctx (buffer, current_capabilities);
 	std::tie(err, msg_type) = deserialize_message_type(ctx);
 	if (err) return read_row_result::error;
 	if (msg_type == eof_packet_header)
@@ -43,12 +42,36 @@ inline read_row_result process_read_message(
 	{
 		// An actual row
 		ctx.rewind(1); // keep the 'message type' byte, as it is part of the actual message
-		err = deserializer(ctx, meta, output_values);
+		err = row_handler(ctx);
 		if (err) return read_row_result::error;
 		return read_row_result::row;
 	}
 }
 
+inline read_row_result process_read_message(
+	deserialize_row_fn deserializer,
+	capabilities current_capabilities,
+	const resultset_metadata& meta,
+	boost::asio::const_buffer buffer,
+	std::pmr::vector<value>& output_values,
+	ok_packet& output_ok_packet,
+	error_code& err,
+	error_info& info
+)
+{
+	assert(deserializer);
+	return process_read_message(
+		[deserializer, &meta, &output_values](deserialization_context& ctx) {
+			return deserializer(ctx, meta, output_values);
+		},
+		current_capabilities,
+		buffer,
+		output_ok_packet,
+		err,
+		info
+	);
+}
+
 } // detail
 } // mysql
 } // boost
@@ -58,9 +81,9 @@ template <typename StreamType>
 boost::mysql::detail::read_row_result boost::mysql::detail::read_row(
 	deserialize_row_fn deserializer,
 	channel<StreamType>& channel,
-	const std::vector<field_metadata>& meta,
-	bytestring& buffer,
-	std::vector<value>& output_values,
+	const resultset_metadata& meta,
+	resource_bytestring& buffer,
+	std::pmr::vector<value>& output_values,
 	ok_packet& output_ok_packet,
 	error_code& err,
 	error_info& info
@@ -74,7 +97,7 @@ boost::mysql::detail::read_row_result boost::mysql::detail::read_row(
 		deserializer,
 		channel.current_capabilities(),
 		meta,
-		buffer,
+		boost::asio::buffer(buffer),
 		output_values,
 		output_ok_packet,
 		err,
@@ -91,36 +114,40 @@ BOOST_ASIO_INITFN_RESULT_TYPE(
 boost::mysql::detail::async_read_row(
 	deserialize_row_fn deserializer,
 	channel<StreamType>& chan,
-	const std::vector<field_metadata>& meta,
-	bytestring& buffer,
-	std::vector<value>& output_values,
+	const resultset_metadata& meta,
+	resource_bytestring& buffer,
+	std::pmr::vector<value>& output_values,
 	ok_packet& output_ok_packet,
 	CompletionToken&& token
 )
 {
 	using HandlerSignature = read_row_signature;
 	using HandlerType = BOOST_ASIO_HANDLER_TYPE(CompletionToken, HandlerSignature);
-	using BaseType = boost::beast::async_base<HandlerType, typename StreamType::executor_type>;
+	using BaseType = boost::beast::async_base<
+		HandlerType,
+		typename StreamType::executor_type,
+		recycling_allocator<void>
+	>;
 
 	struct Op: BaseType, boost::asio::coroutine
 	{
 		deserialize_row_fn deserializer_;
 		channel<StreamType>& channel_;
-		const std::vector<field_metadata>& meta_;
-		bytestring& buffer_;
-		std::vector<value>& output_values_;
+		const resultset_metadata& meta_;
+		resource_bytestring& buffer_;
+		std::pmr::vector<value>& output_values_;
 		ok_packet& output_ok_packet_;
 
 		Op(
 			HandlerType&& handler,
 			deserialize_row_fn deserializer,
 			channel<StreamType>& channel,
-			const std::vector<field_metadata>& meta,
-			bytestring& buffer,
-			std::vector<value>& output_values,
+			const resultset_metadata& meta,
+			resource_bytestring& buffer,
+			std::pmr::vector<value>& output_values,
 			ok_packet& output_ok_packet
 		):
-			BaseType(std::move(handler), channel.next_layer().get_executor()),
+			BaseType(std::move(handler), channel.next_layer().get_executor(), channel.operation_allocator()),
 			deserializer_(deserializer),
 			channel_(channel),
 			meta_(meta),
@@ -138,7 +165,7 @@ boost::mysql::detail::async_read_row(
 				deserializer_,
 				channel_.current_capabilities(),
 				meta_,
-				buffer_,
+				boost::asio::buffer(buffer_),
 				output_values_,
 				output_ok_packet_,
 				err,
@@ -21,9 +21,9 @@ template <typename StreamType>
 read_row_result read_row(
 	deserialize_row_fn deserializer,
 	channel<StreamType>& channel,
-	const std::vector<field_metadata>& meta,
-	bytestring& buffer,
-	std::vector<value>& output_values,
+	const resultset_metadata& meta,
+	resource_bytestring& buffer,
+	std::pmr::vector<value>& output_values,
 	ok_packet& output_ok_packet,
 	error_code& err,
 	error_info& info
@@ -36,9 +36,9 @@ BOOST_ASIO_INITFN_RESULT_TYPE(CompletionToken, read_row_signature)
 async_read_row(
 	deserialize_row_fn deserializer,
 	channel<StreamType>& channel,
-	const std::vector<field_metadata>& meta,
-	bytestring& buffer,
-	std::vector<value>& output_values,
+	const resultset_metadata& meta,
+	resource_bytestring& buffer,
+	std::pmr::vector<value>& output_values,
 	ok_packet& output_ok_packet,
 	CompletionToken&& token
 );
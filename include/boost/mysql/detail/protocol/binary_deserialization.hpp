@@ -17,10 +17,11 @@ inline errc deserialize_binary_value(
 	value& output
 );
 
+// Deserializes a row using the resultset's binary_row_plan
 inline error_code deserialize_binary_row(
 	deserialization_context& ctx,
-	const std::vector<field_metadata>& meta,
-	std::vector<value>& output
+	const resultset_metadata& meta,
+	std::pmr::vector<value>& output
 );
 
 } // detail
@@ -0,0 +1,40 @@
+#ifndef INCLUDE_BOOST_MYSQL_DETAIL_PROTOCOL_BINARY_ROW_PLAN_HPP_
+#define INCLUDE_BOOST_MYSQL_DETAIL_PROTOCOL_BINARY_ROW_PLAN_HPP_
+
+#include "boost/mysql/detail/protocol/serialization.hpp"
+#include "boost/mysql/detail/protocol/constants.hpp"
+#include "boost/mysql/error.hpp"
+#include "boost/mysql/value.hpp"
+#include <memory_resource>
+#include <vector>
+
+namespace boost {
+namespace mysql {
+namespace detail {
+
+// Deserializes a single, non-NULL binary protocol value of a given column type
+using binary_value_decoder = errc (*)(deserialization_context&, value&);
+
+// The decoders for each column in a binary resultset, in column order.
+// Column types do not change within a resultset, so this is computed
+// once when its metadata is received, rather than for every row.
+using binary_row_plan = std::pmr::vector<binary_value_decoder>;
+
+inline binary_value_decoder get_binary_value_decoder(
+	protocol_field_type type,
+	bool is_unsigned
+) noexcept;
+
+// Like get_binary_value_decoder, but the returned function just advances
+// past the value, setting the output to NULL. Used for projected out columns.
+inline binary_value_decoder get_binary_value_skipper(
+	protocol_field_type type
+) noexcept;
+
+} // detail
+} // mysql
+} // boost
+
+#include "boost/mysql/detail/protocol/impl/binary_row_plan.ipp"
+
+#endif /* INCLUDE_BOOST_MYSQL_DETAIL_PROTOCOL_BINARY_ROW_PLAN_HPP_ */
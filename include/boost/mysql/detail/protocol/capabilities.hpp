@@ -35,6 +35,7 @@ constexpr std::uint32_t CLIENT_SESSION_TRACK = (1UL << 23); // Capable of handli
 constexpr std::uint32_t CLIENT_DEPRECATE_EOF = (1UL << 24); // Client no longer needs EOF_Packet and will use OK_Packet instead
 constexpr std::uint32_t CLIENT_SSL_VERIFY_SERVER_CERT = (1UL << 30); // Verify server certificate
 constexpr std::uint32_t CLIENT_OPTIONAL_RESULTSET_METADATA = (1UL << 25); // The client can handle optional metadata information in the resultset
+constexpr std::uint32_t CLIENT_ZSTD_COMPRESSION_ALGORITHM = (1UL << 26); // Compression protocol extended to support zstd
 constexpr std::uint32_t CLIENT_REMEMBER_OPTIONS = (1UL << 31); // Don't reset the options after an unsuccessful connect
 
 class capabilities
@@ -79,7 +80,7 @@ public:
 * CLIENT_SESSION_TRACK: unset //  Capable of handling server state change information
 * CLIENT_DEPRECATE_EOF: mandatory //  Client no longer needs EOF_Packet and will use OK_Packet instead
 * CLIENT_SSL_VERIFY_SERVER_CERT: unset //  Verify server certificate
-* CLIENT_OPTIONAL_RESULTSET_METADATA: unset //  The client can handle optional metadata information in the resultset
+* CLIENT_OPTIONAL_RESULTSET_METADATA: optional //  The client can handle optional metadata information in the resultset
 * CLIENT_REMEMBER_OPTIONS: unset //  Don't reset the options after an unsuccessful connect
 *
 * We pay attention to:
@@ -88,6 +89,7 @@ public:
 * CLIENT_PLUGIN_AUTH: mandatory //  Client supports plugin authentication
 * CLIENT_PLUGIN_AUTH_LENENC_CLIENT_DATA: mandatory //  Enable authentication response packet to be larger than 255 bytes
 * CLIENT_DEPRECATE_EOF: mandatory //  Client no longer needs EOF_Packet and will use OK_Packet instead
+* CLIENT_OPTIONAL_RESULTSET_METADATA: optional //  The client can handle optional metadata information in the resultset
  */
 
 constexpr capabilities mandatory_capabilities {
@@ -98,7 +100,9 @@ constexpr capabilities mandatory_capabilities {
 	CLIENT_SECURE_CONNECTION
 };
 
-constexpr capabilities optional_capabilities {0};
+constexpr capabilities optional_capabilities {
+	CLIENT_OPTIONAL_RESULTSET_METADATA
+};
 
 } // detail
 } // mysql
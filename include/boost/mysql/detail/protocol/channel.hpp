@@ -2,11 +2,21 @@
 #define MYSQL_ASIO_IMPL_CHANNEL_HPP
 
 #include "boost/mysql/error.hpp"
+#include "boost/mysql/connection_stats.hpp"
+#include "boost/mysql/connection_observer.hpp"
 #include "boost/mysql/detail/auxiliar/bytestring.hpp"
+#include "boost/mysql/detail/auxiliar/latency_timer.hpp"
+#include "boost/mysql/detail/auxiliar/read_buffer.hpp"
+#include "boost/mysql/detail/auxiliar/recycling_allocator.hpp"
+#include "boost/mysql/detail/auxiliar/ssl_stream.hpp"
 #include "boost/mysql/detail/protocol/capabilities.hpp"
+#include "boost/mysql/detail/protocol/compression.hpp"
 #include <boost/asio/buffer.hpp>
 #include <boost/asio/async_result.hpp>
 #include <array>
+#include <cassert>
+#include <memory>
+#include <memory_resource>
 
 namespace boost {
 namespace mysql {
@@ -20,31 +30,119 @@ class channel
 	AsyncStream& next_layer_;
 	std::uint8_t sequence_number_ {0};
 	std::array<std::uint8_t, 4> header_buffer_ {}; // for async ops
-	bytestring shared_buff_; // for async ops
+	read_buffer read_buffer_; // read-ahead buffer, so we can get many packets per read
+	resource_bytestring shared_buff_; // for async ops
 	capabilities current_caps_;
+	std::unique_ptr<compression_state> compression_; // null unless compression has been negotiated
+	bool ssl_active_ {false}; // only for SSL streams, after the TLS handshake
+	std::size_t frame_remaining_ {0}; // incremental packet reads: bytes of the current frame yet to be read
+	bool frame_more_ {false}; // incremental packet reads: whether more frames follow the current one
+	std::pmr::memory_resource* memory_resource_; // for the resultsets of subsequent requests
+	recycling_memory operation_memory_; // for the state of composed async operations
+	connection_stats stats_; // capacities are filled on demand by stats()
+	latency_tracker latency_; // stream time is measured from with_stream() to record_read()/record_write()
+	connection_observer* observer_ {nullptr};
+	trace_event trace_; // operation and statement ID of the last started operation
+
+	// Invokes f with the stream to read from and write to: the SSL stream itself once TLS
+	// is active, and its next layer before that. For other streams, always next_layer_.
+	template <typename Function>
+	decltype(auto) with_stream(Function&& f);
 
 	bool process_sequence_number(std::uint8_t got);
 	std::uint8_t next_sequence_number() { return sequence_number_++; }
 
-	error_code process_header_read(std::uint32_t& size_to_read); // reads from header_buffer_
+	error_code process_header_read(std::uint32_t& size_to_read); // reads from read_buffer_
 	void process_header_write(std::uint32_t size_to_write); // writes to header_buffer_
+	void read_some_into_buffer(error_code& code); // reads as many bytes as available into read_buffer_
+	void read_compressed_frame(error_code& code); // reads and decompresses a frame into compression_
+	void read_frame_header(error_code& code); // for incremental packet reads
+
+	template <typename CompletionToken>
+	BOOST_ASIO_INITFN_RESULT_TYPE(CompletionToken, void(error_code, std::size_t))
+	async_read_some_into_buffer(CompletionToken&& token);
+
+	// Packets as they should be sent through the stream
+	boost::asio::const_buffer prepare_compressed_write(boost::asio::const_buffer message);
+
+	template <typename CompletionToken>
+	BOOST_ASIO_INITFN_RESULT_TYPE(CompletionToken, void(error_code))
+	async_write_raw(boost::asio::const_buffer buffer, CompletionToken&& token);
+
+	// Statistics
+	void record_read(std::size_t bytes) noexcept { latency_.io_end(); ++stats_.read_calls; stats_.bytes_read += bytes; }
+	void record_write(std::size_t bytes) noexcept { latency_.io_end(); stats_.bytes_written += bytes; }
+	void record_packet_read(bool multiframe) noexcept;
+	void record_packets_written(boost::asio::const_buffer framed_packets) noexcept;
+	void record_packet_written(std::size_t size) noexcept;
+
+	// Fills in the event-specific fields of trace_
+	const trace_event& current_trace_event() noexcept
+	{
+		trace_.time = std::chrono::steady_clock::now();
+		trace_.bytes_read = stats_.bytes_read;
+		trace_.bytes_written = stats_.bytes_written;
+		return trace_;
+	}
+
+	// Makes room for size more bytes at the end of buffer, counting reallocations
+	template <typename Buffer>
+	void grow_buffer(Buffer& buffer, std::size_t size);
 public:
-	channel(AsyncStream& stream): next_layer_ {stream} {};
+	channel(AsyncStream& stream, std::size_t read_buffer_size = default_read_buffer_size):
+		next_layer_ {stream},
+		read_buffer_(read_buffer_size),
+		memory_resource_(std::pmr::get_default_resource()) {};
 
-	template <typename Allocator>
-	void read(basic_bytestring<Allocator>& buffer, error_code& code);
+	// Buffer is a basic_bytestring, or any type with the same data(), size(), capacity(),
+	// clear() and resize() members, like row_batch::packet_buffer
+	template <typename Buffer>
+	void read(Buffer& buffer, error_code& code);
 
 	void write(boost::asio::const_buffer buffer, error_code& code);
 
-	template <typename Allocator, typename CompletionToken>
+	template <typename Buffer, typename CompletionToken>
 	BOOST_ASIO_INITFN_RESULT_TYPE(CompletionToken, void(error_code))
-	async_read(basic_bytestring<Allocator>& buffer, CompletionToken&& token);
+	async_read(Buffer& buffer, CompletionToken&& token);
 
 	template <typename CompletionToken>
 	BOOST_ASIO_INITFN_RESULT_TYPE(CompletionToken, void(error_code))
 	async_write(boost::asio::const_buffer buffer, CompletionToken&& token);
 
-	void reset_sequence_number(std::uint8_t value = 0) { sequence_number_ = value; }
+	// Incremental reading of a single packet, for packets too big to be held in memory.
+	// begin_read_packet() reads the header and returns the size of the first frame.
+	// read_packet_some() then reads the packet body piece by piece, crossing frame
+	// boundaries transparently. It reads at least one byte, unless the packet has
+	// been completely read, in which case it returns zero.
+	std::size_t begin_read_packet(error_code& code);
+
+	template <typename CompletionToken>
+	BOOST_ASIO_INITFN_RESULT_TYPE(CompletionToken, void(error_code, std::size_t))
+	async_begin_read_packet(CompletionToken&& token);
+
+	std::size_t read_packet_some(boost::asio::mutable_buffer buffer, error_code& code);
+
+	template <typename CompletionToken>
+	BOOST_ASIO_INITFN_RESULT_TYPE(CompletionToken, void(error_code, std::size_t))
+	async_read_packet_some(boost::asio::mutable_buffer buffer, CompletionToken&& token);
+
+	bool packet_complete() const noexcept { return frame_remaining_ == 0 && !frame_more_; }
+
+	// Writes a buffer that already contains whole packets (as generated by append_framed).
+	// Does not use nor modify the sequence number. With compression, each command
+	// (i.e. packets from one with sequence number zero) is sent in its own frames.
+	void write_framed(boost::asio::const_buffer buffer, error_code& code);
+
+	template <typename CompletionToken>
+	BOOST_ASIO_INITFN_RESULT_TYPE(CompletionToken, void(error_code))
+	async_write_framed(boost::asio::const_buffer buffer, CompletionToken&& token);
+
+	// Also resets the frame sequence number, if compression is enabled
+	void reset_sequence_number(std::uint8_t value = 0)
+	{
+		sequence_number_ = value;
+		if (compression_) compression_->sequence_number = value;
+	}
 	std::uint8_t sequence_number() const { return sequence_number_; }
 
 	using stream_type = AsyncStream;
@@ -53,10 +151,90 @@ public:
 	capabilities current_capabilities() const noexcept { return current_caps_; }
 	void set_current_capabilities(capabilities value) noexcept { current_caps_ = value; }
 
-	const bytestring& shared_buffer() const noexcept { return shared_buff_; }
-	bytestring& shared_buffer() noexcept { return shared_buff_; }
+	// Performs the TLS handshake over the current connection. From now on,
+	// reads and writes are encrypted. Only valid for SSL streams.
+	void ssl_handshake(error_code& code);
+
+	template <typename CompletionToken>
+	BOOST_ASIO_INITFN_RESULT_TYPE(CompletionToken, void(error_code))
+	async_ssl_handshake(CompletionToken&& token);
+
+	bool ssl_active() const noexcept { return ssl_active_; }
+
+	// From now on, use the compressed protocol for all reads and writes
+	void enable_compression(compression_algorithm algo, std::size_t threshold);
+	bool compression_enabled() const noexcept { return compression_ != nullptr; }
+
+	// Bytes that have been read from the stream (and decompressed, if applicable) but not yet consumed
+	std::size_t pending_read_size() const noexcept { return read_buffer_.pending_size(); }
+
+	const resource_bytestring& shared_buffer() const noexcept { return shared_buff_; }
+	resource_bytestring& shared_buffer() noexcept { return shared_buff_; }
+
+	// Where resultsets created from now on allocate their metadata and rows
+	std::pmr::memory_resource* memory_resource() const noexcept { return memory_resource_; }
+	void set_memory_resource(std::pmr::memory_resource* value) noexcept { assert(value); memory_resource_ = value; }
+
+	// I/O statistics since the channel was created
+	connection_stats stats() const noexcept
+	{
+		connection_stats res = stats_;
+		res.read_buffer_capacity = read_buffer_.capacity();
+		res.shared_buffer_capacity = shared_buff_.capacity();
+		return res;
+	}
+
+	// Where network algorithms record their latency
+	latency_tracker& latency() noexcept { return latency_; }
+	const latency_tracker& latency() const noexcept { return latency_; }
+
+	// Tracing. Without an observer, each of these is a single branch
+	connection_observer* observer() const noexcept { return observer_; }
+	void set_observer(connection_observer* value) noexcept { observer_ = value; }
+	void trace_start(traced_operation op, std::string_view sql, std::uint32_t statement_id = 0)
+	{
+		if (!observer_) return;
+		trace_.operation = op;
+		trace_.statement_id = statement_id;
+		observer_->on_query_start(current_trace_event(), sql);
+	}
+	// Makes subsequent events belong to an operation that has already started,
+	// like a pipelined request whose response is about to be read
+	void trace_resume(traced_operation op, std::uint32_t statement_id) noexcept
+	{
+		trace_.operation = op;
+		trace_.statement_id = statement_id;
+	}
+	void trace_first_byte() { if (observer_) observer_->on_first_byte(current_trace_event()); }
+	void trace_metadata_complete(std::size_t num_fields)
+	{
+		if (observer_) observer_->on_metadata_complete(current_trace_event(), num_fields);
+	}
+	void trace_row_batch(std::size_t num_rows) { if (observer_) observer_->on_row_batch(current_trace_event(), num_rows); }
+	void trace_resultset_complete(std::uint64_t affected_rows)
+	{
+		if (observer_) observer_->on_resultset_complete(current_trace_event(), affected_rows);
+	}
+	void trace_error(const error_code& err, const error_info& info)
+	{
+		if (observer_) observer_->on_error(current_trace_event(), err, info);
+	}
+
+	// Default allocator for the state of composed async operations on this channel,
+	// used when the completion handler has no associated allocator
+	recycling_allocator<void> operation_allocator() noexcept { return recycling_allocator<void>(operation_memory_); }
 };
 
+// Appends message to output split in packets with their headers, as channel::write
+// would send it, starting with sequence number seqnum. Returns the sequence number
+// following the last packet. Used to send several messages in a single write_framed() call.
+template <typename Allocator>
+std::uint8_t append_framed(
+	boost::asio::const_buffer message,
+	std::uint8_t seqnum,
+	basic_bytestring<Allocator>& output
+);
+
 template <typename ChannelType>
 using channel_stream_type = typename ChannelType::stream_type;
 
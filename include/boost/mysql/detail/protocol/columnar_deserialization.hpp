@@ -0,0 +1,55 @@
+#ifndef INCLUDE_BOOST_MYSQL_DETAIL_PROTOCOL_COLUMNAR_DESERIALIZATION_HPP_
+#define INCLUDE_BOOST_MYSQL_DETAIL_PROTOCOL_COLUMNAR_DESERIALIZATION_HPP_
+
+#include "boost/mysql/detail/protocol/serialization.hpp"
+#include "boost/mysql/column_batch.hpp"
+#include "boost/mysql/error.hpp"
+#include "boost/mysql/metadata.hpp"
+#include <memory_resource>
+#include <string_view>
+
+namespace boost {
+namespace mysql {
+namespace detail {
+
+// Decodes a single, non-NULL text protocol value, appending it to output
+inline errc deserialize_text_value(
+	std::string_view from,
+	const field_metadata& meta,
+	column& output
+);
+
+// Decodes a single, non-NULL binary protocol value of a given field, appending it to a column
+using column_value_decoder = errc (*)(deserialization_context&, column&);
+
+// The decoders for each field in a binary resultset, in field order. Field types
+// are the same for all the rows in a batch, so this is computed once per batch,
+// rather than switching on each value's type.
+using binary_columnar_plan = std::pmr::vector<column_value_decoder>;
+
+inline column_value_decoder get_column_value_decoder(
+	const field_metadata& meta
+) noexcept;
+
+inline binary_columnar_plan make_binary_columnar_plan(
+	const std::pmr::vector<field_metadata>& fields,
+	std::pmr::memory_resource* resource = std::pmr::get_default_resource()
+);
+
+// Decodes a (text or binary) row message, appending a value to each of
+// output's columns. binary_plan is nullptr for text rows, and the plan
+// for meta's fields for binary ones. On error, output is left as it was before the call.
+inline error_code deserialize_columnar_row(
+	deserialization_context& ctx,
+	const resultset_metadata& meta,
+	const binary_columnar_plan* binary_plan,
+	column_batch& output
+);
+
+} // detail
+} // mysql
+} // boost
+
+#include "boost/mysql/detail/protocol/impl/columnar_deserialization.ipp"
+
+#endif /* INCLUDE_BOOST_MYSQL_DETAIL_PROTOCOL_COLUMNAR_DESERIALIZATION_HPP_ */
@@ -0,0 +1,143 @@
+#ifndef INCLUDE_BOOST_MYSQL_DETAIL_PROTOCOL_COMPRESSION_HPP_
+#define INCLUDE_BOOST_MYSQL_DETAIL_PROTOCOL_COMPRESSION_HPP_
+
+#include "boost/mysql/compression.hpp"
+#include "boost/mysql/error.hpp"
+#include "boost/mysql/detail/auxiliar/bytestring.hpp"
+#include "boost/mysql/detail/auxiliar/read_buffer.hpp"
+#include "boost/mysql/detail/protocol/serialization.hpp"
+#include "boost/mysql/detail/protocol/protocol_types.hpp"
+#include "boost/mysql/detail/protocol/constants.hpp"
+#include <boost/asio/buffer.hpp>
+
+namespace boost {
+namespace mysql {
+namespace detail {
+
+// Header preceding each frame in the compressed protocol.
+// A frame payload contains one or more regular packets (or pieces of them),
+// with their own headers.
+struct compressed_frame_header
+{
+	int3 compressed_size; // size of the payload, as sent through the network
+	int1 sequence_number;
+	int3 uncompressed_size; // 0 if the payload has been sent uncompressed
+};
+
+template <>
+struct get_struct_fields<compressed_frame_header>
+{
+	static constexpr auto value = std::make_tuple(
+		&compressed_frame_header::compressed_size,
+		&compressed_frame_header::sequence_number,
+		&compressed_frame_header::uncompressed_size
+	);
+};
+
+constexpr std::size_t compressed_frame_header_size = 7;
+
+// Number of frames compressor::append_frames splits uncompressed_size bytes into
+constexpr std::uint8_t num_compressed_frames(std::size_t uncompressed_size) noexcept
+{
+	return static_cast<std::uint8_t>(
+		uncompressed_size == 0 ? 1 : (uncompressed_size + MAX_PACKET_SIZE - 1) / MAX_PACKET_SIZE);
+}
+
+// zstd compression level sent in the handshake response
+constexpr std::uint8_t default_zstd_compression_level = 3;
+
+// Whether this build is able to use the given algorithm
+constexpr bool is_compression_available([[maybe_unused]] compression_algorithm algo) noexcept
+{
+#ifdef BOOST_MYSQL_HAS_ZSTD
+	return true;
+#else
+	return algo != compression_algorithm::zstd;
+#endif
+}
+
+// Compresses and decompresses frame payloads
+class compressor
+{
+	compression_algorithm algo_;
+	std::size_t threshold_;
+
+	// Compresses input into output, which must have at least max_compressed_size(input) bytes.
+	// Returns the compressed size, or 0 if compression failed.
+	std::size_t compress(boost::asio::const_buffer input, std::uint8_t* output) const noexcept;
+	std::size_t max_compressed_size(std::size_t input_size) const noexcept;
+public:
+	compressor(compression_algorithm algo, std::size_t threshold) noexcept:
+		algo_(algo), threshold_(threshold) {}
+
+	compression_algorithm algorithm() const noexcept { return algo_; }
+	std::size_t threshold() const noexcept { return threshold_; }
+
+	// Appends to output the given bytes (one or more whole packets, with their headers),
+	// split in as many frames as required, with sequence numbers starting at seqnum.
+	// Frames smaller than the threshold, or not worth compressing, are sent uncompressed.
+	void append_frames(
+		boost::asio::const_buffer uncompressed,
+		std::uint8_t seqnum,
+		bytestring& output
+	) const;
+
+	// Decompresses a frame payload into output, which must have exactly
+	// the uncompressed size announced by the frame header
+	error_code decompress(
+		boost::asio::const_buffer payload,
+		boost::asio::mutable_buffer output
+	) const noexcept;
+};
+
+// Everything a channel requires to use the compressed protocol.
+// Only allocated for connections where compression has been negotiated.
+// As libmysql does, frames carry their own sequence number, which is checked
+// on every read and restarts with every command. The sequence numbers
+// of the packets within frames are not checked.
+struct compression_state
+{
+	compressor comp;
+	std::uint8_t sequence_number {0}; // of the next frame, read or written
+	read_buffer raw_buffer; // bytes read from the stream but not processed yet
+	bytestring frame_payload; // payload of the frame being read
+	bytestring decompressed; // decompressed bytes not yet moved to the channel's read buffer
+	std::size_t decompressed_offset {0};
+	bytestring uncompressed_write; // packets to be compressed
+	bytestring frames_write; // compressed frames to be written
+
+	compression_state(compression_algorithm algo, std::size_t threshold, std::size_t buffer_size):
+		comp(algo, threshold), raw_buffer(buffer_size) {}
+
+	std::size_t decompressed_pending() const noexcept { return decompressed.size() - decompressed_offset; }
+
+	// Reads a frame header from raw_buffer, which must contain at least
+	// compressed_frame_header_size bytes, and checks its sequence number.
+	// Prepares frame_payload to hold the payload and copies any payload bytes
+	// already present in raw_buffer. Sets remaining to the number of payload
+	// bytes yet to be read.
+	error_code process_frame_header(std::uint32_t& uncompressed_size, std::size_t& remaining);
+
+	// Decompresses frame_payload into decompressed
+	error_code process_frame_payload(std::uint32_t uncompressed_size);
+
+	// Moves as many decompressed bytes as possible into to
+	void move_decompressed(read_buffer& to) noexcept;
+
+	// Compresses the given packets, which belong to the current command, advancing
+	// sequence_number. The returned buffer is valid until the next call.
+	boost::asio::const_buffer prepare_write(boost::asio::const_buffer packets);
+
+	// Compresses the given packets, which belong to several commands (i.e. each
+	// packet with sequence number zero starts a new one). The frames of each command
+	// start with sequence number zero. The returned buffer is valid until the next call.
+	boost::asio::const_buffer prepare_write_commands(boost::asio::const_buffer packets);
+};
+
+} // detail
+} // mysql
+} // boost
+
+#include "boost/mysql/detail/protocol/impl/compression.hpp"
+
+#endif /* INCLUDE_BOOST_MYSQL_DETAIL_PROTOCOL_COMPRESSION_HPP_ */
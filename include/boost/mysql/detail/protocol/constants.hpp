@@ -64,6 +64,11 @@ constexpr std::uint8_t ok_packet_header = 0x00;
 constexpr std::uint8_t eof_packet_header = 0xfe;
 constexpr std::uint8_t auth_switch_request_header = 0xfe;
 
+// Values of the metadata_follows field, sent when CLIENT_OPTIONAL_RESULTSET_METADATA
+// has been negotiated, depending on the resultset_metadata session variable
+constexpr std::uint8_t resultset_metadata_none = 0;
+constexpr std::uint8_t resultset_metadata_full = 1;
+
 // Column flags
 namespace column_flags
 {
@@ -55,6 +55,7 @@ struct handshake_response_packet
 	string_null database; // only to be serialized if CLIENT_CONNECT_WITH_DB
 	string_null client_plugin_name; // we require CLIENT_PLUGIN_AUTH
 	// TODO: CLIENT_CONNECT_ATTRS
+	int1 zstd_compression_level; // only to be serialized if CLIENT_ZSTD_COMPRESSION_ALGORITHM
 };
 
 template <>
@@ -67,7 +68,8 @@ struct get_struct_fields<handshake_response_packet>
 		&handshake_response_packet::username,
 		&handshake_response_packet::auth_response,
 		&handshake_response_packet::database,
-		&handshake_response_packet::client_plugin_name
+		&handshake_response_packet::client_plugin_name,
+		&handshake_response_packet::zstd_compression_level
 	);
 };
 
@@ -79,6 +81,27 @@ struct serialization_traits<handshake_response_packet, serialization_tag::struct
 	static inline void serialize_(const handshake_response_packet& value, serialization_context& ctx) noexcept;
 };
 
+// SSL request: sent instead of the handshake response to upgrade the connection to TLS.
+// The actual handshake response is sent afterwards, over the encrypted channel
+struct ssl_request_packet
+{
+	int4 client_flag; // capabilities, must include CLIENT_SSL
+	int4 max_packet_size;
+	int1 character_set;
+	string_fixed<23> filler; // All 0s.
+};
+
+template <>
+struct get_struct_fields<ssl_request_packet>
+{
+	static constexpr auto value = std::make_tuple(
+		&ssl_request_packet::client_flag,
+		&ssl_request_packet::max_packet_size,
+		&ssl_request_packet::character_set,
+		&ssl_request_packet::filler
+	);
+};
+
 // auth switch request
 struct auth_switch_request_packet
 {
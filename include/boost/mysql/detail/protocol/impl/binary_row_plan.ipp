@@ -0,0 +1,147 @@
+#ifndef INCLUDE_BOOST_MYSQL_DETAIL_PROTOCOL_IMPL_BINARY_ROW_PLAN_IPP_
+#define INCLUDE_BOOST_MYSQL_DETAIL_PROTOCOL_IMPL_BINARY_ROW_PLAN_IPP_
+
+#include "boost/mysql/detail/auxiliar/tmp.hpp"
+
+namespace boost {
+namespace mysql {
+namespace detail {
+
+template <typename DeserializableType>
+errc decode_binary_value(
+	deserialization_context& ctx,
+	value& output
+)
+{
+	DeserializableType protocol_value;
+	auto err = deserialize(protocol_value, ctx);
+	if (err == errc::ok)
+	{
+		if constexpr (std::is_constructible_v<value, DeserializableType>) // not a value holder
+		{
+			output = protocol_value;
+		}
+		else if constexpr (is_one_of_v<DeserializableType, int1, int2>)
+		{
+			// regular promotion would make this int32_t. Force it be uint32_t
+			output = std::uint32_t(protocol_value.value);
+		}
+		else
+		{
+			output = protocol_value.value;
+		}
+	}
+	return err;
+}
+
+template <std::size_t Size>
+errc skip_fixed_binary_value(
+	deserialization_context& ctx,
+	value& output
+)
+{
+	if (!ctx.enough_size(Size)) return errc::incomplete_message;
+	ctx.advance(Size);
+	output = nullptr;
+	return errc::ok;
+}
+
+// Length-prefixed values: strings, dates and times
+template <typename DeserializableType>
+errc skip_binary_value(
+	deserialization_context& ctx,
+	value& output
+)
+{
+	DeserializableType length;
+	auto err = deserialize(length, ctx);
+	if (err != errc::ok) return err;
+	if (length.value > ctx.size()) return errc::incomplete_message;
+	ctx.advance(static_cast<std::size_t>(length.value));
+	output = nullptr;
+	return errc::ok;
+}
+
+template <typename SignedType, typename UnsignedType>
+binary_value_decoder get_int_binary_value_decoder(
+	bool is_unsigned
+) noexcept
+{
+	return is_unsigned ? &decode_binary_value<UnsignedType> : &decode_binary_value<SignedType>;
+}
+
+} // detail
+} // mysql
+} // boost
+
+inline boost::mysql::detail::binary_value_decoder boost::mysql::detail::get_binary_value_decoder(
+	protocol_field_type type,
+	bool is_unsigned
+) noexcept
+{
+	switch (type)
+	{
+    case protocol_field_type::tiny:
+    	return get_int_binary_value_decoder<int1_signed, int1>(is_unsigned);
+    case protocol_field_type::short_:
+    case protocol_field_type::year:
+    	return get_int_binary_value_decoder<int2_signed, int2>(is_unsigned);
+    case protocol_field_type::int24:
+    case protocol_field_type::long_:
+    	return get_int_binary_value_decoder<int4_signed, int4>(is_unsigned);
+    case protocol_field_type::longlong:
+    	return get_int_binary_value_decoder<int8_signed, int8>(is_unsigned);
+    case protocol_field_type::float_:
+    	return &decode_binary_value<float>;
+    case protocol_field_type::double_:
+    	return &decode_binary_value<double>;
+    case protocol_field_type::timestamp:
+    case protocol_field_type::datetime:
+    	return &decode_binary_value<datetime>;
+    case protocol_field_type::date:
+    	return &decode_binary_value<date>;
+    case protocol_field_type::time:
+    	return &decode_binary_value<time>;
+    // True string types
+    case protocol_field_type::varchar:
+    case protocol_field_type::var_string:
+    case protocol_field_type::string:
+    case protocol_field_type::tiny_blob:
+    case protocol_field_type::medium_blob:
+    case protocol_field_type::long_blob:
+    case protocol_field_type::blob:
+    case protocol_field_type::enum_:
+    case protocol_field_type::set:
+    // Anything else that we do not know how to interpret, we return as a binary string
+    case protocol_field_type::decimal:
+    case protocol_field_type::bit:
+    case protocol_field_type::newdecimal:
+    case protocol_field_type::geometry:
+    default:
+    	return &decode_binary_value<string_lenenc>;
+	}
+}
+
+inline boost::mysql::detail::binary_value_decoder boost::mysql::detail::get_binary_value_skipper(
+	protocol_field_type type
+) noexcept
+{
+	switch (type)
+	{
+	case protocol_field_type::tiny: return &skip_fixed_binary_value<1>;
+	case protocol_field_type::short_:
+	case protocol_field_type::year: return &skip_fixed_binary_value<2>;
+	case protocol_field_type::int24:
+	case protocol_field_type::long_:
+	case protocol_field_type::float_: return &skip_fixed_binary_value<4>;
+	case protocol_field_type::longlong:
+	case protocol_field_type::double_: return &skip_fixed_binary_value<8>;
+	case protocol_field_type::timestamp:
+	case protocol_field_type::datetime:
+	case protocol_field_type::date:
+	case protocol_field_type::time: return &skip_binary_value<int1>;
+	default: return &skip_binary_value<int_lenenc>;
+	}
+}
+
+#endif /* INCLUDE_BOOST_MYSQL_DETAIL_PROTOCOL_IMPL_BINARY_ROW_PLAN_IPP_ */
@@ -3,7 +3,10 @@
 
 #include <boost/asio/read.hpp>
 #include <boost/asio/write.hpp>
+#include <boost/asio/post.hpp>
 #include <boost/beast/core/async_base.hpp>
+#include <boost/beast/core/bind_handler.hpp>
+#include <algorithm>
 #include <cassert>
 #include "boost/mysql/detail/protocol/common_messages.hpp"
 #include "boost/mysql/detail/protocol/constants.hpp"
@@ -28,6 +31,38 @@ inline std::uint32_t compute_size_to_write(
 } // mysql
 } // boost
 
+template <typename Allocator>
+std::uint8_t boost::mysql::detail::append_framed(
+	boost::asio::const_buffer message,
+	std::uint8_t seqnum,
+	basic_bytestring<Allocator>& output
+)
+{
+	constexpr std::size_t header_size = 4;
+	auto first = static_cast<const std::uint8_t*>(message.data());
+	std::size_t transferred_size = 0;
+	std::size_t num_packets = message.size() / MAX_PACKET_SIZE + 1;
+	output.reserve(output.size() + message.size() + num_packets * header_size);
+
+	// If the packet is empty, we should still write the header, saying
+	// we are sending an empty packet.
+	do
+	{
+		auto size_to_write = compute_size_to_write(message.size(), transferred_size);
+		packet_header header;
+		header.packet_size.value = size_to_write;
+		header.sequence_number.value = seqnum++;
+		std::size_t offset = output.size();
+		output.resize(offset + header_size);
+		serialization_context ctx (capabilities(0), output.data() + offset); // capabilities not relevant here
+		serialize(header, ctx);
+		output.insert(output.end(), first + transferred_size, first + transferred_size + size_to_write);
+		transferred_size += size_to_write;
+	} while (transferred_size < message.size());
+
+	return seqnum;
+}
+
 template <typename AsyncStream>
 bool boost::mysql::detail::channel<AsyncStream>::process_sequence_number(
 	std::uint8_t got
@@ -49,11 +84,15 @@ boost::mysql::error_code boost::mysql::detail::channel<AsyncStream>::process_hea
 	std::uint32_t& size_to_read
 )
 {
+	// The caller must have made sure there are enough bytes in read_buffer_
 	packet_header header;
-	deserialization_context ctx (boost::asio::buffer(header_buffer_), capabilities(0)); // unaffected by capabilities
+	deserialization_context ctx (read_buffer_.pending(), capabilities(0)); // unaffected by capabilities
 	[[maybe_unused]] errc err = deserialize(header, ctx);
 	assert(err == errc::ok); // this should always succeed
-	if (!process_sequence_number(header.sequence_number.value))
+	read_buffer_.consume(header_buffer_.size());
+
+	// With compression, frames carry the sequence numbers that get checked
+	if (!compression_ && !process_sequence_number(header.sequence_number.value))
 	{
 		return make_error_code(errc::sequence_number_mismatch);
 	}
@@ -74,36 +113,462 @@ void boost::mysql::detail::channel<AsyncStream>::process_header_write(
 }
 
 template <typename AsyncStream>
-template <typename Allocator>
+void boost::mysql::detail::channel<AsyncStream>::record_packet_read(
+	bool multiframe
+) noexcept
+{
+	++stats_.packets_read;
+	if (multiframe) ++stats_.multiframe_packets_read;
+}
+
+template <typename AsyncStream>
+void boost::mysql::detail::channel<AsyncStream>::record_packet_written(
+	std::size_t size
+) noexcept
+{
+	++stats_.packets_written;
+	if (size >= MAX_PACKET_SIZE) ++stats_.multiframe_packets_written;
+}
+
+template <typename AsyncStream>
+void boost::mysql::detail::channel<AsyncStream>::record_packets_written(
+	boost::asio::const_buffer framed_packets
+) noexcept
+{
+	// A packet ends with the first frame shorter than MAX_PACKET_SIZE
+	auto first = static_cast<const std::uint8_t*>(framed_packets.data());
+	auto last = first + framed_packets.size();
+	std::size_t packet_frames = 0;
+	while (last - first >= 4)
+	{
+		std::size_t frame_size = first[0] | (first[1] << 8) | (first[2] << 16);
+		++packet_frames;
+		if (frame_size < MAX_PACKET_SIZE)
+		{
+			record_packet_written(packet_frames > 1 ? MAX_PACKET_SIZE : frame_size);
+			packet_frames = 0;
+		}
+		first += std::min<std::size_t>(4 + frame_size, last - first);
+	}
+}
+
+template <typename AsyncStream>
+template <typename Buffer>
+void boost::mysql::detail::channel<AsyncStream>::grow_buffer(
+	Buffer& buffer,
+	std::size_t size
+)
+{
+	auto old_capacity = buffer.capacity();
+	buffer.resize(buffer.size() + size);
+	if (buffer.capacity() != old_capacity) ++stats_.buffer_reallocations;
+}
+
+template <typename AsyncStream>
+template <typename Function>
+decltype(auto) boost::mysql::detail::channel<AsyncStream>::with_stream(
+	Function&& f
+)
+{
+	latency_.io_begin();
+	if constexpr (is_ssl_stream<AsyncStream>::value)
+	{
+		if (!ssl_active_)
+		{
+			return f(next_layer_.next_layer());
+		}
+	}
+	return f(next_layer_);
+}
+
+template <typename AsyncStream>
+void boost::mysql::detail::channel<AsyncStream>::read_some_into_buffer(
+	error_code& code
+)
+{
+	if (compression_)
+	{
+		// Decompress a new frame only when the previous one has been used up
+		if (compression_->decompressed_pending() == 0)
+		{
+			read_compressed_frame(code);
+			if (code) return;
+		}
+		compression_->move_decompressed(read_buffer_);
+		return;
+	}
+	read_buffer_.relocate();
+	std::size_t bytes_read = with_stream([&](auto& stream) {
+		return stream.read_some(read_buffer_.free_area(), code);
+	});
+	record_read(bytes_read);
+	read_buffer_.commit(bytes_read);
+}
+
+template <typename AsyncStream>
+void boost::mysql::detail::channel<AsyncStream>::read_compressed_frame(
+	error_code& code
+)
+{
+	auto& raw = compression_->raw_buffer;
+	auto& payload = compression_->frame_payload;
+
+	// Header. It may be already in the buffer, as a by-product of reading the previous frame
+	while (raw.pending_size() < compressed_frame_header_size)
+	{
+		raw.relocate();
+		std::size_t bytes_read = with_stream([&](auto& stream) {
+			return stream.read_some(raw.free_area(), code);
+		});
+		record_read(bytes_read);
+		if (code) return;
+		raw.commit(bytes_read);
+	}
+	std::uint32_t uncompressed_size = 0;
+	std::size_t remaining = 0;
+	code = compression_->process_frame_header(uncompressed_size, remaining);
+	if (code) return;
+	sequence_number_ = compression_->sequence_number;
+
+	// Payload, as we do for packets
+	if (remaining > raw.capacity())
+	{
+		std::size_t bytes_read = with_stream([&](auto& stream) {
+			return boost::asio::read(
+				stream,
+				boost::asio::buffer(payload.data() + payload.size() - remaining, remaining),
+				code
+			);
+		});
+		record_read(bytes_read);
+		if (code) return;
+	}
+	else
+	{
+		while (remaining > 0)
+		{
+			raw.relocate();
+			std::size_t bytes_read = with_stream([&](auto& stream) {
+				return stream.read_some(raw.free_area(), code);
+			});
+			record_read(bytes_read);
+			if (code) return;
+			raw.commit(bytes_read);
+			remaining -= raw.consume_into(payload.data() + payload.size() - remaining, remaining);
+		}
+	}
+
+	code = compression_->process_frame_payload(uncompressed_size);
+}
+
+template <typename AsyncStream>
+template <typename CompletionToken>
+BOOST_ASIO_INITFN_RESULT_TYPE(CompletionToken, void(boost::mysql::error_code, std::size_t))
+boost::mysql::detail::channel<AsyncStream>::async_read_some_into_buffer(
+	CompletionToken&& token
+)
+{
+	using HandlerSignature = void(mysql::error_code, std::size_t);
+	using HandlerType = BOOST_ASIO_HANDLER_TYPE(CompletionToken, HandlerSignature);
+	using BaseType = boost::beast::async_base<
+		HandlerType,
+		typename AsyncStream::executor_type,
+		recycling_allocator<void>
+	>;
+
+	boost::asio::async_completion<CompletionToken, HandlerSignature> initiator(token);
+
+	struct Op: BaseType, boost::asio::coroutine
+	{
+		channel<AsyncStream>& stream_;
+		std::uint32_t uncompressed_size_ = 0;
+		std::size_t remaining_ = 0;
+
+		Op(
+			HandlerType&& handler,
+			channel<AsyncStream>& stream
+		):
+			BaseType(std::move(handler), stream.next_layer_.get_executor(), stream.operation_allocator()),
+			stream_(stream)
+		{
+		}
+
+		read_buffer& raw() noexcept { return stream_.compression_->raw_buffer; }
+
+		std::uint8_t* remaining_first() noexcept
+		{
+			auto& payload = stream_.compression_->frame_payload;
+			return payload.data() + payload.size() - remaining_;
+		}
+
+		void operator()(
+			error_code code,
+			std::size_t bytes_transferred,
+			bool cont=true
+		)
+		{
+			reenter(*this)
+			{
+				if (!stream_.compression_)
+				{
+					stream_.read_buffer_.relocate();
+					yield stream_.with_stream([this](auto& stream) {
+						stream.async_read_some(stream_.read_buffer_.free_area(), std::move(*this));
+					});
+					stream_.record_read(bytes_transferred);
+					if (!code)
+					{
+						stream_.read_buffer_.commit(bytes_transferred);
+					}
+					this->complete(cont, code, bytes_transferred);
+					yield break;
+				}
+
+				// Decompress a new frame only when the previous one has been used up
+				if (stream_.compression_->decompressed_pending() == 0)
+				{
+					// Header. It may be already in the buffer, as a by-product of reading the previous frame
+					while (raw().pending_size() < compressed_frame_header_size)
+					{
+						raw().relocate();
+						yield stream_.with_stream([this](auto& stream) {
+							stream.async_read_some(raw().free_area(), std::move(*this));
+						});
+						stream_.record_read(bytes_transferred);
+						if (code)
+						{
+							this->complete(cont, code, 0);
+							yield break;
+						}
+						raw().commit(bytes_transferred);
+					}
+					code = stream_.compression_->process_frame_header(uncompressed_size_, remaining_);
+					if (code)
+					{
+						this->complete(cont, code, 0);
+						yield break;
+					}
+					stream_.sequence_number_ = stream_.compression_->sequence_number;
+
+					// Payload, as we do for packets
+					if (remaining_ > raw().capacity())
+					{
+						yield stream_.with_stream([this](auto& stream) {
+							boost::asio::async_read(
+								stream,
+								boost::asio::buffer(remaining_first(), remaining_),
+								std::move(*this)
+							);
+						});
+						stream_.record_read(bytes_transferred);
+						if (code)
+						{
+							this->complete(cont, code, 0);
+							yield break;
+						}
+					}
+					else
+					{
+						while (remaining_ > 0)
+						{
+							raw().relocate();
+							yield stream_.with_stream([this](auto& stream) {
+								stream.async_read_some(raw().free_area(), std::move(*this));
+							});
+							stream_.record_read(bytes_transferred);
+							if (code)
+							{
+								this->complete(cont, code, 0);
+								yield break;
+							}
+							raw().commit(bytes_transferred);
+							remaining_ -= raw().consume_into(remaining_first(), remaining_);
+						}
+					}
+
+					code = stream_.compression_->process_frame_payload(uncompressed_size_);
+					if (code)
+					{
+						this->complete(cont, code, 0);
+						yield break;
+					}
+				}
+
+				bytes_transferred = stream_.read_buffer_.pending_size();
+				stream_.compression_->move_decompressed(stream_.read_buffer_);
+				this->complete(cont, error_code(), stream_.read_buffer_.pending_size() - bytes_transferred);
+			}
+		}
+	};
+
+	Op(std::move(initiator.completion_handler), *this)(error_code(), 0, false);
+	return initiator.result.get();
+}
+
+template <typename AsyncStream>
+boost::asio::const_buffer boost::mysql::detail::channel<AsyncStream>::prepare_compressed_write(
+	boost::asio::const_buffer message
+)
+{
+	// Frame the message into packets, as usual, and then compress them.
+	// Frames take their own sequence numbers. As libmysql does after writing,
+	// the packet sequence number then continues from the frame one.
+	auto& uncompressed = compression_->uncompressed_write;
+	uncompressed.clear();
+	append_framed(message, sequence_number_, uncompressed);
+	auto res = compression_->prepare_write(boost::asio::buffer(uncompressed));
+	sequence_number_ = compression_->sequence_number;
+	return res;
+}
+
+template <typename AsyncStream>
+void boost::mysql::detail::channel<AsyncStream>::ssl_handshake(
+	error_code& code
+)
+{
+	assert(read_buffer_.pending_size() == 0); // the server has nothing to send at this point
+	if constexpr (is_ssl_stream<AsyncStream>::value)
+	{
+		latency_.io_begin();
+		next_layer_.handshake(boost::asio::ssl::stream_base::client, code);
+		latency_.io_end();
+		ssl_active_ = !code;
+	}
+	else
+	{
+		code = make_error_code(boost::asio::error::operation_not_supported);
+	}
+}
+
+template <typename AsyncStream>
+template <typename CompletionToken>
+BOOST_ASIO_INITFN_RESULT_TYPE(CompletionToken, void(boost::mysql::error_code))
+boost::mysql::detail::channel<AsyncStream>::async_ssl_handshake(
+	CompletionToken&& token
+)
+{
+	assert(read_buffer_.pending_size() == 0);
+
+	using HandlerSignature = void(mysql::error_code);
+	using HandlerType = BOOST_ASIO_HANDLER_TYPE(CompletionToken, HandlerSignature);
+	using BaseType = boost::beast::async_base<
+		HandlerType,
+		typename AsyncStream::executor_type,
+		recycling_allocator<void>
+	>;
+
+	boost::asio::async_completion<CompletionToken, HandlerSignature> initiator(token);
+
+	struct Op : BaseType
+	{
+		channel<AsyncStream>& stream_;
+
+		Op(
+			HandlerType&& handler,
+			channel<AsyncStream>& stream
+		):
+			BaseType(std::move(handler), stream.next_layer_.get_executor(), stream.operation_allocator()),
+			stream_(stream)
+		{
+		}
+
+		void operator()(
+			error_code code
+		)
+		{
+			stream_.latency_.io_end();
+			stream_.ssl_active_ = !code;
+			this->complete(true, code);
+		}
+	};
+
+	latency_.io_begin();
+	if constexpr (is_ssl_stream<AsyncStream>::value)
+	{
+		next_layer_.async_handshake(
+			boost::asio::ssl::stream_base::client,
+			Op(std::move(initiator.completion_handler), *this)
+		);
+	}
+	else
+	{
+		boost::asio::post(
+			next_layer_.get_executor(),
+			boost::beast::bind_front_handler(
+				Op(std::move(initiator.completion_handler), *this),
+				make_error_code(boost::asio::error::operation_not_supported)
+			)
+		);
+	}
+	return initiator.result.get();
+}
+
+template <typename AsyncStream>
+void boost::mysql::detail::channel<AsyncStream>::enable_compression(
+	compression_algorithm algo,
+	std::size_t threshold
+)
+{
+	assert(algo != compression_algorithm::none);
+	assert(read_buffer_.pending_size() == 0); // the server has nothing to send at this point
+	compression_ = std::make_unique<compression_state>(algo, threshold, read_buffer_.capacity());
+}
+
+template <typename AsyncStream>
+template <typename Buffer>
 void boost::mysql::detail::channel<AsyncStream>::read(
-	basic_bytestring<Allocator>& buffer,
+	Buffer& buffer,
 	error_code& code
 )
 {
-	std::size_t transferred_size = 0;
 	std::uint32_t size_to_read = 0;
 	buffer.clear();
 	code.clear();
 
 	do
 	{
-		boost::asio::read(
-			next_layer_,
-			boost::asio::buffer(header_buffer_),
-			code
-		);
-		if (code) return;
+		// Header. It may be already in the read buffer, as a
+		// by-product of reading the previous packet
+		while (read_buffer_.pending_size() < header_buffer_.size())
+		{
+			read_some_into_buffer(code);
+			if (code) return;
+		}
 		code = process_header_read(size_to_read);
 		if (code) return;
-		buffer.resize(buffer.size() + size_to_read);
-		boost::asio::read(
-			next_layer_,
-			boost::asio::buffer(buffer.data() + transferred_size, size_to_read),
-			code
-		);
-		if (code) return;
-		transferred_size += size_to_read;
+
+		// Body. Use whatever is already in the read buffer
+		grow_buffer(buffer, size_to_read);
+		std::size_t remaining = size_to_read - read_buffer_.consume_into(
+			buffer.data() + buffer.size() - size_to_read, size_to_read);
+
+		if (remaining > read_buffer_.capacity() && !compression_)
+		{
+			// Big packet: read directly into the destination, saving a copy
+			std::size_t bytes_read = with_stream([&](auto& stream) {
+				return boost::asio::read(
+					stream,
+					boost::asio::buffer(buffer.data() + buffer.size() - remaining, remaining),
+					code
+				);
+			});
+			record_read(bytes_read);
+			if (code) return;
+		}
+		else
+		{
+			// Read as much as we can, so subsequent packets
+			// may be served from the read buffer
+			while (remaining > 0)
+			{
+				read_some_into_buffer(code);
+				if (code) return;
+				remaining -= read_buffer_.consume_into(buffer.data() + buffer.size() - remaining, remaining);
+			}
+		}
 	} while (size_to_read == MAX_PACKET_SIZE);
+
+	record_packet_read(buffer.size() >= MAX_PACKET_SIZE);
 }
 
 template <typename AsyncStream>
@@ -112,6 +577,16 @@ void boost::mysql::detail::channel<AsyncStream>::write(
 	error_code& code
 )
 {
+	record_packet_written(buffer.size());
+	if (compression_)
+	{
+		auto frames = prepare_compressed_write(buffer);
+		record_write(with_stream([&](auto& stream) {
+			return boost::asio::write(stream, frames, code);
+		}));
+		return;
+	}
+
 	std::size_t transferred_size = 0;
 	auto bufsize = buffer.size();
 	auto first = static_cast<const std::uint8_t*>(buffer.data());
@@ -122,14 +597,16 @@ void boost::mysql::detail::channel<AsyncStream>::write(
 	{
 		auto size_to_write = compute_size_to_write(bufsize, transferred_size);
 		process_header_write(size_to_write);
-		boost::asio::write(
-			next_layer_,
-			std::array<boost::asio::const_buffer, 2> {
-				boost::asio::buffer(header_buffer_),
-				boost::asio::buffer(first + transferred_size, size_to_write)
-			},
-			code
-		);
+		record_write(with_stream([&](auto& stream) {
+			return boost::asio::write(
+				stream,
+				std::array<boost::asio::const_buffer, 2> {
+					boost::asio::buffer(header_buffer_),
+					boost::asio::buffer(first + transferred_size, size_to_write)
+				},
+				code
+			);
+		}));
 		if (code) return;
 		transferred_size += size_to_write;
 	} while (transferred_size < bufsize);
@@ -137,53 +614,70 @@ void boost::mysql::detail::channel<AsyncStream>::write(
 
 
 template <typename AsyncStream>
-template <typename Allocator, typename CompletionToken>
+template <typename Buffer, typename CompletionToken>
 BOOST_ASIO_INITFN_RESULT_TYPE(CompletionToken, void(boost::mysql::error_code))
 boost::mysql::detail::channel<AsyncStream>::async_read(
-	basic_bytestring<Allocator>& buffer,
+	Buffer& buffer,
 	CompletionToken&& token
 )
 {
 	using HandlerSignature = void(mysql::error_code);
 	using HandlerType = BOOST_ASIO_HANDLER_TYPE(CompletionToken, HandlerSignature);
-	using BaseType = boost::beast::async_base<HandlerType, typename AsyncStream::executor_type>;
+	using BaseType = boost::beast::async_base<
+		HandlerType,
+		typename AsyncStream::executor_type,
+		recycling_allocator<void>
+	>;
 
 	boost::asio::async_completion<CompletionToken, HandlerSignature> initiator(token);
 
 	struct Op: BaseType, boost::asio::coroutine
 	{
 		channel<AsyncStream>& stream_;
-		basic_bytestring<Allocator>& buffer_;
-		std::size_t total_transferred_size_ = 0;
+		Buffer& buffer_;
+		std::uint32_t size_to_read_ = 0;
+		std::size_t remaining_ = 0;
 
 		Op(
 			HandlerType&& handler,
 			channel<AsyncStream>& stream,
-			basic_bytestring<Allocator>& buffer
+			Buffer& buffer
 		):
-			BaseType(std::move(handler), stream.next_layer_.get_executor()),
+			BaseType(std::move(handler), stream.next_layer_.get_executor(), stream.operation_allocator()),
 			stream_(stream),
 			buffer_(buffer)
 		{
 		}
 
+		std::uint8_t* remaining_first() noexcept
+		{
+			return buffer_.data() + buffer_.size() - remaining_;
+		}
+
 		void operator()(
 			error_code code,
 			std::size_t bytes_transferred,
 			bool cont=true
 		)
 		{
-			std::uint32_t size_to_read = 0;
-
 			reenter(*this)
 			{
 				do
 				{
-					yield boost::asio::async_read(
-						stream_.next_layer_,
-						boost::asio::buffer(stream_.header_buffer_),
-						std::move(*this)
-					);
+					// Header. It may be already in the read buffer, as a
+					// by-product of reading the previous packet
+					while (stream_.read_buffer_.pending_size() < stream_.header_buffer_.size())
+					{
+						yield stream_.async_read_some_into_buffer(std::move(*this));
+
+						if (code)
+						{
+							this->complete(cont, code);
+							yield break;
+						}
+					}
+
+					code = stream_.process_header_read(size_to_read_);
 
 					if (code)
 					{
@@ -191,37 +685,304 @@ boost::mysql::detail::channel<AsyncStream>::async_read(
 						yield break;
 					}
 
-					code = stream_.process_header_read(size_to_read);
+					// Body. Use whatever is already in the read buffer
+					stream_.grow_buffer(buffer_, size_to_read_);
+					remaining_ = size_to_read_;
+					remaining_ -= stream_.read_buffer_.consume_into(remaining_first(), remaining_);
+
+					if (remaining_ > stream_.read_buffer_.capacity() && !stream_.compression_)
+					{
+						// Big packet: read directly into the destination, saving a copy
+						yield stream_.with_stream([this](auto& stream) {
+							boost::asio::async_read(
+								stream,
+								boost::asio::buffer(remaining_first(), remaining_),
+								std::move(*this)
+							);
+						});
+						stream_.record_read(bytes_transferred);
+
+						if (code)
+						{
+							this->complete(cont, code);
+							yield break;
+						}
+					}
+					else
+					{
+						// Read as much as we can, so subsequent packets
+						// may be served from the read buffer
+						while (remaining_ > 0)
+						{
+							yield stream_.async_read_some_into_buffer(std::move(*this));
+
+							if (code)
+							{
+								this->complete(cont, code);
+								yield break;
+							}
+
+							remaining_ -= stream_.read_buffer_.consume_into(remaining_first(), remaining_);
+						}
+					}
+				} while (size_to_read_ == MAX_PACKET_SIZE);
+
+				stream_.record_packet_read(buffer_.size() >= MAX_PACKET_SIZE);
+				this->complete(cont, error_code());
+			}
+		}
+	};
+
+	buffer.clear();
+	Op(std::move(initiator.completion_handler), *this, buffer)(error_code(), 0, false);
+	return initiator.result.get();
+}
+
+template <typename AsyncStream>
+void boost::mysql::detail::channel<AsyncStream>::read_frame_header(
+	error_code& code
+)
+{
+	while (read_buffer_.pending_size() < header_buffer_.size())
+	{
+		read_some_into_buffer(code);
+		if (code) return;
+	}
+	std::uint32_t size = 0;
+	code = process_header_read(size);
+	if (code) return;
+	frame_remaining_ = size;
+	frame_more_ = size == MAX_PACKET_SIZE;
+}
+
+template <typename AsyncStream>
+std::size_t boost::mysql::detail::channel<AsyncStream>::begin_read_packet(
+	error_code& code
+)
+{
+	assert(packet_complete());
+	code.clear();
+	read_frame_header(code);
+	if (code) return 0;
+	record_packet_read(frame_more_);
+	return frame_remaining_;
+}
+
+template <typename AsyncStream>
+std::size_t boost::mysql::detail::channel<AsyncStream>::read_packet_some(
+	boost::asio::mutable_buffer buffer,
+	error_code& code
+)
+{
+	code.clear();
+
+	// Frames are MAX_PACKET_SIZE bytes, except the last one, which may be empty
+	while (frame_remaining_ == 0)
+	{
+		if (!frame_more_ || buffer.size() == 0) return 0;
+		read_frame_header(code);
+		if (code) return 0;
+	}
+
+	std::size_t to_read = std::min(buffer.size(), frame_remaining_);
+	if (read_buffer_.pending_size() == 0 && !compression_ && to_read >= read_buffer_.capacity())
+	{
+		// Big read: go directly to the destination, saving a copy
+		std::size_t bytes_read = with_stream([&](auto& stream) {
+			return stream.read_some(boost::asio::buffer(buffer.data(), to_read), code);
+		});
+		record_read(bytes_read);
+		frame_remaining_ -= bytes_read;
+		return bytes_read;
+	}
+	while (read_buffer_.pending_size() == 0)
+	{
+		read_some_into_buffer(code);
+		if (code) return 0;
+	}
+	std::size_t res = read_buffer_.consume_into(buffer.data(), to_read);
+	frame_remaining_ -= res;
+	return res;
+}
+
+template <typename AsyncStream>
+template <typename CompletionToken>
+BOOST_ASIO_INITFN_RESULT_TYPE(CompletionToken, void(boost::mysql::error_code, std::size_t))
+boost::mysql::detail::channel<AsyncStream>::async_begin_read_packet(
+	CompletionToken&& token
+)
+{
+	assert(packet_complete());
+
+	using HandlerSignature = void(mysql::error_code, std::size_t);
+	using HandlerType = BOOST_ASIO_HANDLER_TYPE(CompletionToken, HandlerSignature);
+	using BaseType = boost::beast::async_base<
+		HandlerType,
+		typename AsyncStream::executor_type,
+		recycling_allocator<void>
+	>;
+
+	boost::asio::async_completion<CompletionToken, HandlerSignature> initiator(token);
 
+	struct Op: BaseType, boost::asio::coroutine
+	{
+		channel<AsyncStream>& stream_;
+
+		Op(
+			HandlerType&& handler,
+			channel<AsyncStream>& stream
+		):
+			BaseType(std::move(handler), stream.next_layer_.get_executor(), stream.operation_allocator()),
+			stream_(stream)
+		{
+		}
+
+		void operator()(
+			error_code code,
+			std::size_t,
+			bool cont=true
+		)
+		{
+			std::uint32_t size = 0;
+			reenter(*this)
+			{
+				while (stream_.read_buffer_.pending_size() < stream_.header_buffer_.size())
+				{
+					yield stream_.async_read_some_into_buffer(std::move(*this));
 					if (code)
 					{
-						this->complete(cont, code);
+						this->complete(cont, code, 0);
 						yield break;
 					}
+				}
+
+				code = stream_.process_header_read(size);
+				if (code)
+				{
+					this->complete(cont, code, 0);
+					yield break;
+				}
+				stream_.frame_remaining_ = size;
+				stream_.frame_more_ = size == MAX_PACKET_SIZE;
+				stream_.record_packet_read(stream_.frame_more_);
+				this->complete(cont, error_code(), stream_.frame_remaining_);
+			}
+		}
+	};
+
+	Op(std::move(initiator.completion_handler), *this)(error_code(), 0, false);
+	return initiator.result.get();
+}
+
+template <typename AsyncStream>
+template <typename CompletionToken>
+BOOST_ASIO_INITFN_RESULT_TYPE(CompletionToken, void(boost::mysql::error_code, std::size_t))
+boost::mysql::detail::channel<AsyncStream>::async_read_packet_some(
+	boost::asio::mutable_buffer buffer,
+	CompletionToken&& token
+)
+{
+	using HandlerSignature = void(mysql::error_code, std::size_t);
+	using HandlerType = BOOST_ASIO_HANDLER_TYPE(CompletionToken, HandlerSignature);
+	using BaseType = boost::beast::async_base<
+		HandlerType,
+		typename AsyncStream::executor_type,
+		recycling_allocator<void>
+	>;
+
+	boost::asio::async_completion<CompletionToken, HandlerSignature> initiator(token);
+
+	struct Op: BaseType, boost::asio::coroutine
+	{
+		channel<AsyncStream>& stream_;
+		boost::asio::mutable_buffer buffer_;
 
-					buffer_.resize(buffer_.size() + size_to_read);
+		Op(
+			HandlerType&& handler,
+			channel<AsyncStream>& stream,
+			boost::asio::mutable_buffer buffer
+		):
+			BaseType(std::move(handler), stream.next_layer_.get_executor(), stream.operation_allocator()),
+			stream_(stream),
+			buffer_(buffer)
+		{
+		}
 
-					yield boost::asio::async_read(
-						stream_.next_layer_,
-						boost::asio::buffer(buffer_.data() + total_transferred_size_, size_to_read),
-						std::move(*this)
-					);
+		std::size_t to_read() const noexcept { return std::min(buffer_.size(), stream_.frame_remaining_); }
 
+		void operator()(
+			error_code code,
+			std::size_t bytes_transferred,
+			bool cont=true
+		)
+		{
+			std::uint32_t size = 0;
+			reenter(*this)
+			{
+				// Frames are MAX_PACKET_SIZE bytes, except the last one, which may be empty
+				while (stream_.frame_remaining_ == 0)
+				{
+					if (!stream_.frame_more_ || buffer_.size() == 0)
+					{
+						this->complete(cont, error_code(), 0);
+						yield break;
+					}
+					while (stream_.read_buffer_.pending_size() < stream_.header_buffer_.size())
+					{
+						yield stream_.async_read_some_into_buffer(std::move(*this));
+						if (code)
+						{
+							this->complete(cont, code, 0);
+							yield break;
+						}
+					}
+					code = stream_.process_header_read(size);
 					if (code)
 					{
-						this->complete(cont, code);
+						this->complete(cont, code, 0);
 						yield break;
 					}
+					stream_.frame_remaining_ = size;
+					stream_.frame_more_ = size == MAX_PACKET_SIZE;
+				}
 
-					total_transferred_size_ += bytes_transferred;
-				} while (bytes_transferred == MAX_PACKET_SIZE);
+				if (
+					stream_.read_buffer_.pending_size() == 0 &&
+					!stream_.compression_ &&
+					to_read() >= stream_.read_buffer_.capacity()
+				)
+				{
+					// Big read: go directly to the destination, saving a copy
+					yield stream_.with_stream([this](auto& stream) {
+						stream.async_read_some(boost::asio::buffer(buffer_.data(), to_read()), std::move(*this));
+					});
+					stream_.record_read(bytes_transferred);
+					if (code)
+					{
+						this->complete(cont, code, 0);
+						yield break;
+					}
+					stream_.frame_remaining_ -= bytes_transferred;
+					this->complete(cont, error_code(), bytes_transferred);
+					yield break;
+				}
 
-				this->complete(cont, error_code());
+				while (stream_.read_buffer_.pending_size() == 0)
+				{
+					yield stream_.async_read_some_into_buffer(std::move(*this));
+					if (code)
+					{
+						this->complete(cont, code, 0);
+						yield break;
+					}
+				}
+				bytes_transferred = stream_.read_buffer_.consume_into(buffer_.data(), to_read());
+				stream_.frame_remaining_ -= bytes_transferred;
+				this->complete(cont, error_code(), bytes_transferred);
 			}
 		}
 	};
 
-	buffer.clear();
 	Op(std::move(initiator.completion_handler), *this, buffer)(error_code(), 0, false);
 	return initiator.result.get();
 }
@@ -234,9 +995,22 @@ boost::mysql::detail::channel<AsyncStream>::async_write(
 	CompletionToken&& token
 )
 {
+	record_packet_written(buffer.size());
+	if (compression_)
+	{
+		return async_write_raw(
+			prepare_compressed_write(buffer),
+			std::forward<CompletionToken>(token)
+		);
+	}
+
 	using HandlerSignature = void(mysql::error_code);
 	using HandlerType = BOOST_ASIO_HANDLER_TYPE(CompletionToken, HandlerSignature);
-	using BaseType = boost::beast::async_base<HandlerType, typename AsyncStream::executor_type>;
+	using BaseType = boost::beast::async_base<
+		HandlerType,
+		typename AsyncStream::executor_type,
+		recycling_allocator<void>
+	>;
 
 	boost::asio::async_completion<CompletionToken, HandlerSignature> initiator(token);
 
@@ -251,7 +1025,7 @@ boost::mysql::detail::channel<AsyncStream>::async_write(
 			channel<AsyncStream>& stream,
 			boost::asio::const_buffer buffer
 		):
-			BaseType(std::move(handler), stream.next_layer_.get_executor()),
+			BaseType(std::move(handler), stream.next_layer_.get_executor(), stream.operation_allocator()),
 			stream_(stream),
 			buffer_(buffer)
 		{
@@ -273,14 +1047,17 @@ boost::mysql::detail::channel<AsyncStream>::async_write(
 					size_to_write = compute_size_to_write(buffer_.size(), total_transferred_size_);
 					stream_.process_header_write(size_to_write);
 
-					yield boost::asio::async_write(
-						stream_.next_layer_,
-						std::array<boost::asio::const_buffer, 2> {
-							boost::asio::buffer(stream_.header_buffer_),
-							boost::asio::buffer(buffer_ + total_transferred_size_, size_to_write)
-						},
-						std::move(*this)
-					);
+					yield stream_.with_stream([this, size_to_write](auto& stream) {
+						boost::asio::async_write(
+							stream,
+							std::array<boost::asio::const_buffer, 2> {
+								boost::asio::buffer(stream_.header_buffer_),
+								boost::asio::buffer(buffer_ + total_transferred_size_, size_to_write)
+							},
+							std::move(*this)
+						);
+					});
+					stream_.record_write(bytes_transferred);
 
 					if (code)
 					{
@@ -302,6 +1079,86 @@ boost::mysql::detail::channel<AsyncStream>::async_write(
 	return initiator.result.get();
 }
 
+template <typename AsyncStream>
+void boost::mysql::detail::channel<AsyncStream>::write_framed(
+	boost::asio::const_buffer buffer,
+	error_code& code
+)
+{
+	// Every command starts with sequence number zero, and so do its frames
+	record_packets_written(buffer);
+	auto frames = compression_ ? compression_->prepare_write_commands(buffer) : buffer;
+	record_write(with_stream([&](auto& stream) {
+		return boost::asio::write(stream, frames, code);
+	}));
+}
+
+template <typename AsyncStream>
+template <typename CompletionToken>
+BOOST_ASIO_INITFN_RESULT_TYPE(CompletionToken, void(boost::mysql::error_code))
+boost::mysql::detail::channel<AsyncStream>::async_write_framed(
+	boost::asio::const_buffer buffer,
+	CompletionToken&& token
+)
+{
+	record_packets_written(buffer);
+	return async_write_raw(
+		compression_ ? compression_->prepare_write_commands(buffer) : buffer,
+		std::forward<CompletionToken>(token)
+	);
+}
+
+template <typename AsyncStream>
+template <typename CompletionToken>
+BOOST_ASIO_INITFN_RESULT_TYPE(CompletionToken, void(boost::mysql::error_code))
+boost::mysql::detail::channel<AsyncStream>::async_write_raw(
+	boost::asio::const_buffer buffer,
+	CompletionToken&& token
+)
+{
+	using HandlerSignature = void(mysql::error_code);
+	using HandlerType = BOOST_ASIO_HANDLER_TYPE(CompletionToken, HandlerSignature);
+	using BaseType = boost::beast::async_base<
+		HandlerType,
+		typename AsyncStream::executor_type,
+		recycling_allocator<void>
+	>;
+
+	boost::asio::async_completion<CompletionToken, HandlerSignature> initiator(token);
+
+	struct Op : BaseType
+	{
+		channel<AsyncStream>& stream_;
+
+		Op(
+			HandlerType&& handler,
+			channel<AsyncStream>& stream
+		):
+			BaseType(std::move(handler), stream.next_layer_.get_executor(), stream.operation_allocator()),
+			stream_(stream)
+		{
+		}
+
+		void operator()(
+			error_code code,
+			std::size_t bytes_transferred
+		)
+		{
+			stream_.record_write(bytes_transferred);
+			this->complete(true, code);
+		}
+	};
+
+	with_stream([&](auto& stream) {
+		boost::asio::async_write(
+			stream,
+			buffer,
+			Op(std::move(initiator.completion_handler), *this)
+		);
+	});
+	return initiator.result.get();
+}
+
 #include <boost/asio/unyield.hpp>
 
 
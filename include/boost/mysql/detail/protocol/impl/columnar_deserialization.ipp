@@ -0,0 +1,219 @@
+#ifndef INCLUDE_BOOST_MYSQL_DETAIL_PROTOCOL_IMPL_COLUMNAR_DESERIALIZATION_IPP_
+#define INCLUDE_BOOST_MYSQL_DETAIL_PROTOCOL_IMPL_COLUMNAR_DESERIALIZATION_IPP_
+
+#include "boost/mysql/detail/protocol/text_deserialization.hpp"
+#include "boost/mysql/detail/protocol/binary_deserialization.hpp"
+#include "boost/mysql/detail/protocol/null_bitmap_traits.hpp"
+
+namespace boost {
+namespace mysql {
+namespace detail {
+
+// Conversions from the decoded types to the ones stored in columns
+template <typename T>
+std::enable_if_t<std::is_integral_v<T>, std::conditional_t<std::is_signed_v<T>, std::int64_t, std::uint64_t>>
+to_column_value(T v) noexcept
+{
+	return v;
+}
+
+inline double to_column_value(float v) noexcept { return v; }
+inline double to_column_value(double v) noexcept { return v; }
+inline std::int64_t to_column_value(date v) noexcept { return v.time_since_epoch().count(); }
+inline std::int64_t to_column_value(datetime v) noexcept { return v.time_since_epoch().count(); }
+inline std::int64_t to_column_value(time v) noexcept { return v.count(); }
+inline std::string_view to_column_value(std::string_view v) noexcept { return v; }
+
+template <typename T, typename... Args>
+errc append_text_value(std::string_view from, column& output, Args... args)
+{
+	T v;
+	auto err = deserialize_text_value_impl(from, v, args...);
+	if (err == errc::ok)
+	{
+		output.append(to_column_value(v));
+	}
+	return err;
+}
+
+template <typename DeserializableType>
+errc append_binary_value(deserialization_context& ctx, column& output)
+{
+	DeserializableType v;
+	auto err = deserialize(v, ctx);
+	if (err == errc::ok)
+	{
+		if constexpr (std::is_constructible_v<value, DeserializableType>) // not a value holder
+		{
+			output.append(to_column_value(v));
+		}
+		else
+		{
+			output.append(to_column_value(v.value));
+		}
+	}
+	return err;
+}
+
+template <typename SignedType, typename UnsignedType>
+column_value_decoder get_int_column_value_decoder(bool is_unsigned) noexcept
+{
+	return is_unsigned ? &append_binary_value<UnsignedType> : &append_binary_value<SignedType>;
+}
+
+inline errc deserialize_text_columnar_row(
+	deserialization_context& ctx,
+	const resultset_metadata& meta,
+	column_batch& output
+)
+{
+	const auto& fields = meta.fields();
+	for (std::size_t i = 0; i < fields.size(); ++i)
+	{
+		field_bounds bounds;
+		errc err = scan_text_field(ctx, bounds);
+		if (err != errc::ok) return err;
+		auto& col = output.get_column(i);
+		if (bounds.is_null() || !meta.is_projected(i))
+		{
+			col.append_null();
+		}
+		else
+		{
+			err = deserialize_text_value(bounds.value(), fields[i], col);
+			if (err != errc::ok) return err;
+		}
+	}
+	return errc::ok;
+}
+
+inline errc deserialize_binary_columnar_row(
+	deserialization_context& ctx,
+	const resultset_metadata& meta,
+	const binary_columnar_plan& plan,
+	column_batch& output
+)
+{
+	// Skip packet header, as deserialize_binary_row does
+	assert(ctx.enough_size(1));
+	ctx.advance(1);
+
+	// Null bitmap
+	assert(plan.size() == meta.fields().size());
+	null_bitmap_traits null_bitmap (binary_row_null_bitmap_offset, plan.size());
+	const std::uint8_t* null_bitmap_begin = ctx.first();
+	if (!ctx.enough_size(null_bitmap.byte_count())) return errc::incomplete_message;
+	ctx.advance(null_bitmap.byte_count());
+
+	// Actual values
+	for (std::size_t i = 0; i < plan.size(); ++i)
+	{
+		auto& col = output.get_column(i);
+		errc err = errc::ok;
+		if (null_bitmap.is_null(null_bitmap_begin, i))
+		{
+			col.append_null();
+		}
+		else if (!meta.is_projected(i))
+		{
+			value ignored; // the plan holds a skipper for this field
+			err = meta.binary_plan()[i](ctx, ignored);
+			col.append_null();
+		}
+		else
+		{
+			err = plan[i](ctx, col);
+		}
+		if (err != errc::ok) return err;
+	}
+	return errc::ok;
+}
+
+} // detail
+} // mysql
+} // boost
+
+inline boost::mysql::errc boost::mysql::detail::deserialize_text_value(
+	std::string_view from,
+	const field_metadata& meta,
+	column& output
+)
+{
+	switch (output.kind())
+	{
+	case column_kind::int64: return append_text_value<std::int64_t>(from, output);
+	case column_kind::uint64: return append_text_value<std::uint64_t>(from, output);
+	case column_kind::double_:
+		// Parsing FLOATs as float yields the same values as the binary protocol
+		return meta.protocol_type() == protocol_field_type::float_ ?
+				append_text_value<float>(from, output) :
+				append_text_value<double>(from, output);
+	case column_kind::date: return append_text_value<date>(from, output);
+	case column_kind::datetime: return append_text_value<datetime>(from, output, meta.decimals());
+	case column_kind::time: return append_text_value<time>(from, output, meta.decimals());
+	default: return append_text_value<std::string_view>(from, output);
+	}
+}
+
+inline boost::mysql::detail::column_value_decoder boost::mysql::detail::get_column_value_decoder(
+	const field_metadata& meta
+) noexcept
+{
+	switch (meta.protocol_type())
+	{
+	case protocol_field_type::tiny:
+		return get_int_column_value_decoder<int1_signed, int1>(meta.is_unsigned());
+	case protocol_field_type::short_:
+	case protocol_field_type::year:
+		return get_int_column_value_decoder<int2_signed, int2>(meta.is_unsigned());
+	case protocol_field_type::int24:
+	case protocol_field_type::long_:
+		return get_int_column_value_decoder<int4_signed, int4>(meta.is_unsigned());
+	case protocol_field_type::longlong:
+		return get_int_column_value_decoder<int8_signed, int8>(meta.is_unsigned());
+	case protocol_field_type::float_: return &append_binary_value<float>;
+	case protocol_field_type::double_: return &append_binary_value<double>;
+	case protocol_field_type::timestamp:
+	case protocol_field_type::datetime: return &append_binary_value<datetime>;
+	case protocol_field_type::date: return &append_binary_value<date>;
+	case protocol_field_type::time: return &append_binary_value<time>;
+	default: return &append_binary_value<string_lenenc>;
+	}
+}
+
+inline boost::mysql::detail::binary_columnar_plan boost::mysql::detail::make_binary_columnar_plan(
+	const std::pmr::vector<field_metadata>& fields,
+	std::pmr::memory_resource* resource
+)
+{
+	binary_columnar_plan res (resource);
+	res.reserve(fields.size());
+	for (const auto& field: fields)
+	{
+		res.push_back(get_column_value_decoder(field));
+	}
+	return res;
+}
+
+inline boost::mysql::error_code boost::mysql::detail::deserialize_columnar_row(
+	deserialization_context& ctx,
+	const resultset_metadata& meta,
+	const binary_columnar_plan* binary_plan,
+	column_batch& output
+)
+{
+	assert(output.num_columns() == meta.fields().size());
+	errc err = binary_plan ?
+			deserialize_binary_columnar_row(ctx, meta, *binary_plan, output) :
+			deserialize_text_columnar_row(ctx, meta, output);
+	if (err == errc::ok && !ctx.empty()) err = errc::extra_bytes;
+	if (err != errc::ok)
+	{
+		output.discard_row();
+		return make_error_code(err);
+	}
+	output.finish_row();
+	return error_code();
+}
+
+#endif /* INCLUDE_BOOST_MYSQL_DETAIL_PROTOCOL_IMPL_COLUMNAR_DESERIALIZATION_IPP_ */
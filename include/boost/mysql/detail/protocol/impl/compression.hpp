@@ -0,0 +1,217 @@
+#ifndef INCLUDE_BOOST_MYSQL_DETAIL_PROTOCOL_IMPL_COMPRESSION_HPP_
+#define INCLUDE_BOOST_MYSQL_DETAIL_PROTOCOL_IMPL_COMPRESSION_HPP_
+
+#include "boost/mysql/detail/protocol/constants.hpp"
+#include <zlib.h>
+#ifdef BOOST_MYSQL_HAS_ZSTD
+#include <zstd.h>
+#endif
+#include <algorithm>
+#include <cassert>
+
+inline std::size_t boost::mysql::detail::compressor::max_compressed_size(
+	std::size_t input_size
+) const noexcept
+{
+#ifdef BOOST_MYSQL_HAS_ZSTD
+	if (algo_ == compression_algorithm::zstd)
+	{
+		return ZSTD_compressBound(input_size);
+	}
+#endif
+	return compressBound(static_cast<uLong>(input_size));
+}
+
+inline std::size_t boost::mysql::detail::compressor::compress(
+	boost::asio::const_buffer input,
+	std::uint8_t* output
+) const noexcept
+{
+#ifdef BOOST_MYSQL_HAS_ZSTD
+	if (algo_ == compression_algorithm::zstd)
+	{
+		std::size_t res = ZSTD_compress(
+			output,
+			max_compressed_size(input.size()),
+			input.data(),
+			input.size(),
+			default_zstd_compression_level
+		);
+		return ZSTD_isError(res) ? 0 : res;
+	}
+#endif
+	assert(algo_ == compression_algorithm::zlib);
+	uLongf res = static_cast<uLongf>(max_compressed_size(input.size()));
+	int code = compress2(
+		output,
+		&res,
+		static_cast<const Bytef*>(input.data()),
+		static_cast<uLong>(input.size()),
+		Z_DEFAULT_COMPRESSION
+	);
+	return code == Z_OK ? static_cast<std::size_t>(res) : 0;
+}
+
+inline void boost::mysql::detail::compressor::append_frames(
+	boost::asio::const_buffer uncompressed,
+	std::uint8_t seqnum,
+	bytestring& output
+) const
+{
+	auto first = static_cast<const std::uint8_t*>(uncompressed.data());
+	std::size_t transferred_size = 0;
+	do
+	{
+		std::size_t frame_size = std::min(MAX_PACKET_SIZE, uncompressed.size() - transferred_size);
+		const std::uint8_t* frame_first = first + transferred_size;
+		std::size_t header_offset = output.size();
+
+		// Try to compress the payload in place, after the header
+		std::size_t compressed_size = 0;
+		if (frame_size >= threshold_)
+		{
+			output.resize(header_offset + compressed_frame_header_size + max_compressed_size(frame_size));
+			compressed_size = compress(
+				boost::asio::buffer(frame_first, frame_size),
+				output.data() + header_offset + compressed_frame_header_size
+			);
+		}
+
+		compressed_frame_header header;
+		header.sequence_number.value = seqnum++;
+		if (compressed_size == 0 || compressed_size >= frame_size)
+		{
+			// Below the threshold, compression failed, or not worth it: send as is
+			output.resize(header_offset + compressed_frame_header_size);
+			output.insert(output.end(), frame_first, frame_first + frame_size);
+			header.compressed_size.value = static_cast<std::uint32_t>(frame_size);
+			header.uncompressed_size.value = 0;
+		}
+		else
+		{
+			output.resize(header_offset + compressed_frame_header_size + compressed_size);
+			header.compressed_size.value = static_cast<std::uint32_t>(compressed_size);
+			header.uncompressed_size.value = static_cast<std::uint32_t>(frame_size);
+		}
+		serialization_context ctx (capabilities(0), output.data() + header_offset); // capabilities not relevant here
+		serialize(header, ctx);
+
+		transferred_size += frame_size;
+	} while (transferred_size < uncompressed.size());
+}
+
+inline boost::mysql::error_code boost::mysql::detail::compressor::decompress(
+	boost::asio::const_buffer payload,
+	boost::asio::mutable_buffer output
+) const noexcept
+{
+#ifdef BOOST_MYSQL_HAS_ZSTD
+	if (algo_ == compression_algorithm::zstd)
+	{
+		std::size_t res = ZSTD_decompress(output.data(), output.size(), payload.data(), payload.size());
+		if (ZSTD_isError(res) || res != output.size())
+		{
+			return make_error_code(errc::protocol_value_error);
+		}
+		return error_code();
+	}
+#endif
+	assert(algo_ == compression_algorithm::zlib);
+	uLongf res = static_cast<uLongf>(output.size());
+	int code = uncompress(
+		static_cast<Bytef*>(output.data()),
+		&res,
+		static_cast<const Bytef*>(payload.data()),
+		static_cast<uLong>(payload.size())
+	);
+	if (code != Z_OK || res != output.size())
+	{
+		return make_error_code(errc::protocol_value_error);
+	}
+	return error_code();
+}
+
+inline boost::mysql::error_code boost::mysql::detail::compression_state::process_frame_header(
+	std::uint32_t& uncompressed_size,
+	std::size_t& remaining
+)
+{
+	assert(raw_buffer.pending_size() >= compressed_frame_header_size);
+	compressed_frame_header header;
+	deserialization_context ctx (raw_buffer.pending(), capabilities(0)); // unaffected by capabilities
+	[[maybe_unused]] errc err = deserialize(header, ctx);
+	assert(err == errc::ok); // this should always succeed
+	raw_buffer.consume(compressed_frame_header_size);
+	if (header.sequence_number.value != sequence_number++)
+	{
+		return make_error_code(errc::sequence_number_mismatch);
+	}
+	uncompressed_size = header.uncompressed_size.value;
+	frame_payload.resize(header.compressed_size.value);
+	remaining = frame_payload.size() - raw_buffer.consume_into(frame_payload.data(), frame_payload.size());
+	return error_code();
+}
+
+inline boost::mysql::error_code boost::mysql::detail::compression_state::process_frame_payload(
+	std::uint32_t uncompressed_size
+)
+{
+	decompressed_offset = 0;
+	if (uncompressed_size == 0)
+	{
+		// Payload was not compressed
+		std::swap(decompressed, frame_payload);
+		return error_code();
+	}
+	decompressed.resize(uncompressed_size);
+	return comp.decompress(boost::asio::buffer(frame_payload), boost::asio::buffer(decompressed));
+}
+
+inline void boost::mysql::detail::compression_state::move_decompressed(
+	read_buffer& to
+) noexcept
+{
+	to.relocate();
+	std::size_t size = std::min(to.free_size(), decompressed_pending());
+	if (size)
+	{
+		std::memcpy(to.free_area().data(), decompressed.data() + decompressed_offset, size);
+		to.commit(size);
+		decompressed_offset += size;
+	}
+}
+
+inline boost::asio::const_buffer boost::mysql::detail::compression_state::prepare_write(
+	boost::asio::const_buffer packets
+)
+{
+	frames_write.clear();
+	comp.append_frames(packets, sequence_number, frames_write);
+	sequence_number += num_compressed_frames(packets.size());
+	return boost::asio::buffer(frames_write);
+}
+
+inline boost::asio::const_buffer boost::mysql::detail::compression_state::prepare_write_commands(
+	boost::asio::const_buffer packets
+)
+{
+	constexpr std::size_t header_size = 4;
+	auto first = static_cast<const std::uint8_t*>(packets.data());
+	std::size_t command_first = 0;
+	std::size_t offset = 0;
+	frames_write.clear();
+	while (packets.size() - offset >= header_size)
+	{
+		std::size_t packet_size = first[offset] | (first[offset + 1] << 8) | (first[offset + 2] << 16);
+		if (first[offset + 3] == 0 && offset != command_first)
+		{
+			comp.append_frames(boost::asio::buffer(first + command_first, offset - command_first), 0, frames_write);
+			command_first = offset;
+		}
+		offset += std::min(header_size + packet_size, packets.size() - offset);
+	}
+	comp.append_frames(boost::asio::buffer(first + command_first, packets.size() - command_first), 0, frames_write);
+	return boost::asio::buffer(frames_write);
+}
+
+#endif /* INCLUDE_BOOST_MYSQL_DETAIL_PROTOCOL_IMPL_COMPRESSION_HPP_ */
@@ -91,6 +91,10 @@ boost::mysql::detail::serialization_traits<
 		res += get_size(value.database, ctx);
 	}
 	res += get_size(value.client_plugin_name, ctx);
+	if (ctx.get_capabilities().has(CLIENT_ZSTD_COMPRESSION_ALGORITHM))
+	{
+		res += get_size(value.zstd_compression_level, ctx);
+	}
 	return res;
 }
 
@@ -115,6 +119,10 @@ boost::mysql::detail::serialization_traits<
 		serialize(value.database, ctx);
 	}
 	serialize(value.client_plugin_name, ctx);
+	if (ctx.get_capabilities().has(CLIENT_ZSTD_COMPRESSION_ALGORITHM))
+	{
+		serialize(value.zstd_compression_level, ctx);
+	}
 }
 
 inline boost::mysql::errc
@@ -109,7 +109,7 @@ boost::mysql::detail::serialization_traits<
 ) noexcept
 {
 	int1 reserved;
-	return deserialize_fields(
+	auto err = deserialize_fields(
 		ctx,
 		output.statement_id,
 		output.num_columns,
@@ -117,6 +117,13 @@ boost::mysql::detail::serialization_traits<
 		reserved,
 		output.warning_count
 	);
+	if (err != errc::ok) return err;
+	if (ctx.get_capabilities().has(CLIENT_OPTIONAL_RESULTSET_METADATA))
+	{
+		return deserialize(output.metadata_follows, ctx);
+	}
+	output.metadata_follows = int1(resultset_metadata_full);
+	return errc::ok;
 }
 
 template <typename ForwardIterator>
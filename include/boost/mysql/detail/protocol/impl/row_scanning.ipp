@@ -0,0 +1,216 @@
+#ifndef MYSQL_ASIO_DETAIL_PROTOCOL_IMPL_ROW_SCANNING_IPP
+#define MYSQL_ASIO_DETAIL_PROTOCOL_IMPL_ROW_SCANNING_IPP
+
+#include "boost/mysql/detail/protocol/binary_deserialization.hpp"
+#include "boost/mysql/detail/protocol/null_bitmap_traits.hpp"
+#include <cassert>
+
+namespace boost {
+namespace mysql {
+namespace detail {
+
+// Size of a fixed-length value in the binary protocol, or zero
+// if the value is prefixed by its length
+inline std::size_t binary_fixed_size(const field_metadata& meta) noexcept
+{
+	switch (meta.protocol_type())
+	{
+	case protocol_field_type::tiny: return 1;
+	case protocol_field_type::short_:
+	case protocol_field_type::year: return 2;
+	case protocol_field_type::int24:
+	case protocol_field_type::long_: return 4;
+	case protocol_field_type::longlong: return 8;
+	case protocol_field_type::float_: return 4;
+	case protocol_field_type::double_: return 8;
+	default: return 0;
+	}
+}
+
+// Dates and times in the binary protocol are prefixed by a single length byte
+inline bool is_binary_temporal(const field_metadata& meta) noexcept
+{
+	switch (meta.protocol_type())
+	{
+	case protocol_field_type::timestamp:
+	case protocol_field_type::datetime:
+	case protocol_field_type::date:
+	case protocol_field_type::time: return true;
+	default: return false;
+	}
+}
+
+} // detail
+} // mysql
+} // boost
+
+inline bool boost::mysql::detail::is_streamable_field(
+	const field_metadata& meta
+) noexcept
+{
+	return get_binary_value_decoder(meta.protocol_type(), meta.is_unsigned()) ==
+	       &decode_binary_value<string_lenenc>;
+}
+
+inline boost::mysql::errc boost::mysql::detail::locate_field(
+	boost::asio::const_buffer row_prefix,
+	const std::pmr::vector<field_metadata>& meta,
+	std::size_t field_index,
+	bool binary,
+	field_location& output
+)
+{
+	assert(field_index < meta.size());
+	assert(is_streamable_field(meta[field_index]));
+
+	const auto* first = static_cast<const std::uint8_t*>(row_prefix.data());
+	std::size_t size = row_prefix.size();
+	std::size_t pos = 0;
+	output = field_location();
+
+	// Returns true if we don't have n more bytes after pos, recording how many are missing
+	auto need = [&](std::uint64_t n) {
+		if (size - pos < n)
+		{
+			output.bytes_needed = static_cast<std::size_t>(pos + n - size);
+			return true;
+		}
+		return false;
+	};
+
+	// Binary rows start with the message type byte and the null bitmap
+	null_bitmap_traits null_bitmap (binary_row_null_bitmap_offset, meta.size());
+	if (binary)
+	{
+		if (need(1 + null_bitmap.byte_count())) return errc::ok;
+		pos = 1 + null_bitmap.byte_count();
+	}
+
+	for (std::size_t i = 0; i <= field_index; ++i)
+	{
+		bool is_target = i == field_index;
+		std::size_t header_offset = pos;
+
+		if (binary)
+		{
+			if (null_bitmap.is_null(first + 1, i))
+			{
+				if (is_target)
+				{
+					output.header_offset = output.value_offset = pos;
+					output.is_null = true;
+					return errc::ok;
+				}
+				continue;
+			}
+			if (std::size_t fixed_size = binary_fixed_size(meta[i]))
+			{
+				if (need(fixed_size)) return errc::ok;
+				pos += fixed_size;
+				continue;
+			}
+			if (is_binary_temporal(meta[i]))
+			{
+				if (need(1)) return errc::ok;
+				std::size_t length = first[pos];
+				if (need(1 + length)) return errc::ok;
+				pos += 1 + length;
+				continue;
+			}
+		}
+
+		// Length-encoded string (all text protocol values)
+		if (need(1)) return errc::ok;
+		std::uint8_t length_byte = first[pos];
+		if (length_byte == 0xfb && !binary) // NULL value
+		{
+			if (is_target)
+			{
+				output.header_offset = pos;
+				output.value_offset = pos + 1;
+				output.is_null = true;
+				return errc::ok;
+			}
+			++pos;
+			continue;
+		}
+
+		std::size_t header_size = 1;
+		switch (length_byte)
+		{
+		case 0xfb:
+		case 0xff: return errc::protocol_value_error;
+		case 0xfc: header_size = 3; break;
+		case 0xfd: header_size = 4; break;
+		case 0xfe: header_size = 9; break;
+		default: break;
+		}
+		if (need(header_size)) return errc::ok;
+		std::uint64_t length = header_size == 1 ? length_byte : 0;
+		for (std::size_t j = header_size - 1; j > 0; --j)
+		{
+			length = (length << 8) | first[pos + j];
+		}
+		pos += header_size;
+
+		if (is_target)
+		{
+			output.header_offset = header_offset;
+			output.value_offset = pos;
+			output.value_size = length;
+			return errc::ok;
+		}
+		if (need(length)) return errc::ok;
+		pos += static_cast<std::size_t>(length);
+	}
+
+	assert(false); // unreachable: the loop always returns at field_index
+	return errc::ok;
+}
+
+inline boost::mysql::errc boost::mysql::detail::split_row(
+	deserialization_context& ctx,
+	const std::pmr::vector<field_metadata>& meta,
+	bool binary,
+	field_bounds* output
+)
+{
+	if (binary)
+	{
+		// Message type byte (checked by the caller) and null bitmap
+		assert(ctx.enough_size(1));
+		ctx.advance(1);
+		null_bitmap_traits null_bitmap (binary_row_null_bitmap_offset, meta.size());
+		const std::uint8_t* null_bitmap_begin = ctx.first();
+		if (!ctx.enough_size(null_bitmap.byte_count())) return errc::incomplete_message;
+		ctx.advance(null_bitmap.byte_count());
+
+		for (std::size_t i = 0; i < meta.size(); ++i)
+		{
+			if (null_bitmap.is_null(null_bitmap_begin, i))
+			{
+				output[i] = field_bounds {nullptr, 0};
+				continue;
+			}
+			const std::uint8_t* first = ctx.first();
+			value scratch;
+			errc err = get_binary_value_skipper(meta[i].protocol_type())(ctx, scratch);
+			if (err != errc::ok) return err;
+			output[i] = field_bounds {
+				reinterpret_cast<const char*>(first),
+				static_cast<std::size_t>(ctx.first() - first)
+			};
+		}
+	}
+	else
+	{
+		for (std::size_t i = 0; i < meta.size(); ++i)
+		{
+			errc err = scan_text_field(ctx, output[i]);
+			if (err != errc::ok) return err;
+		}
+	}
+	return ctx.empty() ? errc::ok : errc::extra_bytes;
+}
+
+#endif
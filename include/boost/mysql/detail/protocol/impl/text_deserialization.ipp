@@ -1,29 +1,97 @@
 #ifndef MYSQL_ASIO_IMPL_DESERIALIZE_ROW_IPP
 #define MYSQL_ASIO_IMPL_DESERIALIZE_ROW_IPP
 
-#include <cstdlib>
-#include <cmath>
-#include <boost/lexical_cast/try_lexical_convert.hpp>
+#include "boost/mysql/detail/auxiliar/civil_days.hpp"
+#include <algorithm>
+#include <charconv>
 #include <date/date.h>
 
+// Floating point std::from_chars is missing in some standard libraries
+#if defined(__cpp_lib_to_chars) && __cpp_lib_to_chars >= 201611L
+#define BOOST_MYSQL_HAS_FLOAT_FROM_CHARS
+#else
+#include <boost/lexical_cast/try_lexical_convert.hpp>
+#endif
+
 namespace boost {
 namespace mysql {
 namespace detail {
 
+// Parses exactly num_digits decimal digits starting at from[pos]. The caller checks the size
+inline bool parse_fixed_digits(
+	std::string_view from,
+	std::size_t pos,
+	std::size_t num_digits,
+	unsigned& to
+) noexcept
+{
+	unsigned res = 0;
+	for (std::size_t i = pos; i < pos + num_digits; ++i)
+	{
+		unsigned digit = static_cast<unsigned char>(from[i]) - static_cast<unsigned>('0');
+		if (digit > 9) return false;
+		res = res * 10 + digit;
+	}
+	to = res;
+	return true;
+}
+
+// Parses hh[h]:mm:ss[.f], with hour_digits hour digits and
+// decimals fractional digits (none and no dot if zero). from must
+// have exactly the required size
+inline bool parse_time_of_day(
+	std::string_view from,
+	std::size_t hour_digits,
+	unsigned decimals,
+	unsigned& hours,
+	unsigned& minutes,
+	unsigned& seconds,
+	unsigned& micros
+) noexcept
+{
+	constexpr unsigned pow10 [] = { 1, 10, 100, 1000, 10000, 100000, 1000000 };
+	std::size_t pos = hour_digits;
+	if (
+		from[pos] != ':' ||
+		from[pos + 3] != ':' ||
+		!parse_fixed_digits(from, 0, hour_digits, hours) ||
+		!parse_fixed_digits(from, pos + 1, 2, minutes) ||
+		!parse_fixed_digits(from, pos + 4, 2, seconds) ||
+		minutes > 59 ||
+		seconds > 59
+	)
+	{
+		return false;
+	}
+	micros = 0;
+	if (decimals)
+	{
+		if (from[pos + 6] != '.' || !parse_fixed_digits(from, pos + 7, decimals, micros)) return false;
+		micros *= pow10[6 - decimals];
+	}
+	return true;
+}
+
 inline errc deserialize_text_value_impl(
 	std::string_view from,
 	date& to
 )
 {
-	constexpr std::size_t size = 4 + 2 + 2 + 2; // year, month, day, separators
-	if (from.size() != size) return errc::protocol_value_error;
+	// YYYY-MM-DD
 	unsigned year, month, day;
-	char buffer [size + 1] {};
-	memcpy(buffer, from.data(), from.size());
-	int parsed = sscanf(buffer, "%4u-%2u-%2u", &year, &month, &day);
-	if (parsed != 3) return errc::protocol_value_error;
-	::date::year_month_day result (::date::year(year)/::date::month(month)/::date::day(day));
-	if (!result.ok()) return errc::protocol_value_error;
+	if (
+		from.size() != 10 ||
+		from[4] != '-' ||
+		from[7] != '-' ||
+		!parse_fixed_digits(from, 0, 4, year) ||
+		!parse_fixed_digits(from, 5, 2, month) ||
+		!parse_fixed_digits(from, 8, 2, day) ||
+		!is_valid_date(static_cast<std::uint16_t>(year), month, day) // rejects zero dates
+	)
+	{
+		return errc::protocol_value_error;
+	}
+	date result (::date::days(days_from_civil(static_cast<std::uint16_t>(year), month, day)));
 	if (result > max_date || result < min_date) return errc::protocol_value_error;
 	to = result;
 	return errc::ok;
@@ -35,23 +103,19 @@ inline errc deserialize_text_value_impl(
 	unsigned decimals
 )
 {
-	// size check
-	constexpr std::size_t min_size = 2 + 2 + 2 + 2; // hours, mins, seconds, no micros
-	constexpr std::size_t max_size = min_size + 1 + 1 + 7; // hour extra character, sign and micros
+	// [-]hh[h]:mm:ss[.f]. The number of fractional digits is given by decimals
 	decimals = std::min(decimals, 6u);
-	if (from.size() < min_size || from.size() > max_size) return errc::protocol_value_error;
+	bool is_negative = !from.empty() && from[0] == '-';
+	if (is_negative) from.remove_prefix(1);
+	std::size_t fixed_size = 6 + (decimals ? decimals + 1 : 0); // :mm:ss[.f]
+	if (from.size() < fixed_size + 2 || from.size() > fixed_size + 3) return errc::protocol_value_error;
 
 	// Parse it
-	int hours;
-	unsigned minutes, seconds, micros = 0;
-	char buffer [max_size + 1] {};
-	memcpy(buffer, from.data(), from.size());
-	int parsed = decimals ? sscanf(buffer, "%4d:%2u:%2u.%6u", &hours, &minutes, &seconds, &micros) : // sign adds 1 char
-			                sscanf(buffer, "%4d:%2u:%2u", &hours, &minutes, &seconds);
-	if ((decimals && parsed != 4) || (!decimals && parsed != 3)) return errc::protocol_value_error;
-	micros *= static_cast<unsigned>(std::pow(10, 6 - decimals));
-	hours = std::abs(hours);
-	bool is_negative = from[0] == '-';
+	unsigned hours, minutes, seconds, micros;
+	if (!parse_time_of_day(from, from.size() - fixed_size, decimals, hours, minutes, seconds, micros))
+	{
+		return errc::protocol_value_error;
+	}
 
 	// Sum it
 	auto res = std::chrono::hours(hours) + std::chrono::minutes(minutes) +
@@ -74,11 +138,11 @@ inline errc deserialize_text_value_impl(
 	unsigned decimals
 )
 {
-	// Length check
+	// Length check: YYYY-MM-DD hh:mm:ss[.f]
 	constexpr std::size_t min_size = 4 + 5*2 + 5; // year, month, day, hour, minute, seconds, separators
 	decimals = std::min(decimals, 6u);
 	std::size_t expected_size = min_size + (decimals ? decimals + 1 : 0);
-	if (from.size() != expected_size) return errc::protocol_value_error;
+	if (from.size() != expected_size || from[10] != ' ') return errc::protocol_value_error;
 
 	// Date part
 	date dt;
@@ -86,24 +150,38 @@ inline errc deserialize_text_value_impl(
 	if (err != errc::ok) return err;
 
 	// Time of day part
-	time time_of_day;
-	err = deserialize_text_value_impl(from.substr(11), time_of_day, decimals);
-	if (err != errc::ok) return err;
-	constexpr auto max_time_of_day = std::chrono::hours(24) - std::chrono::microseconds(1);
-	if (time_of_day < std::chrono::seconds(0) || time_of_day > max_time_of_day) return errc::protocol_value_error;
+	unsigned hours, minutes, seconds, micros;
+	if (!parse_time_of_day(from.substr(11), 2, decimals, hours, minutes, seconds, micros) || hours > 23)
+	{
+		return errc::protocol_value_error;
+	}
 
 	// Sum it up
-	to = dt + time_of_day;
+	to = dt + std::chrono::hours(hours) + std::chrono::minutes(minutes) +
+		 std::chrono::seconds(seconds) + std::chrono::microseconds(micros);
 	return errc::ok;
 }
 
-
+// Integers and floating point values. std::from_chars is locale-independent,
+// does not allocate nor throw, and is exact for floating point values.
+// The whole string must be consumed.
 template <typename T>
 std::enable_if_t<std::is_arithmetic_v<T>, errc>
 deserialize_text_value_impl(std::string_view from, T& to)
 {
-	bool ok = boost::conversion::try_lexical_convert(from.data(), from.size(), to);
-	return ok ? errc::ok : errc::protocol_value_error;
+#ifndef BOOST_MYSQL_HAS_FLOAT_FROM_CHARS
+	if constexpr (std::is_floating_point_v<T>)
+	{
+		bool ok = boost::conversion::try_lexical_convert(from.data(), from.size(), to);
+		return ok ? errc::ok : errc::protocol_value_error;
+	}
+	else
+#endif
+	{
+		const char* last = from.data() + from.size();
+		auto [ptr, ec] = std::from_chars(from.data(), last, to);
+		return ec == std::errc() && ptr == last ? errc::ok : errc::protocol_value_error;
+	}
 }
 
 inline errc deserialize_text_value_impl(std::string_view from, std::string_view& to)
@@ -124,27 +202,60 @@ errc deserialize_text_value_to_variant(std::string_view from, value& to, Args&&.
 	return err;
 }
 
-inline bool is_next_field_null(
-	deserialization_context& ctx
-)
+// Reads a length-encoded integer whose first byte is 0xfc, 0xfd or 0xfe
+inline errc scan_multibyte_length(
+	const std::uint8_t*& it,
+	const std::uint8_t* last,
+	std::uint64_t& length
+) noexcept
 {
-	int1 type_byte;
-	errc err = deserialize(type_byte, ctx);
-	if (err == errc::ok)
+	std::size_t num_bytes = *it == 0xfc ? 2 : (*it == 0xfd ? 3 : 8);
+	++it;
+	if (static_cast<std::size_t>(last - it) < num_bytes) return errc::incomplete_message;
+	length = 0;
+	for (std::size_t i = 0; i < num_bytes; ++i)
 	{
-		if (type_byte.value == 0xfb)
-		{
-			return true; // it was null, do not rewind
-		}
-		ctx.rewind(1); // it was not null, rewind (this byte is part of the actual message)
+		length |= static_cast<std::uint64_t>(it[i]) << (8 * i);
 	}
-	return false;
+	it += num_bytes;
+	return errc::ok;
 }
 
 } // detail
 } // mysql
 } // boost
 
+inline boost::mysql::errc boost::mysql::detail::scan_text_field(
+	deserialization_context& ctx,
+	field_bounds& output
+) noexcept
+{
+	const std::uint8_t* it = ctx.first();
+	const std::uint8_t* last = ctx.last();
+	if (it == last) return errc::incomplete_message;
+	std::uint8_t first_byte = *it;
+	if (first_byte == 0xfb) // NULL
+	{
+		output = field_bounds {nullptr, 0};
+		ctx.advance(1);
+		return errc::ok;
+	}
+	std::uint64_t length = first_byte; // lengths below 251 (the vast majority) take a single byte
+	if (first_byte >= 0xfc && first_byte <= 0xfe)
+	{
+		errc err = scan_multibyte_length(it, last, length);
+		if (err != errc::ok) return err;
+	}
+	else
+	{
+		++it;
+	}
+	if (static_cast<std::uint64_t>(last - it) < length) return errc::incomplete_message;
+	output = field_bounds {reinterpret_cast<const char*>(it), static_cast<std::size_t>(length)};
+	ctx.advance(static_cast<std::size_t>(it - ctx.first()) + static_cast<std::size_t>(length));
+	return errc::ok;
+}
+
 inline boost::mysql::errc boost::mysql::detail::deserialize_text_value(
 	std::string_view from,
 	const field_metadata& meta,
@@ -199,24 +310,24 @@ inline boost::mysql::errc boost::mysql::detail::deserialize_text_value(
 
 boost::mysql::error_code boost::mysql::detail::deserialize_text_row(
 	deserialization_context& ctx,
-	const std::vector<field_metadata>& fields,
-	std::vector<value>& output
+	const resultset_metadata& meta,
+	std::pmr::vector<value>& output
 )
 {
+	const auto& fields = meta.fields();
 	output.resize(fields.size());
-	for (std::vector<value>::size_type i = 0; i < fields.size(); ++i)
+	for (std::pmr::vector<value>::size_type i = 0; i < fields.size(); ++i)
 	{
-		bool is_null = is_next_field_null(ctx);
-		if (is_null)
+		field_bounds bounds;
+		errc err = scan_text_field(ctx, bounds);
+		if (err != errc::ok) return make_error_code(err);
+		if (bounds.is_null() || !meta.is_projected(i))
 		{
 			output[i] = nullptr;
 		}
 		else
 		{
-			string_lenenc value_str;
-			errc err = deserialize(value_str, ctx);
-			if (err != errc::ok) return make_error_code(err);
-			err = deserialize_text_value(value_str.value, fields[i], output[i]);
+			err = deserialize_text_value(bounds.value(), fields[i], output[i]);
 			if (err != errc::ok) return make_error_code(err);
 		}
 	}
@@ -0,0 +1,369 @@
+#ifndef INCLUDE_BOOST_MYSQL_DETAIL_PROTOCOL_IMPL_TYPED_DESERIALIZATION_IPP_
+#define INCLUDE_BOOST_MYSQL_DETAIL_PROTOCOL_IMPL_TYPED_DESERIALIZATION_IPP_
+
+#include "boost/mysql/detail/protocol/text_deserialization.hpp"
+#include "boost/mysql/detail/protocol/binary_deserialization.hpp"
+#include "boost/mysql/detail/protocol/null_bitmap_traits.hpp"
+#include "boost/mysql/column_batch.hpp"
+#include <limits>
+#include <string>
+
+namespace boost {
+namespace mysql {
+namespace detail {
+
+template <typename T>
+struct dependent_false : std::false_type {};
+
+// Number of bits required to hold any value of an integer field, 0 if not an integer
+inline unsigned get_integer_field_bits(protocol_field_type type) noexcept
+{
+	switch (type)
+	{
+	case protocol_field_type::tiny: return 8;
+	case protocol_field_type::short_:
+	case protocol_field_type::year: return 16;
+	case protocol_field_type::int24: return 24;
+	case protocol_field_type::long_: return 32;
+	case protocol_field_type::longlong: return 64;
+	default: return 0;
+	}
+}
+
+template <typename T>
+std::string get_row_member_type_name()
+{
+	using value_type = unwrap_optional_t<T>;
+	std::string res;
+	if constexpr (std::is_integral_v<value_type>)
+	{
+		res = std::is_signed_v<value_type> ? "int" : "uint";
+		res += std::to_string(std::numeric_limits<value_type>::digits + std::is_signed_v<value_type>);
+	}
+	else if constexpr (std::is_same_v<value_type, float>) res = "float";
+	else if constexpr (std::is_same_v<value_type, double>) res = "double";
+	else if constexpr (std::is_same_v<value_type, date>) res = "date";
+	else if constexpr (std::is_same_v<value_type, datetime>) res = "datetime";
+	else if constexpr (std::is_same_v<value_type, time>) res = "time";
+	else res = "string";
+	return res;
+}
+
+template <typename Tuple, std::size_t... I>
+std::string get_row_member_type_name(std::size_t index, std::index_sequence<I...>)
+{
+	std::string res;
+	(void)((I == index ? (res = get_row_member_type_name<std::tuple_element_t<I, Tuple>>(), false) : true) && ...);
+	return res;
+}
+
+// Returns the index of the first field that can't be read into the corresponding
+// member of Tuple, or the number of fields if there is none
+template <typename Tuple, std::size_t... I>
+std::size_t find_incompatible_field(
+	const std::pmr::vector<field_metadata>& fields,
+	std::index_sequence<I...>
+) noexcept
+{
+	std::size_t res = sizeof...(I);
+	(void)((is_compatible_field<std::tuple_element_t<I, Tuple>>(fields[I]) || (res = I, false)) && ...);
+	return res;
+}
+
+// Decodes a single, non-NULL text protocol value into output
+template <typename T>
+errc deserialize_typed_text_value(std::string_view from, const field_metadata& meta, T& output)
+{
+	if constexpr (std::is_same_v<T, double>)
+	{
+		// Parsing FLOATs as float yields the same values as the binary protocol
+		if (meta.protocol_type() == protocol_field_type::float_)
+		{
+			float v;
+			auto err = deserialize_text_value_impl(from, v);
+			output = v;
+			return err;
+		}
+		return deserialize_text_value_impl(from, output);
+	}
+	else if constexpr (std::is_same_v<T, datetime> || std::is_same_v<T, time>)
+	{
+		return deserialize_text_value_impl(from, output, meta.decimals());
+	}
+	else if constexpr (std::is_same_v<T, std::string>)
+	{
+		output.assign(from.data(), from.size());
+		return errc::ok;
+	}
+	else
+	{
+		return deserialize_text_value_impl(from, output);
+	}
+}
+
+template <typename DeserializableType, typename T>
+errc deserialize_typed_binary_int(deserialization_context& ctx, T& output)
+{
+	DeserializableType v;
+	auto err = deserialize(v, ctx);
+	output = static_cast<T>(v.value);
+	return err;
+}
+
+template <typename SignedType, typename UnsignedType, typename T>
+errc deserialize_typed_binary_int(deserialization_context& ctx, bool is_unsigned, T& output)
+{
+	return is_unsigned ? deserialize_typed_binary_int<UnsignedType>(ctx, output) :
+			deserialize_typed_binary_int<SignedType>(ctx, output);
+}
+
+// Decodes a single, non-NULL binary protocol value into output
+template <typename T>
+errc deserialize_typed_binary_value(deserialization_context& ctx, const field_metadata& meta, T& output)
+{
+	if constexpr (std::is_integral_v<T>)
+	{
+		switch (meta.protocol_type())
+		{
+		case protocol_field_type::tiny:
+			return deserialize_typed_binary_int<int1_signed, int1>(ctx, meta.is_unsigned(), output);
+		case protocol_field_type::short_:
+		case protocol_field_type::year:
+			return deserialize_typed_binary_int<int2_signed, int2>(ctx, meta.is_unsigned(), output);
+		case protocol_field_type::int24:
+		case protocol_field_type::long_:
+			return deserialize_typed_binary_int<int4_signed, int4>(ctx, meta.is_unsigned(), output);
+		default:
+			return deserialize_typed_binary_int<int8_signed, int8>(ctx, meta.is_unsigned(), output);
+		}
+	}
+	else if constexpr (std::is_same_v<T, double>)
+	{
+		if (meta.protocol_type() == protocol_field_type::float_)
+		{
+			float v;
+			auto err = deserialize(v, ctx);
+			output = v;
+			return err;
+		}
+		return deserialize(output, ctx);
+	}
+	else if constexpr (std::is_same_v<T, std::string_view> || std::is_same_v<T, std::string>)
+	{
+		string_lenenc v;
+		auto err = deserialize(v, ctx);
+		output = T(v.value.data(), v.value.size());
+		return err;
+	}
+	else
+	{
+		return deserialize(output, ctx);
+	}
+}
+
+// Stores a value into output, which may be a std::optional.
+// decode is only invoked for non-NULL values.
+template <typename T, typename DecodeFn>
+errc assign_typed_field(bool is_null, T& output, DecodeFn&& decode)
+{
+	if constexpr (is_optional<T>::value)
+	{
+		if (is_null)
+		{
+			output.reset();
+			return errc::ok;
+		}
+		return decode(output.emplace());
+	}
+	else
+	{
+		return is_null ? errc::unexpected_null : decode(output);
+	}
+}
+
+template <typename T>
+errc deserialize_typed_text_field(
+	deserialization_context& ctx,
+	const resultset_metadata& meta,
+	std::size_t index,
+	T& output
+)
+{
+	field_bounds bounds;
+	errc err = scan_text_field(ctx, bounds);
+	if (err != errc::ok) return err;
+	return assign_typed_field(bounds.is_null() || !meta.is_projected(index), output, [&](auto& to) {
+		return deserialize_typed_text_value(bounds.value(), meta.fields()[index], to);
+	});
+}
+
+template <typename T>
+errc deserialize_typed_binary_field(
+	deserialization_context& ctx,
+	const resultset_metadata& meta,
+	const std::uint8_t* null_bitmap_begin,
+	std::size_t index,
+	T& output
+)
+{
+	null_bitmap_traits null_bitmap (binary_row_null_bitmap_offset, meta.fields().size());
+	if (null_bitmap.is_null(null_bitmap_begin, index))
+	{
+		return assign_typed_field(true, output, [](auto&) { return errc::ok; });
+	}
+	else if (!meta.is_projected(index))
+	{
+		value ignored; // the plan holds a skipper for this field
+		errc err = meta.binary_plan()[index](ctx, ignored);
+		if (err != errc::ok) return err;
+		return assign_typed_field(true, output, [](auto&) { return errc::ok; });
+	}
+	else
+	{
+		return assign_typed_field(false, output, [&](auto& to) {
+			return deserialize_typed_binary_value(ctx, meta.fields()[index], to);
+		});
+	}
+}
+
+// Decode the fields in order, stopping at the first error
+template <typename Tuple, std::size_t... I>
+errc deserialize_typed_text_fields(
+	deserialization_context& ctx,
+	const resultset_metadata& meta,
+	Tuple& members,
+	std::index_sequence<I...>
+)
+{
+	errc err = errc::ok;
+	(void)(((err = deserialize_typed_text_field(ctx, meta, I, std::get<I>(members))) == errc::ok) && ...);
+	return err;
+}
+
+template <typename Tuple, std::size_t... I>
+errc deserialize_typed_binary_fields(
+	deserialization_context& ctx,
+	const resultset_metadata& meta,
+	Tuple& members,
+	std::index_sequence<I...>
+)
+{
+	// Skip packet header, as deserialize_binary_row does
+	assert(ctx.enough_size(1));
+	ctx.advance(1);
+
+	// Null bitmap
+	null_bitmap_traits null_bitmap (binary_row_null_bitmap_offset, sizeof...(I));
+	const std::uint8_t* null_bitmap_begin = ctx.first();
+	if (!ctx.enough_size(null_bitmap.byte_count())) return errc::incomplete_message;
+	ctx.advance(null_bitmap.byte_count());
+
+	// Actual values
+	errc err = errc::ok;
+	(void)(((err = deserialize_typed_binary_field(ctx, meta, null_bitmap_begin, I, std::get<I>(members)))
+			== errc::ok) && ...);
+	return err;
+}
+
+} // detail
+} // mysql
+} // boost
+
+template <typename T>
+bool boost::mysql::detail::is_compatible_field(
+	const field_metadata& meta
+) noexcept
+{
+	using value_type = unwrap_optional_t<T>;
+	auto type = meta.protocol_type();
+	if constexpr (std::is_same_v<value_type, bool>)
+	{
+		static_assert(dependent_false<T>::value, "bool is not supported as a row member type");
+	}
+	else if constexpr (std::is_integral_v<value_type>)
+	{
+		unsigned bits = get_integer_field_bits(type);
+		if (bits == 0) return false;
+		constexpr unsigned value_bits = std::numeric_limits<value_type>::digits; // excluding the sign bit
+		return meta.is_unsigned() ? value_bits >= bits : std::is_signed_v<value_type> && value_bits + 1 >= bits;
+	}
+	else if constexpr (std::is_same_v<value_type, float>)
+	{
+		return type == protocol_field_type::float_;
+	}
+	else if constexpr (std::is_same_v<value_type, double>)
+	{
+		return type == protocol_field_type::float_ || type == protocol_field_type::double_;
+	}
+	else if constexpr (std::is_same_v<value_type, date>)
+	{
+		return type == protocol_field_type::date;
+	}
+	else if constexpr (std::is_same_v<value_type, datetime>)
+	{
+		return type == protocol_field_type::datetime || type == protocol_field_type::timestamp;
+	}
+	else if constexpr (std::is_same_v<value_type, time>)
+	{
+		return type == protocol_field_type::time;
+	}
+	else if constexpr (std::is_same_v<value_type, std::string_view> || std::is_same_v<value_type, std::string>)
+	{
+		return get_column_kind(meta) == column_kind::string;
+	}
+	else
+	{
+		static_assert(dependent_false<T>::value, "Unsupported row member type");
+	}
+	return false;
+}
+
+template <typename RowType>
+boost::mysql::errc boost::mysql::detail::check_row_type(
+	const std::pmr::vector<field_metadata>& fields,
+	error_info& info
+)
+{
+	using tuple_type = row_tuple_t<RowType>;
+	constexpr std::size_t num_members = std::tuple_size_v<tuple_type>;
+	if (fields.size() != num_members)
+	{
+		info.set_message(
+			"The resultset has " + std::to_string(fields.size()) +
+			" fields, but the row type has " + std::to_string(num_members) + " members"
+		);
+		return errc::row_type_mismatch;
+	}
+	std::size_t index = find_incompatible_field<tuple_type>(fields, std::make_index_sequence<num_members>());
+	if (index != num_members)
+	{
+		info.set_message(
+			"Field " + std::to_string(index) + " ('" + std::string(fields[index].field_name()) +
+			"') can not be read into a member of type " +
+			get_row_member_type_name<tuple_type>(index, std::make_index_sequence<num_members>())
+		);
+		return errc::row_type_mismatch;
+	}
+	return errc::ok;
+}
+
+template <typename RowType>
+boost::mysql::error_code boost::mysql::detail::deserialize_typed_row(
+	deserialization_context& ctx,
+	const resultset_metadata& meta,
+	bool binary,
+	RowType& output
+)
+{
+	auto members = tie_row(output);
+	using members_type = decltype(members);
+	constexpr std::size_t num_members = std::tuple_size_v<members_type>;
+	assert(meta.fields().size() == num_members);
+	errc err = binary ?
+			deserialize_typed_binary_fields(ctx, meta, members, std::make_index_sequence<num_members>()) :
+			deserialize_typed_text_fields(ctx, meta, members, std::make_index_sequence<num_members>());
+	if (err == errc::ok && !ctx.empty()) err = errc::extra_bytes;
+	return err == errc::ok ? error_code() : make_error_code(err);
+}
+
+#endif /* INCLUDE_BOOST_MYSQL_DETAIL_PROTOCOL_IMPL_TYPED_DESERIALIZATION_IPP_ */
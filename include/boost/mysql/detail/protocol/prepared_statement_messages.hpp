@@ -34,7 +34,7 @@ struct com_stmt_prepare_ok_packet
 	int2 num_params;
 	// int1 reserved_1: must be 0
 	int2 warning_count;
-	// TODO: int1 metadata_follows when CLIENT_OPTIONAL_RESULTSET_METADATA
+	int1 metadata_follows {resultset_metadata_full}; // only sent when CLIENT_OPTIONAL_RESULTSET_METADATA
 };
 
 template <>
@@ -44,7 +44,8 @@ struct get_struct_fields<com_stmt_prepare_ok_packet>
 		&com_stmt_prepare_ok_packet::statement_id,
 		&com_stmt_prepare_ok_packet::num_columns,
 		&com_stmt_prepare_ok_packet::num_params,
-		&com_stmt_prepare_ok_packet::warning_count
+		&com_stmt_prepare_ok_packet::warning_count,
+		&com_stmt_prepare_ok_packet::metadata_follows
 	);
 };
 
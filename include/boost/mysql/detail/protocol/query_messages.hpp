@@ -2,6 +2,7 @@
 #define INCLUDE_BOOST_MYSQL_DETAIL_PROTOCOL_QUERY_MESSAGES_HPP_
 
 #include "boost/mysql/detail/protocol/serialization.hpp"
+#include "boost/mysql/detail/protocol/constants.hpp"
 #include <tuple>
 
 namespace boost {
@@ -23,8 +24,51 @@ struct get_struct_fields<com_query_packet>
 	);
 };
 
+// First packet of a response containing a resultset
+struct resultset_head_packet
+{
+	int_lenenc num_columns;
+	int1 metadata_follows {resultset_metadata_full}; // only sent when CLIENT_OPTIONAL_RESULTSET_METADATA
+};
+
+template <>
+struct get_struct_fields<resultset_head_packet>
+{
+	static constexpr auto value = std::make_tuple(
+		&resultset_head_packet::num_columns,
+		&resultset_head_packet::metadata_follows
+	);
+};
+
+template <>
+struct serialization_traits<resultset_head_packet, serialization_tag::struct_with_fields> :
+	noop_serialize<resultset_head_packet>
+{
+	static inline errc deserialize_(resultset_head_packet& output,
+			deserialization_context& ctx) noexcept;
+};
+
+}
 }
 }
+
+inline boost::mysql::errc
+boost::mysql::detail::serialization_traits<
+	boost::mysql::detail::resultset_head_packet,
+	boost::mysql::detail::serialization_tag::struct_with_fields
+>::deserialize_(
+	resultset_head_packet& output,
+	deserialization_context& ctx
+) noexcept
+{
+	auto err = deserialize(output.num_columns, ctx);
+	if (err != errc::ok) return err;
+	if (ctx.get_capabilities().has(CLIENT_OPTIONAL_RESULTSET_METADATA))
+	{
+		return deserialize(output.metadata_follows, ctx);
+	}
+	output.metadata_follows = int1(resultset_metadata_full);
+	return errc::ok;
 }
 
 #endif /* INCLUDE_BOOST_MYSQL_DETAIL_PROTOCOL_QUERY_MESSAGES_HPP_ */
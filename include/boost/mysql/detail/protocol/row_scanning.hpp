@@ -0,0 +1,58 @@
+#ifndef MYSQL_ASIO_DETAIL_PROTOCOL_ROW_SCANNING_HPP
+#define MYSQL_ASIO_DETAIL_PROTOCOL_ROW_SCANNING_HPP
+
+#include "boost/mysql/error.hpp"
+#include "boost/mysql/metadata.hpp"
+#include "boost/mysql/detail/protocol/text_deserialization.hpp"
+#include <boost/asio/buffer.hpp>
+#include <cstdint>
+#include <memory_resource>
+#include <vector>
+
+namespace boost {
+namespace mysql {
+namespace detail {
+
+// Where a field is within a row message, as found by locate_field
+struct field_location
+{
+	std::size_t bytes_needed {0}; // if not zero, the row prefix was too short; get these many more bytes and retry
+	std::size_t header_offset {0}; // offset of the first byte encoding the field (its length, if any)
+	std::size_t value_offset {0}; // offset of the field's actual value
+	std::uint64_t value_size {0};
+	bool is_null {false};
+};
+
+// Scans the beginning of a (text or binary) row message, without reading
+// the target field's value. row_prefix should contain the first bytes of
+// the message, including the message type byte for binary rows.
+// The target field must have a string-like type (see is_streamable_field).
+inline errc locate_field(
+	boost::asio::const_buffer row_prefix,
+	const std::pmr::vector<field_metadata>& meta,
+	std::size_t field_index,
+	bool binary,
+	field_location& output
+);
+
+// Splits a complete (text or binary) row message into the bounds of its
+// fields, without decoding them. output must have room for meta.size() fields.
+// Text bounds cover the value, as expected by deserialize_text_value. Binary
+// bounds include the length prefix (if any), as expected by binary_value_decoder.
+inline errc split_row(
+	deserialization_context& ctx,
+	const std::pmr::vector<field_metadata>& meta,
+	bool binary,
+	field_bounds* output
+);
+
+// Whether the field is encoded as a length-encoded string in both protocols
+inline bool is_streamable_field(const field_metadata& meta) noexcept;
+
+} // detail
+} // mysql
+} // boost
+
+#include "boost/mysql/detail/protocol/impl/row_scanning.ipp"
+
+#endif
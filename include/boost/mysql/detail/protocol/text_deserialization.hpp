@@ -17,10 +17,26 @@ inline errc deserialize_text_value(
 	value& output
 );
 
+// The location of a field within a (text or binary) row message
+struct field_bounds
+{
+	const char* data; // points into the message, nullptr for NULL fields
+	std::size_t size;
+
+	bool is_null() const noexcept { return data == nullptr; }
+	std::string_view value() const noexcept { return std::string_view(data, size); }
+};
+
+// Locates the next field in a text row, advancing ctx past it
+inline errc scan_text_field(
+	deserialization_context& ctx,
+	field_bounds& output
+) noexcept;
+
 inline error_code deserialize_text_row(
 	deserialization_context& ctx,
-	const std::vector<field_metadata>& meta,
-	std::vector<value>& output
+	const resultset_metadata& meta,
+	std::pmr::vector<value>& output
 );
 
 } // detail
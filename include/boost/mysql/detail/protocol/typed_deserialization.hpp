@@ -0,0 +1,74 @@
+#ifndef INCLUDE_BOOST_MYSQL_DETAIL_PROTOCOL_TYPED_DESERIALIZATION_HPP_
+#define INCLUDE_BOOST_MYSQL_DETAIL_PROTOCOL_TYPED_DESERIALIZATION_HPP_
+
+#include "boost/mysql/detail/protocol/serialization.hpp"
+#include "boost/mysql/detail/auxiliar/struct_tie.hpp"
+#include "boost/mysql/error.hpp"
+#include "boost/mysql/metadata.hpp"
+#include <memory_resource>
+#include <optional>
+#include <string_view>
+#include <vector>
+
+namespace boost {
+namespace mysql {
+namespace detail {
+
+template <typename T>
+struct is_optional : std::false_type {};
+
+template <typename T>
+struct is_optional<std::optional<T>> : std::true_type {};
+
+template <typename T>
+struct unwrap_optional { using type = T; };
+
+template <typename T>
+struct unwrap_optional<std::optional<T>> { using type = T; };
+
+template <typename T>
+using unwrap_optional_t = typename unwrap_optional<T>::type;
+
+// Whether a row type has members pointing into the message they were read from
+template <typename Tuple>
+struct tuple_has_views;
+
+template <typename... T>
+struct tuple_has_views<std::tuple<T...>>
+	: std::disjunction<std::is_same<unwrap_optional_t<T>, std::string_view>...> {};
+
+template <typename RowType>
+constexpr bool row_type_has_views = tuple_has_views<row_tuple_t<RowType>>::value;
+
+// An object whose address identifies RowType
+template <typename RowType>
+inline constexpr char row_type_tag = 0;
+
+// Whether a non-NULL value of a field with metadata meta can be read into a T,
+// which may be a std::optional. Integers must be able to hold any value
+// of the field, given its width and signedness.
+template <typename T>
+bool is_compatible_field(const field_metadata& meta) noexcept;
+
+// Checks that rows with the given fields can be read into a RowType.
+// On failure, returns errc::row_type_mismatch and describes the problem in info.
+template <typename RowType>
+errc check_row_type(const std::pmr::vector<field_metadata>& fields, error_info& info);
+
+// Decodes a (text or binary) row message into output. check_row_type
+// must have succeeded for meta's fields.
+template <typename RowType>
+error_code deserialize_typed_row(
+	deserialization_context& ctx,
+	const resultset_metadata& meta,
+	bool binary,
+	RowType& output
+);
+
+} // detail
+} // mysql
+} // boost
+
+#include "boost/mysql/detail/protocol/impl/typed_deserialization.ipp"
+
+#endif /* INCLUDE_BOOST_MYSQL_DETAIL_PROTOCOL_TYPED_DESERIALIZATION_HPP_ */
@@ -23,7 +23,13 @@ enum class errc : int
 	server_unsupported,
 	protocol_value_error,
 	unknown_auth_plugin,
-	wrong_num_params
+	wrong_num_params,
+	server_doesnt_support_ssl,
+	missing_metadata,
+
+	// Typed fetch errors
+	row_type_mismatch,
+	unexpected_null
 };
 
 /// An alias for boost::system error codes.
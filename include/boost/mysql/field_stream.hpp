@@ -0,0 +1,164 @@
+#ifndef MYSQL_ASIO_FIELD_STREAM_HPP
+#define MYSQL_ASIO_FIELD_STREAM_HPP
+
+#include "boost/mysql/resultset.hpp"
+#include "boost/mysql/row.hpp"
+#include "boost/mysql/error.hpp"
+#include "boost/mysql/detail/protocol/row_scanning.hpp"
+#include "boost/mysql/detail/auxiliar/bytestring.hpp"
+#include <boost/asio/buffer.hpp>
+#include <boost/asio/async_result.hpp>
+#include <boost/asio/ip/tcp.hpp>
+#include <boost/asio/local/stream_protocol.hpp>
+#include <cassert>
+
+namespace boost {
+namespace mysql {
+
+/**
+ * \brief Reads a single field of each row of a resultset incrementally.
+ * \details Use this class to read BLOB and TEXT values that are too big
+ * to be held in memory: they are never materialized as a whole. Instead,
+ * you read them in chunks of your choice, as you would read from a socket.
+ *
+ * The streamed field is chosen at construction, and must have a string-like
+ * type (strings, blobs, enums, sets, decimals, bits and geometries).
+ * Call next_row() to advance to the next row of the resultset, and
+ * then read_some() until it fails with boost::asio::error::eof to
+ * get the field's contents. field_stream satisfies the SyncReadStream
+ * and AsyncReadStream concepts, so boost::asio::read and boost::asio::async_read
+ * can be used, too.
+ *
+ * The other fields of each row are read normally: after the streamed
+ * field has been completely read, they can be accessed using current_row().
+ * In that row, the streamed field appears as an empty string (or NULL).
+ * Peak memory usage is bounded by the connection's read buffer plus the
+ * size of the other fields.
+ *
+ * The resultset must outlive the field_stream, and should not be used
+ * while the stream is reading from it. If you call next_row() before
+ * finishing with the current row, the rest of it is discarded.
+ */
+template <
+	typename StreamType
+>
+class field_stream
+{
+	using channel_type = detail::channel<StreamType>;
+
+	enum class state_t
+	{
+		idle,      // no row being read
+		field,     // streaming the field's value
+		tail,      // the field's value has been read, the rest of the packet has not
+		row_ready  // the whole row has been read and deserialized
+	};
+
+	resultset<StreamType>* resultset_;
+	std::size_t field_index_;
+	detail::resource_bytestring buffer_; // message being read, with the streamed value replaced by an empty string
+	std::size_t filled_ {0}; // bytes of buffer_ already read; the rest is where reads go
+	std::size_t first_frame_size_ {0};
+	detail::field_location location_;
+	std::uint64_t remaining_ {0};
+	state_t state_ {state_t::idle};
+	bool is_row_ {false}; // as opposed to an EOF or error packet
+	row current_row_;
+
+	channel_type& channel() noexcept { return *resultset_->channel_; }
+	bool is_binary() const noexcept { return resultset_->is_binary(); }
+
+	// Non-I/O logic, shared between the sync and async algorithms
+	boost::asio::mutable_buffer free_area() noexcept;
+	void prepare_read(std::size_t size);
+	void start_row(std::size_t first_frame_size);
+	std::size_t process_prefix(error_code& err); // returns how many more bytes we need
+	bool finish_row(error_code& err, error_info& info); // the whole packet is in buffer_
+
+	void discard_row(error_code& err);
+	void read_prefix(std::size_t size, error_code& err);
+	void read_tail(error_code& err);
+public:
+	/**
+	 * \brief Constructs a stream for the field at position field_index in resultset.
+	 * \details The resultset must be valid and contain at least field_index + 1 fields.
+	 */
+	field_stream(resultset<StreamType>& resultset, std::size_t field_index);
+
+	/// The executor type associated to this object.
+	using executor_type = typename StreamType::executor_type;
+
+	/// Retrieves the executor associated to this object.
+	executor_type get_executor() { return channel().next_layer().get_executor(); }
+
+	/**
+	 * \brief Advances to the next row (sync with error code version).
+	 * \details Returns false if there are no more rows. After this
+	 * function returns true, use read_some() to read the field's value.
+	 */
+	bool next_row(error_code& err, error_info& info);
+
+	/// Advances to the next row (sync with exceptions version).
+	bool next_row();
+
+	/// Handler signature for next_row.
+	using next_row_signature = void(error_code, bool);
+
+	/// Advances to the next row (async version).
+	template <typename CompletionToken>
+	BOOST_ASIO_INITFN_RESULT_TYPE(CompletionToken, next_row_signature)
+	async_next_row(CompletionToken&& token, error_info* info=nullptr);
+
+	/**
+	 * \brief Reads part of the field's value (sync with error code version).
+	 * \details Reads at least one byte, unless the value has been completely
+	 * read, in which case err is set to boost::asio::error::eof.
+	 */
+	template <typename MutableBufferSequence>
+	std::size_t read_some(const MutableBufferSequence& buffers, error_code& err);
+
+	/// Reads part of the field's value (sync with exceptions version).
+	template <typename MutableBufferSequence>
+	std::size_t read_some(const MutableBufferSequence& buffers);
+
+	/// Handler signature for read_some.
+	using read_some_signature = void(error_code, std::size_t);
+
+	/// Reads part of the field's value (async version).
+	template <typename MutableBufferSequence, typename CompletionToken>
+	BOOST_ASIO_INITFN_RESULT_TYPE(CompletionToken, read_some_signature)
+	async_read_some(const MutableBufferSequence& buffers, CompletionToken&& token);
+
+	/// Whether the field is NULL in the current row. A NULL field reads as empty.
+	bool is_null() const noexcept { assert(state_ != state_t::idle); return location_.is_null; }
+
+	/// The total size of the field in the current row, in bytes.
+	std::uint64_t size() const noexcept { assert(state_ != state_t::idle); return location_.value_size; }
+
+	/// The number of bytes of the field in the current row that have not been read yet.
+	std::uint64_t remaining() const noexcept { return remaining_; }
+
+	/**
+	 * \brief The current row, with the streamed field replaced by an empty string.
+	 * \details Only valid after the streamed field has been completely read.
+	 * Calling next_row() invalidates the returned row.
+	 */
+	const row& current_row() const noexcept { assert(state_ == state_t::row_ready); return current_row_; }
+};
+
+/// Specialization of field_stream for TCP sockets.
+using tcp_field_stream = field_stream<boost::asio::ip::tcp::socket>;
+
+#ifdef BOOST_ASIO_HAS_LOCAL_SOCKETS
+
+/// Specialization of field_stream for UNIX sockets.
+using local_field_stream = field_stream<boost::asio::local::stream_protocol::socket>;
+
+#endif
+
+} // mysql
+} // boost
+
+#include "boost/mysql/impl/field_stream.hpp"
+
+#endif
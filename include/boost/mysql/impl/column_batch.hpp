@@ -0,0 +1,152 @@
+#ifndef INCLUDE_BOOST_MYSQL_IMPL_COLUMN_BATCH_HPP_
+#define INCLUDE_BOOST_MYSQL_IMPL_COLUMN_BATCH_HPP_
+
+inline boost::mysql::column_kind boost::mysql::get_column_kind(
+	const field_metadata& meta
+) noexcept
+{
+	switch (meta.type())
+	{
+	case field_type::tinyint:
+	case field_type::smallint:
+	case field_type::mediumint:
+	case field_type::int_:
+	case field_type::bigint:
+	case field_type::year:
+		return meta.is_unsigned() ? column_kind::uint64 : column_kind::int64;
+	case field_type::float_:
+	case field_type::double_:
+		return column_kind::double_;
+	case field_type::date:
+		return column_kind::date;
+	case field_type::datetime:
+	case field_type::timestamp:
+		return column_kind::datetime;
+	case field_type::time:
+		return column_kind::time;
+	default:
+		return column_kind::string;
+	}
+}
+
+inline boost::mysql::column::column(
+	column_kind kind,
+	std::pmr::memory_resource* resource
+):
+	kind_(kind),
+	validity_(resource),
+	int64_values_(resource),
+	uint64_values_(resource),
+	double_values_(resource),
+	string_offsets_(resource),
+	string_data_(resource)
+{
+	if (kind_ == column_kind::string)
+	{
+		string_offsets_.push_back(0);
+	}
+}
+
+inline void boost::mysql::column::set_valid(
+	bool valid
+)
+{
+	if (size_ % 8 == 0)
+	{
+		validity_.push_back(0);
+	}
+	auto mask = static_cast<std::uint8_t>(1 << (size_ % 8));
+	if (valid) validity_.back() |= mask;
+	else validity_.back() &= ~mask;
+	++size_;
+}
+
+inline void boost::mysql::column::append_null()
+{
+	switch (kind_)
+	{
+	case column_kind::uint64: uint64_values_.push_back(0); break;
+	case column_kind::double_: double_values_.push_back(0); break;
+	case column_kind::string: string_offsets_.push_back(string_data_.size()); break;
+	default: int64_values_.push_back(0); break;
+	}
+	set_valid(false);
+}
+
+inline void boost::mysql::column::append(
+	std::int64_t v
+)
+{
+	assert(kind_ != column_kind::uint64 && kind_ != column_kind::double_ && kind_ != column_kind::string);
+	int64_values_.push_back(v);
+	set_valid(true);
+}
+
+inline void boost::mysql::column::append(
+	std::uint64_t v
+)
+{
+	assert(kind_ == column_kind::uint64);
+	uint64_values_.push_back(v);
+	set_valid(true);
+}
+
+inline void boost::mysql::column::append(
+	double v
+)
+{
+	assert(kind_ == column_kind::double_);
+	double_values_.push_back(v);
+	set_valid(true);
+}
+
+inline void boost::mysql::column::append(
+	std::string_view v
+)
+{
+	assert(kind_ == column_kind::string);
+	string_data_.insert(string_data_.end(), v.begin(), v.end());
+	string_offsets_.push_back(string_data_.size());
+	set_valid(true);
+}
+
+inline void boost::mysql::column::truncate(
+	std::size_t new_size
+)
+{
+	if (new_size >= size_) return;
+	size_ = new_size;
+	validity_.resize((new_size + 7) / 8);
+	switch (kind_)
+	{
+	case column_kind::uint64: uint64_values_.resize(new_size); break;
+	case column_kind::double_: double_values_.resize(new_size); break;
+	case column_kind::string:
+		string_offsets_.resize(new_size + 1);
+		string_data_.resize(string_offsets_.back());
+		break;
+	default: int64_values_.resize(new_size); break;
+	}
+}
+
+inline boost::mysql::column_batch::column_batch(
+	const std::pmr::vector<field_metadata>& fields,
+	std::pmr::memory_resource* resource
+)
+{
+	columns_.reserve(fields.size());
+	for (const auto& field: fields)
+	{
+		columns_.emplace_back(get_column_kind(field), resource);
+	}
+}
+
+inline void boost::mysql::column_batch::discard_row()
+{
+	for (auto& col: columns_)
+	{
+		col.truncate(num_rows_);
+	}
+}
+
+#endif /* INCLUDE_BOOST_MYSQL_IMPL_COLUMN_BATCH_HPP_ */
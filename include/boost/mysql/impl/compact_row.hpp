@@ -0,0 +1,82 @@
+#ifndef INCLUDE_BOOST_MYSQL_IMPL_COMPACT_ROW_HPP_
+#define INCLUDE_BOOST_MYSQL_IMPL_COMPACT_ROW_HPP_
+
+#include <cstring>
+#include <new>
+
+inline boost::mysql::compact_row::compact_row(
+	const row& r,
+	std::pmr::memory_resource* resource
+) :
+	resource_(resource)
+{
+	const auto& input = r.values();
+	if (input.empty()) return;
+
+	// Values first, then all string bytes, one after another
+	std::size_t values_size = input.size() * sizeof(compact_value);
+	std::size_t allocated_size = values_size;
+	for (const auto& v: input)
+	{
+		if (const auto* s = std::get_if<std::string_view>(&v)) allocated_size += s->size();
+	}
+	void* block = resource_->allocate(allocated_size, alignof(compact_value));
+	values_ = static_cast<compact_value*>(block);
+	allocated_size_ = allocated_size;
+	size_ = input.size();
+
+	char* strings = static_cast<char*>(block) + values_size;
+	for (std::size_t i = 0; i < input.size(); ++i)
+	{
+		if (const auto* s = std::get_if<std::string_view>(&input[i]))
+		{
+			if (!s->empty()) std::memcpy(strings, s->data(), s->size());
+			new (values_ + i) compact_value(value(std::string_view(strings, s->size())));
+			strings += s->size();
+		}
+		else
+		{
+			new (values_ + i) compact_value(input[i]);
+		}
+	}
+}
+
+inline void boost::mysql::compact_row::deallocate() noexcept
+{
+	// compact_value is trivially destructible
+	if (values_)
+	{
+		resource_->deallocate(values_, allocated_size_, alignof(compact_value));
+		values_ = nullptr;
+		size_ = 0;
+		allocated_size_ = 0;
+	}
+}
+
+inline boost::mysql::compact_row& boost::mysql::compact_row::operator=(
+	compact_row&& rhs
+) noexcept
+{
+	if (this != &rhs)
+	{
+		deallocate();
+		resource_ = rhs.resource_;
+		values_ = std::exchange(rhs.values_, nullptr);
+		size_ = std::exchange(rhs.size_, 0);
+		allocated_size_ = std::exchange(rhs.allocated_size_, 0);
+	}
+	return *this;
+}
+
+inline boost::mysql::row boost::mysql::compact_row::to_row() const
+{
+	std::pmr::vector<value> res;
+	res.reserve(size_);
+	for (const auto& v: *this)
+	{
+		res.push_back(v.to_value());
+	}
+	return row(std::move(res));
+}
+
+#endif /* INCLUDE_BOOST_MYSQL_IMPL_COMPACT_ROW_HPP_ */
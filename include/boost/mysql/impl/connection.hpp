@@ -19,7 +19,11 @@ inline handshake_params to_handshake_params(
 		input.connection_collation,
 		input.username,
 		input.password,
-		input.database
+		input.database,
+		input.compression,
+		input.compression_threshold,
+		input.ssl,
+		input.ssl_sessions
 	};
 }
 
@@ -30,6 +30,10 @@ inline const char* error_to_string(errc error) noexcept
 	case errc::protocol_value_error: return "A field in a message had an unexpected value";
 	case errc::unknown_auth_plugin: return "The user employs an authentication plugin unknown to the client";
 	case errc::wrong_num_params: return "The provided parameter count does not match the prepared statement parameter count";
+	case errc::server_doesnt_support_ssl: return "The server does not support SSL, but the client required it";
+	case errc::missing_metadata: return "The server did not send the resultset metadata, and the client has no cached copy of it. The rows were discarded";
+	case errc::row_type_mismatch: return "The resultset fields can not be read into the requested C++ types";
+	case errc::unexpected_null: return "A NULL value was read into a C++ type that is not a std::optional";
 
 	#include "boost/mysql/impl/server_error_descriptions.hpp"
 
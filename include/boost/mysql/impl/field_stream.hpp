@@ -0,0 +1,563 @@
+#ifndef MYSQL_ASIO_IMPL_FIELD_STREAM_HPP
+#define MYSQL_ASIO_IMPL_FIELD_STREAM_HPP
+
+#include "boost/mysql/detail/network_algorithms/read_row.hpp"
+#include "boost/mysql/detail/protocol/constants.hpp"
+#include "boost/mysql/detail/auxiliar/check_completion_token.hpp"
+#include <boost/asio/coroutine.hpp>
+#include <boost/asio/error.hpp>
+#include <boost/beast/core/async_base.hpp>
+#include <algorithm>
+#include <boost/asio/yield.hpp>
+
+namespace boost {
+namespace mysql {
+namespace detail {
+
+// Granularity when reading the part of a row after the streamed field,
+// or when discarding what remains of a row
+constexpr std::size_t field_stream_chunk_size = 4096;
+
+template <typename MutableBufferSequence>
+boost::asio::mutable_buffer first_nonempty_buffer(const MutableBufferSequence& buffers)
+{
+	auto last = boost::asio::buffer_sequence_end(buffers);
+	for (auto it = boost::asio::buffer_sequence_begin(buffers); it != last; ++it)
+	{
+		boost::asio::mutable_buffer res (*it);
+		if (res.size() != 0) return res;
+	}
+	return boost::asio::mutable_buffer();
+}
+
+} // detail
+} // mysql
+} // boost
+
+template <typename StreamType>
+boost::mysql::field_stream<StreamType>::field_stream(
+	resultset<StreamType>& resultset,
+	std::size_t field_index
+):
+	resultset_(&resultset),
+	field_index_(field_index),
+	buffer_(resultset.memory_resource()),
+	current_row_(resultset.memory_resource())
+{
+	assert(resultset.valid());
+	assert(field_index < resultset.fields().size());
+	assert(detail::is_streamable_field(resultset.fields()[field_index]));
+}
+
+template <typename StreamType>
+boost::asio::mutable_buffer boost::mysql::field_stream<StreamType>::free_area() noexcept
+{
+	return boost::asio::buffer(buffer_) + filled_;
+}
+
+template <typename StreamType>
+void boost::mysql::field_stream<StreamType>::prepare_read(
+	std::size_t size
+)
+{
+	buffer_.resize(filled_ + size);
+}
+
+template <typename StreamType>
+void boost::mysql::field_stream<StreamType>::start_row(
+	std::size_t first_frame_size
+)
+{
+	first_frame_size_ = first_frame_size;
+	buffer_.clear();
+	filled_ = 0;
+	location_ = detail::field_location();
+	remaining_ = 0;
+}
+
+template <typename StreamType>
+std::size_t boost::mysql::field_stream<StreamType>::process_prefix(
+	error_code& err
+)
+{
+	// The first byte tells us whether this is a row or not. As in the
+	// rest of the protocol, 0xfe introduces an EOF packet only if the
+	// packet is small; otherwise, it is a big text field length.
+	if (filled_ == 1)
+	{
+		std::uint8_t msg_type = buffer_[0];
+		if (
+			msg_type == detail::error_packet_header ||
+			(msg_type == detail::eof_packet_header && first_frame_size_ < detail::MAX_PACKET_SIZE)
+		)
+		{
+			is_row_ = false;
+			state_ = state_t::tail;
+			return 0;
+		}
+	}
+
+	auto code = detail::locate_field(
+		boost::asio::buffer(buffer_.data(), filled_),
+		resultset_->fields(),
+		field_index_,
+		is_binary(),
+		location_
+	);
+	if (code != errc::ok)
+	{
+		err = detail::make_error_code(code);
+		return 0;
+	}
+	if (location_.bytes_needed)
+	{
+		return location_.bytes_needed;
+	}
+
+	// Replace the value by an empty string, so the row can be deserialized as usual
+	// once we have the rest of it. NULL values are left untouched.
+	if (!location_.is_null)
+	{
+		buffer_.resize(location_.header_offset);
+		buffer_.push_back(0);
+		filled_ = buffer_.size();
+	}
+	is_row_ = true;
+	remaining_ = location_.value_size;
+	state_ = remaining_ ? state_t::field : state_t::tail;
+	return 0;
+}
+
+template <typename StreamType>
+bool boost::mysql::field_stream<StreamType>::finish_row(
+	error_code& err,
+	error_info& info
+)
+{
+	buffer_.resize(filled_);
+	state_ = state_t::idle;
+	if (!is_row_)
+	{
+		auto result = detail::process_read_message(
+			resultset_->deserializer_,
+			channel().current_capabilities(),
+			resultset_->meta_,
+			boost::asio::buffer(buffer_),
+			current_row_.values(),
+			resultset_->ok_packet_,
+			err,
+			info
+		);
+		resultset_->eof_received_ = result == detail::read_row_result::eof;
+		resultset_->trace_fetch(0, err, info);
+		return false;
+	}
+	detail::deserialization_context ctx (boost::asio::buffer(buffer_), channel().current_capabilities());
+	err = resultset_->deserializer_(ctx, resultset_->meta_, current_row_.values());
+	if (err) return false;
+	state_ = state_t::row_ready;
+	return true;
+}
+
+template <typename StreamType>
+void boost::mysql::field_stream<StreamType>::discard_row(
+	error_code& err
+)
+{
+	filled_ = 0;
+	while (!channel().packet_complete())
+	{
+		prepare_read(detail::field_stream_chunk_size);
+		channel().read_packet_some(free_area(), err);
+		if (err) return;
+	}
+	state_ = state_t::idle;
+}
+
+template <typename StreamType>
+void boost::mysql::field_stream<StreamType>::read_prefix(
+	std::size_t size,
+	error_code& err
+)
+{
+	prepare_read(size);
+	while (filled_ < buffer_.size())
+	{
+		std::size_t bytes_read = channel().read_packet_some(free_area(), err);
+		if (err) return;
+		if (bytes_read == 0)
+		{
+			err = detail::make_error_code(errc::incomplete_message);
+			return;
+		}
+		filled_ += bytes_read;
+	}
+}
+
+template <typename StreamType>
+void boost::mysql::field_stream<StreamType>::read_tail(
+	error_code& err
+)
+{
+	std::size_t bytes_read = 0;
+	do
+	{
+		prepare_read(detail::field_stream_chunk_size);
+		bytes_read = channel().read_packet_some(free_area(), err);
+		if (err) return;
+		filled_ += bytes_read;
+	} while (bytes_read);
+}
+
+template <typename StreamType>
+bool boost::mysql::field_stream<StreamType>::next_row(
+	error_code& err,
+	error_info& info
+)
+{
+	err.clear();
+	info.clear();
+
+	discard_row(err);
+	if (err) return false;
+	if (resultset_->complete()) return false;
+
+	std::size_t first_frame_size = channel().begin_read_packet(err);
+	if (err) return false;
+	start_row(first_frame_size);
+
+	std::size_t bytes_needed = 1;
+	while (bytes_needed)
+	{
+		read_prefix(bytes_needed, err);
+		if (err) return false;
+		bytes_needed = process_prefix(err);
+		if (err) return false;
+	}
+
+	// Messages and empty values: read everything right now
+	if (state_ == state_t::tail)
+	{
+		read_tail(err);
+		if (err) return false;
+		return finish_row(err, info);
+	}
+	return true;
+}
+
+template <typename StreamType>
+bool boost::mysql::field_stream<StreamType>::next_row()
+{
+	error_code code;
+	error_info info;
+	bool res = next_row(code, info);
+	detail::check_error_code(code, info);
+	return res;
+}
+
+template <typename StreamType>
+template <typename MutableBufferSequence>
+std::size_t boost::mysql::field_stream<StreamType>::read_some(
+	const MutableBufferSequence& buffers,
+	error_code& err
+)
+{
+	err.clear();
+	auto buffer = detail::first_nonempty_buffer(buffers);
+	if (state_ != state_t::field)
+	{
+		err = boost::asio::error::eof;
+		return 0;
+	}
+	if (buffer.size() == 0) return 0;
+
+	std::size_t bytes_read = channel().read_packet_some(
+		boost::asio::buffer(buffer, static_cast<std::size_t>(std::min<std::uint64_t>(buffer.size(), remaining_))),
+		err
+	);
+	if (err) return 0;
+	if (bytes_read == 0)
+	{
+		err = detail::make_error_code(errc::incomplete_message);
+		return 0;
+	}
+	remaining_ -= bytes_read;
+
+	// Done with the field: get the rest of the row
+	if (remaining_ == 0)
+	{
+		state_ = state_t::tail;
+		read_tail(err);
+		if (!err)
+		{
+			error_info info; // rows don't carry any error information
+			finish_row(err, info);
+		}
+	}
+	return bytes_read;
+}
+
+template <typename StreamType>
+template <typename MutableBufferSequence>
+std::size_t boost::mysql::field_stream<StreamType>::read_some(
+	const MutableBufferSequence& buffers
+)
+{
+	error_code code;
+	std::size_t res = read_some(buffers, code);
+	detail::check_error_code(code, error_info());
+	return res;
+}
+
+template <typename StreamType>
+template <typename CompletionToken>
+BOOST_ASIO_INITFN_RESULT_TYPE(
+	CompletionToken,
+	typename boost::mysql::field_stream<StreamType>::next_row_signature
+)
+boost::mysql::field_stream<StreamType>::async_next_row(
+	CompletionToken&& token,
+	error_info* info
+)
+{
+	detail::conditional_clear(info);
+	detail::check_completion_token<CompletionToken, next_row_signature>();
+
+	using HandlerSignature = next_row_signature;
+	using HandlerType = BOOST_ASIO_HANDLER_TYPE(CompletionToken, HandlerSignature);
+	using BaseType = boost::beast::async_base<
+		HandlerType,
+		typename StreamType::executor_type,
+		detail::recycling_allocator<void>
+	>;
+
+	struct Op: BaseType, boost::asio::coroutine
+	{
+		field_stream<StreamType>& stream_;
+		error_info* output_info_;
+		std::size_t bytes_needed_ {1};
+		bool row_read_ {false};
+
+		Op(
+			HandlerType&& handler,
+			field_stream<StreamType>& stream,
+			error_info* output_info
+		):
+			BaseType(std::move(handler), stream.get_executor(), stream.channel().operation_allocator()),
+			stream_(stream),
+			output_info_(output_info)
+		{
+		};
+
+		void operator()(
+			error_code err,
+			std::size_t bytes_transferred,
+			bool cont=true
+		)
+		{
+			error_info info;
+			reenter(*this)
+			{
+				// Discard whatever remains of the previous row
+				stream_.filled_ = 0;
+				while (!stream_.channel().packet_complete())
+				{
+					stream_.prepare_read(detail::field_stream_chunk_size);
+					yield stream_.channel().async_read_packet_some(stream_.free_area(), std::move(*this));
+					if (err)
+					{
+						this->complete(cont, err, false);
+						yield break;
+					}
+				}
+				stream_.state_ = state_t::idle;
+
+				if (stream_.resultset_->complete())
+				{
+					this->complete(cont, error_code(), false);
+					yield break;
+				}
+
+				yield stream_.channel().async_begin_read_packet(std::move(*this));
+				if (err)
+				{
+					this->complete(cont, err, false);
+					yield break;
+				}
+				stream_.start_row(bytes_transferred);
+
+				// Everything up to the field's value
+				while (bytes_needed_)
+				{
+					stream_.prepare_read(bytes_needed_);
+					while (stream_.filled_ < stream_.buffer_.size())
+					{
+						yield stream_.channel().async_read_packet_some(stream_.free_area(), std::move(*this));
+						if (!err && bytes_transferred == 0)
+						{
+							err = detail::make_error_code(errc::incomplete_message);
+						}
+						if (err)
+						{
+							this->complete(cont, err, false);
+							yield break;
+						}
+						stream_.filled_ += bytes_transferred;
+					}
+					bytes_needed_ = stream_.process_prefix(err);
+					if (err)
+					{
+						this->complete(cont, err, false);
+						yield break;
+					}
+				}
+
+				// Messages and empty values: read everything right now
+				if (stream_.state_ == state_t::tail)
+				{
+					do
+					{
+						stream_.prepare_read(detail::field_stream_chunk_size);
+						yield stream_.channel().async_read_packet_some(stream_.free_area(), std::move(*this));
+						if (err)
+						{
+							this->complete(cont, err, false);
+							yield break;
+						}
+						stream_.filled_ += bytes_transferred;
+					} while (bytes_transferred);
+
+					row_read_ = stream_.finish_row(err, info);
+					detail::conditional_assign(output_info_, std::move(info));
+					this->complete(cont, err, row_read_);
+					yield break;
+				}
+
+				this->complete(cont, error_code(), true);
+			}
+		}
+	};
+
+	boost::asio::async_completion<CompletionToken, HandlerSignature> initiator(token);
+
+	Op(
+		std::move(initiator.completion_handler),
+		*this,
+		info
+	)(error_code(), 0, false);
+	return initiator.result.get();
+}
+
+template <typename StreamType>
+template <typename MutableBufferSequence, typename CompletionToken>
+BOOST_ASIO_INITFN_RESULT_TYPE(
+	CompletionToken,
+	typename boost::mysql::field_stream<StreamType>::read_some_signature
+)
+boost::mysql::field_stream<StreamType>::async_read_some(
+	const MutableBufferSequence& buffers,
+	CompletionToken&& token
+)
+{
+	using HandlerSignature = read_some_signature;
+	using HandlerType = BOOST_ASIO_HANDLER_TYPE(CompletionToken, HandlerSignature);
+	using BaseType = boost::beast::async_base<
+		HandlerType,
+		typename StreamType::executor_type,
+		detail::recycling_allocator<void>
+	>;
+
+	struct Op: BaseType, boost::asio::coroutine
+	{
+		field_stream<StreamType>& stream_;
+		boost::asio::mutable_buffer buffer_;
+		std::size_t bytes_read_ {0};
+
+		Op(
+			HandlerType&& handler,
+			field_stream<StreamType>& stream,
+			boost::asio::mutable_buffer buffer
+		):
+			BaseType(std::move(handler), stream.get_executor(), stream.channel().operation_allocator()),
+			stream_(stream),
+			buffer_(buffer)
+		{
+		};
+
+		void operator()(
+			error_code err,
+			std::size_t bytes_transferred,
+			bool cont=true
+		)
+		{
+			error_info info; // rows don't carry any error information
+			reenter(*this)
+			{
+				if (stream_.state_ != state_t::field)
+				{
+					this->complete(cont, boost::asio::error::eof, 0);
+					yield break;
+				}
+				if (buffer_.size() == 0)
+				{
+					this->complete(cont, error_code(), 0);
+					yield break;
+				}
+
+				yield stream_.channel().async_read_packet_some(
+					boost::asio::buffer(
+						buffer_,
+						static_cast<std::size_t>(std::min<std::uint64_t>(buffer_.size(), stream_.remaining_))
+					),
+					std::move(*this)
+				);
+				if (!err && bytes_transferred == 0)
+				{
+					err = detail::make_error_code(errc::incomplete_message);
+				}
+				if (err)
+				{
+					this->complete(cont, err, 0);
+					yield break;
+				}
+				bytes_read_ = bytes_transferred;
+				stream_.remaining_ -= bytes_read_;
+				if (stream_.remaining_ != 0)
+				{
+					this->complete(cont, error_code(), bytes_read_);
+					yield break;
+				}
+
+				// Done with the field: get the rest of the row
+				stream_.state_ = state_t::tail;
+				do
+				{
+					stream_.prepare_read(detail::field_stream_chunk_size);
+					yield stream_.channel().async_read_packet_some(stream_.free_area(), std::move(*this));
+					if (err)
+					{
+						this->complete(cont, err, bytes_read_);
+						yield break;
+					}
+					stream_.filled_ += bytes_transferred;
+				} while (bytes_transferred);
+
+				stream_.finish_row(err, info);
+				this->complete(cont, err, bytes_read_);
+			}
+		}
+	};
+
+	boost::asio::async_completion<CompletionToken, HandlerSignature> initiator(token);
+
+	Op(
+		std::move(initiator.completion_handler),
+		*this,
+		detail::first_nonempty_buffer(buffers)
+	)(error_code(), 0, false);
+	return initiator.result.get();
+}
+
+#include <boost/asio/unyield.hpp>
+
+#endif
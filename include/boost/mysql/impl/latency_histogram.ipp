@@ -0,0 +1,108 @@
+#ifndef INCLUDE_BOOST_MYSQL_IMPL_LATENCY_HISTOGRAM_IPP_
+#define INCLUDE_BOOST_MYSQL_IMPL_LATENCY_HISTOGRAM_IPP_
+
+#include <algorithm>
+#include <cmath>
+
+namespace boost {
+namespace mysql {
+namespace detail {
+
+// Values below 2 * latency_sub_buckets get a bucket each. Every power of two
+// above that is split in latency_sub_buckets buckets.
+constexpr unsigned latency_sub_bucket_bits = 4;
+constexpr std::uint64_t latency_sub_buckets = 1 << latency_sub_bucket_bits;
+constexpr std::uint64_t latency_max_value = (std::uint64_t(1) << 40) - 1;
+
+inline unsigned most_significant_bit(std::uint64_t value) noexcept
+{
+	unsigned res = 0;
+	while (value >>= 1)
+	{
+		++res;
+	}
+	return res;
+}
+
+} // detail
+} // mysql
+} // boost
+
+inline std::size_t boost::mysql::latency_histogram::bucket_index(
+	std::uint64_t value
+) noexcept
+{
+	value = std::min(value, detail::latency_max_value);
+	if (value < 2 * detail::latency_sub_buckets)
+	{
+		return static_cast<std::size_t>(value);
+	}
+	unsigned shift = detail::most_significant_bit(value) - detail::latency_sub_bucket_bits;
+	return static_cast<std::size_t>(
+		(shift + 1) * detail::latency_sub_buckets + (value >> shift) - detail::latency_sub_buckets
+	);
+}
+
+inline std::uint64_t boost::mysql::latency_histogram::bucket_upper_bound(
+	std::size_t index
+) noexcept
+{
+	if (index < 2 * detail::latency_sub_buckets)
+	{
+		return index;
+	}
+	std::size_t shift = index / detail::latency_sub_buckets - 1;
+	std::uint64_t top = index % detail::latency_sub_buckets + detail::latency_sub_buckets;
+	return ((top + 1) << shift) - 1;
+}
+
+inline void boost::mysql::latency_histogram::record(
+	duration value
+) noexcept
+{
+	auto ns = static_cast<std::uint64_t>(std::max(value.count(), duration::rep(0)));
+	++buckets_[bucket_index(ns)];
+	++count_;
+	sum_ += ns;
+	min_ = std::min(min_, ns);
+	max_ = std::max(max_, ns);
+}
+
+inline boost::mysql::latency_histogram::duration boost::mysql::latency_histogram::percentile(
+	double percentile
+) const noexcept
+{
+	if (count_ == 0)
+	{
+		return duration(0);
+	}
+	percentile = std::clamp(percentile, 0.0, 100.0);
+	auto target = static_cast<std::uint64_t>(std::ceil(percentile / 100.0 * static_cast<double>(count_)));
+	target = std::clamp(target, std::uint64_t(1), count_);
+	std::uint64_t accumulated = 0;
+	for (std::size_t i = 0; i < num_buckets; ++i)
+	{
+		accumulated += buckets_[i];
+		if (accumulated >= target)
+		{
+			return duration(std::clamp(bucket_upper_bound(i), min_, max_));
+		}
+	}
+	return duration(max_);
+}
+
+inline void boost::mysql::latency_histogram::merge(
+	const latency_histogram& other
+) noexcept
+{
+	for (std::size_t i = 0; i < num_buckets; ++i)
+	{
+		buckets_[i] += other.buckets_[i];
+	}
+	count_ += other.count_;
+	sum_ += other.sum_;
+	min_ = std::min(min_, other.min_);
+	max_ = std::max(max_, other.max_);
+}
+
+#endif /* INCLUDE_BOOST_MYSQL_IMPL_LATENCY_HISTOGRAM_IPP_ */
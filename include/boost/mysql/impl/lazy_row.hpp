@@ -0,0 +1,93 @@
+#ifndef INCLUDE_BOOST_MYSQL_IMPL_LAZY_ROW_HPP_
+#define INCLUDE_BOOST_MYSQL_IMPL_LAZY_ROW_HPP_
+
+#include "boost/mysql/row.hpp"
+
+inline const boost::mysql::value& boost::mysql::lazy_row::get(
+	std::size_t i,
+	error_code& err
+) const
+{
+	assert(i < size());
+	err.clear();
+	if (decoded_[i]) return values_[i];
+
+	const auto& bounds = bounds_[i];
+	errc code = errc::ok;
+	if (is_null(i))
+	{
+		values_[i] = nullptr;
+	}
+	else if (binary_)
+	{
+		const auto* first = reinterpret_cast<const std::uint8_t*>(bounds.data);
+		detail::deserialization_context ctx (first, first + bounds.size, detail::capabilities());
+		code = meta_->binary_plan()[i](ctx, values_[i]);
+		if (code == errc::ok && !ctx.empty()) code = errc::extra_bytes;
+	}
+	else
+	{
+		code = detail::deserialize_text_value(bounds.value(), meta_->fields()[i], values_[i]);
+	}
+
+	if (code != errc::ok)
+	{
+		err = detail::make_error_code(code);
+		values_[i] = nullptr;
+		return values_[i];
+	}
+	decoded_[i] = true;
+	return values_[i];
+}
+
+inline const boost::mysql::value& boost::mysql::lazy_row::get(
+	std::size_t i
+) const
+{
+	error_code err;
+	const auto& res = get(i, err);
+	detail::check_error_code(err, error_info());
+	return res;
+}
+
+inline const boost::mysql::value& boost::mysql::lazy_row::get(
+	std::string_view name
+) const
+{
+	std::size_t i = meta_ ? meta_->name_index()->find(name) : detail::field_name_index::npos;
+	if (i >= size())
+	{
+		throw std::out_of_range("lazy_row::get: no field named " + std::string(name));
+	}
+	return get(i);
+}
+
+inline boost::mysql::row boost::mysql::lazy_row::to_row() const
+{
+	std::pmr::vector<value> values (values_.get_allocator());
+	values.reserve(size());
+	for (std::size_t i = 0; i < size(); ++i)
+	{
+		values.push_back(get(i));
+	}
+	return row(std::move(values));
+}
+
+inline boost::mysql::errc boost::mysql::lazy_row::assign(
+	detail::deserialization_context& ctx,
+	const detail::resultset_metadata& meta,
+	bool binary
+)
+{
+	auto num_fields = meta.fields().size();
+	meta_ = &meta;
+	binary_ = binary;
+	bounds_.resize(num_fields);
+	values_.assign(num_fields, value(nullptr));
+	decoded_.assign(num_fields, false);
+	auto err = detail::split_row(ctx, meta.fields(), binary, bounds_.data());
+	if (err != errc::ok) bounds_.clear();
+	return err;
+}
+
+#endif /* INCLUDE_BOOST_MYSQL_IMPL_LAZY_ROW_HPP_ */
@@ -0,0 +1,272 @@
+#ifndef INCLUDE_BOOST_MYSQL_IMPL_PIPELINE_HPP_
+#define INCLUDE_BOOST_MYSQL_IMPL_PIPELINE_HPP_
+
+#include "boost/mysql/detail/network_algorithms/execute_generic.hpp"
+#include "boost/mysql/detail/network_algorithms/execute_statement.hpp"
+#include "boost/mysql/detail/protocol/query_messages.hpp"
+#include "boost/mysql/detail/protocol/text_deserialization.hpp"
+#include "boost/mysql/detail/protocol/binary_deserialization.hpp"
+#include "boost/mysql/detail/auxiliar/stringize.hpp"
+#include "boost/mysql/detail/auxiliar/check_completion_token.hpp"
+#include <boost/asio/post.hpp>
+#include <boost/beast/core/bind_handler.hpp>
+
+template <typename Stream>
+template <typename Serializable>
+void boost::mysql::pipeline<Stream>::add_request(
+	const Serializable& request,
+	detail::deserialize_row_fn deserializer,
+	std::shared_ptr<const detail::resultset_metadata> cached_metadata,
+	traced_operation operation,
+	std::string_view sql,
+	std::uint32_t statement_id
+)
+{
+	assert(valid());
+
+	// Every request starts a new command, so sequence numbers start at zero.
+	// The response will continue from the sequence number following the request.
+	// With compression, that is the one following the request's frames.
+	detail::serialize_message(request, channel_->current_capabilities(), message_buffer_);
+	std::size_t request_first = buffer_.size();
+	std::uint8_t response_seqnum = detail::append_framed(
+		boost::asio::buffer(message_buffer_),
+		0,
+		buffer_
+	);
+	if (channel_->compression_enabled())
+	{
+		response_seqnum = detail::num_compressed_frames(buffer_.size() - request_first);
+	}
+	entries_.push_back(detail::pipeline_entry{
+		deserializer,
+		std::move(cached_metadata),
+		operation,
+		std::string(sql),
+		statement_id,
+		response_seqnum,
+		error_code(),
+		std::string()
+	});
+}
+
+template <typename Stream>
+void boost::mysql::pipeline<Stream>::consume_next_error(
+	error_code& err,
+	error_info& info
+)
+{
+	auto& entry = entries_[next_++];
+	err = entry.err;
+	info.set_message(std::move(entry.err_message));
+}
+
+template <typename Stream>
+boost::asio::const_buffer boost::mysql::pipeline<Stream>::prepare_write()
+{
+	// Requests that could not be queued are not sent, so they don't start an operation
+	for (; next_to_write_ < entries_.size(); ++next_to_write_)
+	{
+		const auto& entry = entries_[next_to_write_];
+		if (!entry.err) channel_->trace_start(entry.operation, entry.sql, entry.statement_id);
+	}
+	auto res = boost::asio::buffer(buffer_) + write_offset_;
+	write_offset_ = buffer_.size();
+	return res;
+}
+
+template <typename Stream>
+void boost::mysql::pipeline<Stream>::clear() noexcept
+{
+	entries_.clear();
+	buffer_.clear();
+	write_offset_ = 0;
+	next_ = 0;
+	next_to_write_ = 0;
+}
+
+template <typename Stream>
+boost::mysql::pipeline<Stream>& boost::mysql::pipeline<Stream>::add_query(
+	std::string_view query_string
+)
+{
+	add_request(
+		detail::com_query_packet{detail::string_eof(query_string)},
+		&detail::deserialize_text_row,
+		nullptr,
+		traced_operation::query,
+		query_string,
+		0
+	);
+	return *this;
+}
+
+template <typename Stream>
+template <typename ForwardIterator>
+boost::mysql::pipeline<Stream>& boost::mysql::pipeline<Stream>::add_execute(
+	const prepared_statement<Stream>& stmt,
+	ForwardIterator params_first,
+	ForwardIterator params_last
+)
+{
+	assert(valid());
+	assert(stmt.valid());
+
+	auto param_count = std::distance(params_first, params_last);
+	if (param_count != stmt.num_params())
+	{
+		// Nothing gets sent, so sequence numbers are not relevant
+		entries_.push_back(detail::pipeline_entry{
+			nullptr,
+			nullptr,
+			traced_operation::execute_statement,
+			std::string(),
+			stmt.id(),
+			0,
+			detail::make_error_code(errc::wrong_num_params),
+			detail::stringize("pipeline::add_execute: expected ", stmt.num_params(),
+					" params, but got ", param_count)
+		});
+	}
+	else
+	{
+		add_request(
+			detail::make_stmt_execute_packet(stmt.id(), params_first, params_last),
+			&detail::deserialize_binary_row,
+			stmt.cached_metadata(),
+			traced_operation::execute_statement,
+			std::string_view(),
+			stmt.id()
+		);
+	}
+	return *this;
+}
+
+template <typename Stream>
+void boost::mysql::pipeline<Stream>::write(
+	error_code& err,
+	error_info& info
+)
+{
+	assert(valid());
+	err.clear();
+	info.clear();
+	channel_->write_framed(prepare_write(), err);
+}
+
+template <typename Stream>
+void boost::mysql::pipeline<Stream>::write()
+{
+	error_code err;
+	error_info info;
+	write(err, info);
+	detail::check_error_code(err, info);
+}
+
+template <typename Stream>
+template <typename CompletionToken>
+BOOST_ASIO_INITFN_RESULT_TYPE(
+	CompletionToken,
+	typename boost::mysql::pipeline<Stream>::write_signature
+)
+boost::mysql::pipeline<Stream>::async_write(
+	CompletionToken&& token,
+	error_info* info
+)
+{
+	assert(valid());
+	detail::conditional_clear(info);
+	detail::check_completion_token<CompletionToken, write_signature>();
+
+	return channel_->async_write_framed(
+		prepare_write(),
+		std::forward<CompletionToken>(token)
+	);
+}
+
+template <typename Stream>
+boost::mysql::resultset<Stream> boost::mysql::pipeline<Stream>::read_next(
+	error_code& err,
+	error_info& info
+)
+{
+	assert(valid());
+	assert(remaining() > 0);
+
+	resultset<Stream> res;
+	err.clear();
+	info.clear();
+
+	if (next_has_error())
+	{
+		consume_next_error(err, info);
+	}
+	else
+	{
+		const auto& entry = entries_[next_++];
+		channel_->trace_resume(entry.operation, entry.statement_id);
+		channel_->reset_sequence_number(entry.response_sequence_number);
+		detail::read_resultset_head(entry.deserializer, entry.cached_metadata, *channel_, res, err, info);
+	}
+	return res;
+}
+
+template <typename Stream>
+boost::mysql::resultset<Stream> boost::mysql::pipeline<Stream>::read_next()
+{
+	error_code err;
+	error_info info;
+	auto res = read_next(err, info);
+	detail::check_error_code(err, info);
+	return res;
+}
+
+template <typename Stream>
+template <typename CompletionToken>
+BOOST_ASIO_INITFN_RESULT_TYPE(
+	CompletionToken,
+	typename boost::mysql::pipeline<Stream>::read_next_signature
+)
+boost::mysql::pipeline<Stream>::async_read_next(
+	CompletionToken&& token,
+	error_info* info
+)
+{
+	assert(valid());
+	assert(remaining() > 0);
+	detail::conditional_clear(info);
+	detail::check_completion_token<CompletionToken, read_next_signature>();
+
+	if (next_has_error())
+	{
+		error_code err;
+		error_info nonnull_info;
+		consume_next_error(err, nonnull_info);
+		detail::conditional_assign(info, std::move(nonnull_info));
+		boost::asio::async_completion<CompletionToken, read_next_signature> completion (token);
+		boost::asio::post(
+			channel_->next_layer().get_executor(),
+			boost::beast::bind_front_handler(
+				std::move(completion.completion_handler),
+				err,
+				resultset<Stream>()
+			)
+		);
+		return completion.result.get();
+	}
+	else
+	{
+		const auto& entry = entries_[next_++];
+		channel_->trace_resume(entry.operation, entry.statement_id);
+		channel_->reset_sequence_number(entry.response_sequence_number);
+		return detail::async_read_resultset_head(
+			entry.deserializer,
+			entry.cached_metadata,
+			*channel_,
+			std::forward<CompletionToken>(token),
+			info
+		);
+	}
+}
+
+#endif /* INCLUDE_BOOST_MYSQL_IMPL_PIPELINE_HPP_ */
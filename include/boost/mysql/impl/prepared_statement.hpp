@@ -48,6 +48,7 @@ boost::mysql::resultset<Stream> boost::mysql::prepared_statement<Stream>::execut
 		detail::execute_statement(
 			*channel_,
 			stmt_msg_.statement_id.value,
+			metadata_,
 			params_first,
 			params_last,
 			res,
@@ -114,6 +115,7 @@ boost::mysql::prepared_statement<StreamType>::async_execute(
 		return detail::async_execute_statement(
 			*channel_,
 			stmt_msg_.statement_id.value,
+			metadata_,
 			params_first,
 			params_last,
 			std::forward<CompletionToken>(token),
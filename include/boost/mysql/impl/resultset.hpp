@@ -2,6 +2,8 @@
 #define MYSQL_ASIO_IMPL_RESULTSET_HPP
 
 #include "boost/mysql/detail/network_algorithms/read_row.hpp"
+#include "boost/mysql/detail/protocol/columnar_deserialization.hpp"
+#include "boost/mysql/detail/protocol/typed_deserialization.hpp"
 #include "boost/mysql/detail/auxiliar/check_completion_token.hpp"
 #include <boost/asio/coroutine.hpp>
 #include <cassert>
@@ -15,6 +17,7 @@ const boost::mysql::row* boost::mysql::resultset<StreamType>::fetch_one(
 )
 {
 	assert(valid());
+	detail::latency_scope latency (channel_->latency(), latency_operation::fetch);
 
 	err.clear();
 	info.clear();
@@ -26,7 +29,7 @@ const boost::mysql::row* boost::mysql::resultset<StreamType>::fetch_one(
 	auto result = detail::read_row(
 		deserializer_,
 		*channel_,
-		meta_.fields(),
+		meta_,
 		buffer_,
 		current_row_.values(),
 		ok_packet_,
@@ -34,7 +37,8 @@ const boost::mysql::row* boost::mysql::resultset<StreamType>::fetch_one(
 		info
 	);
 	eof_received_ = result == detail::read_row_result::eof;
-	return result == detail::read_row_result::row ? &current_row_ : nullptr;
+	trace_fetch(result == detail::read_row_result::row ? 1 : 0, err, info);
+	return result == detail::read_row_result::row ? named_current_row() : nullptr;
 }
 
 template <typename StreamType>
@@ -48,119 +52,1044 @@ const boost::mysql::row* boost::mysql::resultset<StreamType>::fetch_one()
 }
 
 template <typename StreamType>
-std::vector<boost::mysql::owning_row> boost::mysql::resultset<StreamType>::fetch_many(
+template <typename RowVector>
+void boost::mysql::resultset<StreamType>::fetch_rows(
 	std::size_t count,
+	RowVector& output,
 	error_code& err,
 	error_info& info
 )
 {
 	assert(valid());
+	detail::latency_scope latency (channel_->latency(), latency_operation::fetch);
 
 	err.clear();
 	info.clear();
 
-	std::vector<mysql::owning_row> res;
+	std::size_t num_rows = 0;
+	if (!complete()) // support calling fetch on already exhausted resultset
+	{
+		for (; num_rows < count; ++num_rows)
+		{
+			auto& r = prepare_output_row(output, num_rows);
+			auto result = detail::read_row(
+				deserializer_,
+				*channel_,
+				meta_,
+				r.buffer(),
+				r.values(),
+				ok_packet_,
+				err,
+				info
+			);
+			eof_received_ = result == detail::read_row_result::eof;
+			if (result != detail::read_row_result::row)
+			{
+				break;
+			}
+		}
+		trace_fetch(num_rows, err, info);
+	}
+	output.erase(output.begin() + num_rows, output.end());
+}
+
+template <typename StreamType>
+boost::mysql::detail::pmr_vector<boost::mysql::owning_row> boost::mysql::resultset<StreamType>::fetch_many(
+	std::size_t count,
+	error_code& err,
+	error_info& info
+)
+{
+	detail::pmr_vector<owning_row> res (resource_);
+	fetch_rows(count, res, err, info);
+	return res;
+}
+
+template <typename StreamType>
+boost::mysql::detail::pmr_vector<boost::mysql::owning_row> boost::mysql::resultset<StreamType>::fetch_many(
+	std::size_t count
+)
+{
+	error_code code;
+	error_info info;
+	auto res = fetch_many(count, code, info);
+	detail::check_error_code(code, info);
+	return res;
+}
+
+template <typename StreamType>
+boost::mysql::detail::pmr_vector<boost::mysql::owning_row> boost::mysql::resultset<StreamType>::fetch_all(
+	error_code& err,
+	error_info& info
+)
+{
+	return fetch_many(std::numeric_limits<std::size_t>::max(), err, info);
+}
+
+template <typename StreamType>
+boost::mysql::detail::pmr_vector<boost::mysql::owning_row> boost::mysql::resultset<StreamType>::fetch_all()
+{
+	return fetch_many(std::numeric_limits<std::size_t>::max());
+}
+
+template <typename StreamType>
+void boost::mysql::resultset<StreamType>::fetch_many(
+	std::size_t count,
+	std::vector<owning_row>& output,
+	error_code& err,
+	error_info& info
+)
+{
+	fetch_rows(count, output, err, info);
+}
+
+template <typename StreamType>
+void boost::mysql::resultset<StreamType>::fetch_many(
+	std::size_t count,
+	std::vector<owning_row>& output
+)
+{
+	error_code code;
+	error_info info;
+	fetch_many(count, output, code, info);
+	detail::check_error_code(code, info);
+}
+
+template <typename StreamType>
+void boost::mysql::resultset<StreamType>::fetch_all(
+	std::vector<owning_row>& output,
+	error_code& err,
+	error_info& info
+)
+{
+	fetch_many(std::numeric_limits<std::size_t>::max(), output, err, info);
+}
+
+template <typename StreamType>
+void boost::mysql::resultset<StreamType>::fetch_all(
+	std::vector<owning_row>& output
+)
+{
+	fetch_many(std::numeric_limits<std::size_t>::max(), output);
+}
+
+template <typename StreamType>
+boost::mysql::detail::read_row_result boost::mysql::resultset<StreamType>::process_batch_packet(
+	row_batch& output,
+	error_code& err,
+	error_info& info
+)
+{
+	// The packet was read straight into the batch, so string values point into the batch's
+	// memory. current_row_ is used as scratch space, to avoid allocating a vector per row
+	auto result = detail::process_read_message(
+		deserializer_,
+		channel_->current_capabilities(),
+		meta_,
+		output.pending_packet(),
+		current_row_.values(),
+		ok_packet_,
+		err,
+		info
+	);
+	if (result == detail::read_row_result::row)
+	{
+		output.append_row(current_row_.values());
+	}
+	else
+	{
+		output.discard_packet();
+		eof_received_ = result == detail::read_row_result::eof;
+	}
+	return result;
+}
+
+template <typename StreamType>
+boost::mysql::detail::read_row_result boost::mysql::resultset<StreamType>::process_lazy_packet(
+	error_code& err,
+	error_info& info
+)
+{
+	auto result = detail::process_read_message(
+		[this](detail::deserialization_context& ctx) {
+			return detail::make_error_code(current_lazy_row_.assign(ctx, meta_, is_binary()));
+		},
+		channel_->current_capabilities(),
+		boost::asio::buffer(buffer_),
+		ok_packet_,
+		err,
+		info
+	);
+	eof_received_ = result == detail::read_row_result::eof;
+	return result;
+}
+
+template <typename StreamType>
+boost::mysql::detail::binary_columnar_plan boost::mysql::resultset<StreamType>::make_columnar_plan() const
+{
+	return is_binary() ?
+			detail::make_binary_columnar_plan(meta_.fields(), resource_) :
+			detail::binary_columnar_plan(resource_);
+}
+
+template <typename StreamType>
+boost::mysql::detail::read_row_result boost::mysql::resultset<StreamType>::process_columnar_packet(
+	column_batch& output,
+	const detail::binary_columnar_plan& plan,
+	error_code& err,
+	error_info& info
+)
+{
+	auto result = detail::process_read_message(
+		[this, &output, &plan](detail::deserialization_context& ctx) {
+			return detail::deserialize_columnar_row(ctx, meta_, is_binary() ? &plan : nullptr, output);
+		},
+		channel_->current_capabilities(),
+		boost::asio::buffer(buffer_),
+		ok_packet_,
+		err,
+		info
+	);
+	eof_received_ = result == detail::read_row_result::eof;
+	return result;
+}
+
+template <typename StreamType>
+template <typename RowType>
+boost::mysql::detail::read_row_result boost::mysql::resultset<StreamType>::process_typed_packet(
+	RowType& output,
+	error_code& err,
+	error_info& info
+)
+{
+	auto result = detail::process_read_message(
+		[this, &output](detail::deserialization_context& ctx) {
+			return detail::deserialize_typed_row(ctx, meta_, is_binary(), output);
+		},
+		channel_->current_capabilities(),
+		boost::asio::buffer(buffer_),
+		ok_packet_,
+		err,
+		info
+	);
+	eof_received_ = result == detail::read_row_result::eof;
+	return result;
+}
+
+template <typename StreamType>
+template <typename RowType>
+bool boost::mysql::resultset<StreamType>::check_row_type(
+	error_code& err,
+	error_info& info
+)
+{
+	const void* tag = &detail::row_type_tag<RowType>;
+	if (checked_row_type_ != tag)
+	{
+		auto code = detail::check_row_type<RowType>(meta_.fields(), info);
+		if (code != errc::ok)
+		{
+			err = detail::make_error_code(code);
+			return false;
+		}
+		checked_row_type_ = tag;
+	}
+	return true;
+}
+
+template <typename StreamType>
+void boost::mysql::resultset<StreamType>::trace_fetch(
+	std::size_t num_rows,
+	const error_code& err,
+	const error_info& info
+)
+{
+	if (!channel_->observer()) return;
+	if (num_rows > 0)
+	{
+		channel_->trace_row_batch(num_rows);
+	}
+	if (err)
+	{
+		channel_->trace_error(err, info);
+	}
+	else if (complete())
+	{
+		channel_->trace_resultset_complete(ok_packet_.affected_rows.value);
+	}
+}
+
+template <typename StreamType>
+boost::mysql::row_batch boost::mysql::resultset<StreamType>::fetch_batch(
+	std::size_t count,
+	error_code& err,
+	error_info& info
+)
+{
+	assert(valid());
+	detail::latency_scope latency (channel_->latency(), latency_operation::fetch);
+
+	err.clear();
+	info.clear();
+
+	row_batch res (meta_.fields().size(), resource_);
+	row_batch::packet_buffer packet (res);
 
 	if (!complete()) // support calling fetch on already exhausted resultset
 	{
 		for (std::size_t i = 0; i < count; ++i)
 		{
-			detail::bytestring buff;
-			std::vector<value> values;
-
-			auto result = detail::read_row(
-				deserializer_,
-				*channel_,
-				meta_.fields(),
-				buff,
-				values,
-				ok_packet_,
-				err,
-				info
-			);
-			eof_received_ = result == detail::read_row_result::eof;
-			if (result == detail::read_row_result::row)
-			{
-				res.emplace_back(std::move(values), std::move(buff));
-			}
-			else
+			channel_->read(packet, err);
+			if (err) break;
+			auto result = process_batch_packet(res, err, info);
+			if (result != detail::read_row_result::row) break;
+		}
+		trace_fetch(res.size(), err, info);
+	}
+
+	return res;
+}
+
+template <typename StreamType>
+boost::mysql::row_batch boost::mysql::resultset<StreamType>::fetch_batch(
+	std::size_t count
+)
+{
+	error_code code;
+	error_info info;
+	auto res = fetch_batch(count, code, info);
+	detail::check_error_code(code, info);
+	return res;
+}
+
+template <typename StreamType>
+boost::mysql::column_batch boost::mysql::resultset<StreamType>::fetch_columnar(
+	std::size_t max_rows,
+	error_code& err,
+	error_info& info
+)
+{
+	assert(valid());
+	detail::latency_scope latency (channel_->latency(), latency_operation::fetch);
+
+	err.clear();
+	info.clear();
+
+	column_batch res (meta_.fields(), resource_);
+
+	if (!complete()) // support calling fetch on already exhausted resultset
+	{
+		auto plan = make_columnar_plan();
+		for (std::size_t i = 0; i < max_rows; ++i)
+		{
+			channel_->read(buffer_, err);
+			if (err) break;
+			auto result = process_columnar_packet(res, plan, err, info);
+			if (result != detail::read_row_result::row) break;
+		}
+		trace_fetch(res.size(), err, info);
+	}
+
+	return res;
+}
+
+template <typename StreamType>
+boost::mysql::column_batch boost::mysql::resultset<StreamType>::fetch_columnar(
+	std::size_t max_rows
+)
+{
+	error_code code;
+	error_info info;
+	auto res = fetch_columnar(max_rows, code, info);
+	detail::check_error_code(code, info);
+	return res;
+}
+
+template <typename StreamType>
+template <typename RowType>
+std::optional<RowType> boost::mysql::resultset<StreamType>::fetch_one_as(
+	error_code& err,
+	error_info& info
+)
+{
+	assert(valid());
+	detail::latency_scope latency (channel_->latency(), latency_operation::fetch);
+
+	err.clear();
+	info.clear();
+
+	if (complete())
+	{
+		return {};
+	}
+	RowType output {};
+	auto result = detail::read_row_result::error;
+	if (check_row_type<RowType>(err, info))
+	{
+		channel_->read(buffer_, err);
+		if (!err)
+		{
+			result = process_typed_packet(output, err, info);
+		}
+	}
+	trace_fetch(result == detail::read_row_result::row ? 1 : 0, err, info);
+	if (result != detail::read_row_result::row)
+	{
+		return {};
+	}
+	return output;
+}
+
+template <typename StreamType>
+template <typename RowType>
+std::optional<RowType> boost::mysql::resultset<StreamType>::fetch_one_as()
+{
+	error_code code;
+	error_info info;
+	auto res = fetch_one_as<RowType>(code, info);
+	detail::check_error_code(code, info);
+	return res;
+}
+
+template <typename StreamType>
+template <typename RowType>
+std::vector<RowType> boost::mysql::resultset<StreamType>::fetch_many_as(
+	std::size_t count,
+	error_code& err,
+	error_info& info
+)
+{
+	static_assert(!detail::row_type_has_views<RowType>,
+		"fetch_many_as rows can't have std::string_view elements, use std::string instead");
+	assert(valid());
+	detail::latency_scope latency (channel_->latency(), latency_operation::fetch);
+
+	err.clear();
+	info.clear();
+
+	std::vector<RowType> res;
+
+	if (!complete()) // support calling fetch on already exhausted resultset
+	{
+		if (check_row_type<RowType>(err, info))
+		{
+			for (std::size_t i = 0; i < count; ++i)
+			{
+				channel_->read(buffer_, err);
+				if (err) break;
+				auto result = process_typed_packet(res.emplace_back(), err, info);
+				if (result != detail::read_row_result::row)
+				{
+					res.pop_back();
+					break;
+				}
+			}
+		}
+		trace_fetch(res.size(), err, info);
+	}
+
+	return res;
+}
+
+template <typename StreamType>
+template <typename RowType>
+std::vector<RowType> boost::mysql::resultset<StreamType>::fetch_many_as(
+	std::size_t count
+)
+{
+	error_code code;
+	error_info info;
+	auto res = fetch_many_as<RowType>(count, code, info);
+	detail::check_error_code(code, info);
+	return res;
+}
+
+template <typename StreamType>
+const boost::mysql::lazy_row* boost::mysql::resultset<StreamType>::fetch_one_lazy(
+	error_code& err,
+	error_info& info
+)
+{
+	assert(valid());
+	detail::latency_scope latency (channel_->latency(), latency_operation::fetch);
+
+	err.clear();
+	info.clear();
+
+	if (complete())
+	{
+		return nullptr;
+	}
+	auto result = detail::read_row_result::error;
+	channel_->read(buffer_, err);
+	if (!err)
+	{
+		result = process_lazy_packet(err, info);
+	}
+	trace_fetch(result == detail::read_row_result::row ? 1 : 0, err, info);
+	return result == detail::read_row_result::row ? &current_lazy_row_ : nullptr;
+}
+
+template <typename StreamType>
+const boost::mysql::lazy_row* boost::mysql::resultset<StreamType>::fetch_one_lazy()
+{
+	error_code code;
+	error_info info;
+	const lazy_row* res = fetch_one_lazy(code, info);
+	detail::check_error_code(code, info);
+	return res;
+}
+
+template <typename StreamType>
+template <typename CompletionToken>
+BOOST_ASIO_INITFN_RESULT_TYPE(
+	CompletionToken,
+	typename boost::mysql::resultset<StreamType>::fetch_one_signature
+)
+boost::mysql::resultset<StreamType>::async_fetch_one(
+	CompletionToken&& token,
+	error_info* info
+)
+{
+	detail::conditional_clear(info);
+	detail::check_completion_token<CompletionToken, fetch_one_signature>();
+
+	using HandlerSignature = fetch_one_signature;
+	using HandlerType = BOOST_ASIO_HANDLER_TYPE(CompletionToken, HandlerSignature);
+	using BaseType = boost::beast::async_base<
+		HandlerType,
+		typename StreamType::executor_type,
+		detail::recycling_allocator<void>
+	>;
+
+	struct Op: BaseType, boost::asio::coroutine
+	{
+		resultset<StreamType>& resultset_;
+		error_info* output_info_;
+		detail::latency_timer timer_;
+
+		Op(
+			HandlerType&& handler,
+			resultset<StreamType>& obj,
+			error_info* output_info
+		):
+			BaseType(std::move(handler), obj.channel_->next_layer().get_executor(), obj.channel_->operation_allocator()),
+			resultset_(obj),
+			output_info_(output_info),
+			timer_(obj.channel_->latency(), latency_operation::fetch)
+		{
+		};
+
+		void before_invoke_hook() override { timer_.finish(); }
+
+		void operator()(
+			error_code err,
+			error_info info,
+			detail::read_row_result result,
+			bool cont=true
+		)
+		{
+			reenter(*this)
+			{
+				if (resultset_.complete())
+				{
+					this->complete(cont, error_code(), nullptr);
+				}
+				else
+				{
+					yield detail::async_read_row(
+						resultset_.deserializer_,
+						*resultset_.channel_,
+						resultset_.meta_,
+						resultset_.buffer_,
+						resultset_.current_row_.values(),
+						resultset_.ok_packet_,
+						std::move(*this)
+					);
+					resultset_.eof_received_ = result == detail::read_row_result::eof;
+					resultset_.trace_fetch(result == detail::read_row_result::row ? 1 : 0, err, info);
+					detail::conditional_assign(output_info_, std::move(info));
+					this->complete(
+						cont,
+						err,
+						result == detail::read_row_result::row ? resultset_.named_current_row() : nullptr
+					);
+				}
+			}
+		}
+	};
+
+	assert(valid());
+
+	boost::asio::async_completion<CompletionToken, HandlerSignature> initiator(token);
+
+	Op(
+		std::move(initiator.completion_handler),
+		*this,
+		info
+	)(error_code(), error_info(), detail::read_row_result::error, false);
+	return initiator.result.get();
+}
+
+template <typename StreamType>
+template <typename CompletionToken>
+BOOST_ASIO_INITFN_RESULT_TYPE(
+	CompletionToken,
+	typename boost::mysql::resultset<StreamType>::fetch_many_signature
+)
+boost::mysql::resultset<StreamType>::async_fetch_many(
+	std::size_t count,
+	CompletionToken&& token,
+	error_info* info
+)
+{
+	detail::conditional_clear(info);
+	detail::check_completion_token<CompletionToken, fetch_many_signature>();
+
+	using HandlerSignature = fetch_many_signature;
+	using HandlerType = BOOST_ASIO_HANDLER_TYPE(CompletionToken, HandlerSignature);
+	using BaseType = boost::beast::async_base<
+		HandlerType,
+		typename StreamType::executor_type,
+		detail::recycling_allocator<void>
+	>;
+
+	struct OpImpl
+	{
+		resultset<StreamType>& parent_resultset;
+		detail::pmr_vector<owning_row> rows;
+		detail::resource_bytestring buffer;
+		std::pmr::vector<value> values;
+		std::size_t remaining;
+		error_info* output_info_;
+		bool initially_complete;
+
+		OpImpl(resultset<StreamType>& obj, std::size_t count, error_info* output_info):
+			parent_resultset(obj),
+			rows(obj.resource_),
+			buffer(obj.resource_),
+			values(obj.resource_),
+			remaining(count),
+			output_info_(output_info),
+			initially_complete(obj.complete())
+		{
+		};
+
+		void row_received()
+		{
+			rows.emplace_back(std::move(values), std::move(buffer), parent_resultset.meta_.name_index());
+			values = std::pmr::vector<value>(parent_resultset.resource_);
+			buffer = detail::resource_bytestring(parent_resultset.resource_);
+			--remaining;
+		}
+	};
+
+	struct Op: BaseType, boost::asio::coroutine
+	{
+		std::shared_ptr<OpImpl> impl_;
+		detail::latency_timer timer_;
+
+		Op(
+			HandlerType&& handler,
+			std::shared_ptr<OpImpl>&& impl
+		):
+			BaseType(std::move(handler), impl->parent_resultset.channel_->next_layer().get_executor(), impl->parent_resultset.channel_->operation_allocator()),
+			impl_(std::move(impl)),
+			timer_(impl_->parent_resultset.channel_->latency(), latency_operation::fetch)
+		{
+		};
+
+		void before_invoke_hook() override { timer_.finish(); }
+
+		void operator()(
+			error_code err,
+			error_info info,
+			detail::read_row_result result,
+			bool cont=true
+		)
+		{
+			reenter(*this)
+			{
+				while (!impl_->parent_resultset.complete() && impl_->remaining > 0)
+				{
+					yield detail::async_read_row(
+						impl_->parent_resultset.deserializer_,
+						*impl_->parent_resultset.channel_,
+						impl_->parent_resultset.meta_,
+						impl_->buffer,
+						impl_->values,
+						impl_->parent_resultset.ok_packet_,
+						std::move(*this)
+					);
+					if (result == detail::read_row_result::error)
+					{
+						impl_->parent_resultset.trace_fetch(impl_->rows.size(), err, info);
+						detail::conditional_assign(impl_->output_info_, std::move(info));
+						this->complete(cont, err, std::move(impl_->rows));
+						yield break;
+					}
+					else if (result == detail::read_row_result::eof)
+					{
+						impl_->parent_resultset.eof_received_ = true;
+					}
+					else
+					{
+						impl_->row_received();
+					}
+				}
+				if (!impl_->initially_complete)
+				{
+					impl_->parent_resultset.trace_fetch(impl_->rows.size(), err, error_info());
+				}
+				this->complete(cont, err, std::move(impl_->rows));
+			}
+		}
+	};
+
+	assert(valid());
+
+	boost::asio::async_completion<CompletionToken, HandlerSignature> initiator(token);
+
+	auto impl = detail::allocate_operation_state<OpImpl>(
+		initiator.completion_handler,
+		channel_->operation_allocator(),
+		*this,
+		count,
+		info
+	);
+	Op(
+		std::move(initiator.completion_handler),
+		std::move(impl)
+	)(error_code(), error_info(), detail::read_row_result::error, false);
+	return initiator.result.get();
+}
+
+template <typename StreamType>
+template <typename CompletionToken>
+BOOST_ASIO_INITFN_RESULT_TYPE(
+	CompletionToken,
+	typename boost::mysql::resultset<StreamType>::fetch_into_signature
+)
+boost::mysql::resultset<StreamType>::async_fetch_many(
+	std::size_t count,
+	std::vector<owning_row>& output,
+	CompletionToken&& token,
+	error_info* info
+)
+{
+	detail::conditional_clear(info);
+	detail::check_completion_token<CompletionToken, fetch_into_signature>();
+
+	using HandlerSignature = fetch_into_signature;
+	using HandlerType = BOOST_ASIO_HANDLER_TYPE(CompletionToken, HandlerSignature);
+	using BaseType = boost::beast::async_base<
+		HandlerType,
+		typename StreamType::executor_type,
+		detail::recycling_allocator<void>
+	>;
+
+	struct Op: BaseType, boost::asio::coroutine
+	{
+		resultset<StreamType>& resultset_;
+		std::vector<owning_row>& output_;
+		std::size_t count_;
+		std::size_t num_rows_ {0};
+		error_info* output_info_;
+		bool initially_complete_;
+		detail::latency_timer timer_;
+
+		Op(
+			HandlerType&& handler,
+			resultset<StreamType>& obj,
+			std::vector<owning_row>& output,
+			std::size_t count,
+			error_info* output_info
+		):
+			BaseType(std::move(handler), obj.channel_->next_layer().get_executor(), obj.channel_->operation_allocator()),
+			resultset_(obj),
+			output_(output),
+			count_(count),
+			output_info_(output_info),
+			initially_complete_(obj.complete()),
+			timer_(obj.channel_->latency(), latency_operation::fetch)
+		{
+		};
+
+		void before_invoke_hook() override { timer_.finish(); }
+
+		void finish(bool cont, error_code err)
+		{
+			output_.erase(output_.begin() + num_rows_, output_.end());
+			this->complete(cont, err);
+		}
+
+		void operator()(
+			error_code err,
+			error_info info,
+			detail::read_row_result result,
+			bool cont=true
+		)
+		{
+			reenter(*this)
+			{
+				while (!resultset_.complete() && num_rows_ < count_)
+				{
+					yield
+					{
+						auto& r = resultset_.prepare_output_row(output_, num_rows_);
+						detail::async_read_row(
+							resultset_.deserializer_,
+							*resultset_.channel_,
+							resultset_.meta_,
+							r.buffer(),
+							r.values(),
+							resultset_.ok_packet_,
+							std::move(*this)
+						);
+					}
+					if (result == detail::read_row_result::error)
+					{
+						resultset_.trace_fetch(num_rows_, err, info);
+						detail::conditional_assign(output_info_, std::move(info));
+						finish(cont, err);
+						yield break;
+					}
+					else if (result == detail::read_row_result::eof)
+					{
+						resultset_.eof_received_ = true;
+					}
+					else
+					{
+						++num_rows_;
+					}
+				}
+				if (!initially_complete_)
+				{
+					resultset_.trace_fetch(num_rows_, err, error_info());
+				}
+				finish(cont, err);
+			}
+		}
+	};
+
+	assert(valid());
+
+	boost::asio::async_completion<CompletionToken, HandlerSignature> initiator(token);
+	Op(
+		std::move(initiator.completion_handler),
+		*this,
+		output,
+		count,
+		info
+	)(error_code(), error_info(), detail::read_row_result::error, false);
+	return initiator.result.get();
+}
+
+template <typename StreamType>
+template <typename CompletionToken>
+BOOST_ASIO_INITFN_RESULT_TYPE(
+	CompletionToken,
+	typename boost::mysql::resultset<StreamType>::fetch_into_signature
+)
+boost::mysql::resultset<StreamType>::async_fetch_all(
+	std::vector<owning_row>& output,
+	CompletionToken&& token,
+	error_info* info
+)
+{
+	return async_fetch_many(
+		std::numeric_limits<std::size_t>::max(),
+		output,
+		std::forward<CompletionToken>(token),
+		info
+	);
+}
+
+template <typename StreamType>
+template <typename CompletionToken>
+BOOST_ASIO_INITFN_RESULT_TYPE(
+	CompletionToken,
+	typename boost::mysql::resultset<StreamType>::fetch_batch_signature
+)
+boost::mysql::resultset<StreamType>::async_fetch_batch(
+	std::size_t count,
+	CompletionToken&& token,
+	error_info* info
+)
+{
+	detail::conditional_clear(info);
+	detail::check_completion_token<CompletionToken, fetch_batch_signature>();
+
+	using HandlerSignature = fetch_batch_signature;
+	using HandlerType = BOOST_ASIO_HANDLER_TYPE(CompletionToken, HandlerSignature);
+	using BaseType = boost::beast::async_base<
+		HandlerType,
+		typename StreamType::executor_type,
+		detail::recycling_allocator<void>
+	>;
+
+	struct OpImpl
+	{
+		resultset<StreamType>& parent_resultset;
+		row_batch batch;
+		row_batch::packet_buffer packet;
+		std::size_t remaining;
+		error_info* output_info_;
+		bool initially_complete;
+
+		OpImpl(resultset<StreamType>& obj, std::size_t count, error_info* output_info):
+			parent_resultset(obj),
+			batch(obj.meta_.fields().size(), obj.resource_),
+			packet(batch),
+			remaining(count),
+			output_info_(output_info),
+			initially_complete(obj.complete())
+		{
+		};
+	};
+
+	struct Op: BaseType, boost::asio::coroutine
+	{
+		std::shared_ptr<OpImpl> impl_;
+		detail::latency_timer timer_;
+
+		Op(
+			HandlerType&& handler,
+			std::shared_ptr<OpImpl>&& impl
+		):
+			BaseType(std::move(handler), impl->parent_resultset.channel_->next_layer().get_executor(), impl->parent_resultset.channel_->operation_allocator()),
+			impl_(std::move(impl)),
+			timer_(impl_->parent_resultset.channel_->latency(), latency_operation::fetch)
+		{
+		};
+
+		void before_invoke_hook() override { timer_.finish(); }
+
+		void operator()(
+			error_code err,
+			bool cont=true
+		)
+		{
+			error_info info;
+			reenter(*this)
 			{
-				break;
+				while (!impl_->parent_resultset.complete() && impl_->remaining > 0)
+				{
+					yield impl_->parent_resultset.channel_->async_read(
+						impl_->packet,
+						std::move(*this)
+					);
+					if (!err)
+					{
+						auto result = impl_->parent_resultset.process_batch_packet(impl_->batch, err, info);
+						if (result == detail::read_row_result::row)
+						{
+							--impl_->remaining;
+						}
+					}
+					if (err)
+					{
+						impl_->parent_resultset.trace_fetch(impl_->batch.size(), err, info);
+						detail::conditional_assign(impl_->output_info_, std::move(info));
+						this->complete(cont, err, std::move(impl_->batch));
+						yield break;
+					}
+				}
+				if (!impl_->initially_complete)
+				{
+					impl_->parent_resultset.trace_fetch(impl_->batch.size(), err, info);
+				}
+				this->complete(cont, err, std::move(impl_->batch));
 			}
 		}
-	}
+	};
 
-	return res;
-}
+	assert(valid());
 
-template <typename StreamType>
-std::vector<boost::mysql::owning_row> boost::mysql::resultset<StreamType>::fetch_many(
-	std::size_t count
-)
-{
-	error_code code;
-	error_info info;
-	auto res = fetch_many(count, code, info);
-	detail::check_error_code(code, info);
-	return res;
+	boost::asio::async_completion<CompletionToken, HandlerSignature> initiator(token);
+
+	auto impl = detail::allocate_operation_state<OpImpl>(
+		initiator.completion_handler,
+		channel_->operation_allocator(),
+		*this,
+		count,
+		info
+	);
+	Op(
+		std::move(initiator.completion_handler),
+		std::move(impl)
+	)(error_code(), false);
+	return initiator.result.get();
 }
 
 template <typename StreamType>
-std::vector<boost::mysql::owning_row> boost::mysql::resultset<StreamType>::fetch_all(
-	error_code& err,
-	error_info& info
+template <typename CompletionToken>
+BOOST_ASIO_INITFN_RESULT_TYPE(
+	CompletionToken,
+	typename boost::mysql::resultset<StreamType>::fetch_all_signature
+)
+boost::mysql::resultset<StreamType>::async_fetch_all(
+	CompletionToken&& token,
+	error_info* info
 )
 {
-	return fetch_many(std::numeric_limits<std::size_t>::max(), err, info);
+	return async_fetch_many(
+		std::numeric_limits<std::size_t>::max(),
+		std::forward<CompletionToken>(token),
+		info
+	);
 }
 
-template <typename StreamType>
-std::vector<boost::mysql::owning_row> boost::mysql::resultset<StreamType>::fetch_all()
-{
-	return fetch_many(std::numeric_limits<std::size_t>::max());
-}
 
 template <typename StreamType>
 template <typename CompletionToken>
 BOOST_ASIO_INITFN_RESULT_TYPE(
 	CompletionToken,
-	typename boost::mysql::resultset<StreamType>::fetch_one_signature
+	typename boost::mysql::resultset<StreamType>::fetch_one_lazy_signature
 )
-boost::mysql::resultset<StreamType>::async_fetch_one(
+boost::mysql::resultset<StreamType>::async_fetch_one_lazy(
 	CompletionToken&& token,
 	error_info* info
 )
 {
 	detail::conditional_clear(info);
-	detail::check_completion_token<CompletionToken, fetch_one_signature>();
+	detail::check_completion_token<CompletionToken, fetch_one_lazy_signature>();
 
-	using HandlerSignature = fetch_one_signature;
+	using HandlerSignature = fetch_one_lazy_signature;
 	using HandlerType = BOOST_ASIO_HANDLER_TYPE(CompletionToken, HandlerSignature);
-	using BaseType = boost::beast::async_base<HandlerType, typename StreamType::executor_type>;
+	using BaseType = boost::beast::async_base<
+		HandlerType,
+		typename StreamType::executor_type,
+		detail::recycling_allocator<void>
+	>;
 
 	struct Op: BaseType, boost::asio::coroutine
 	{
 		resultset<StreamType>& resultset_;
 		error_info* output_info_;
+		detail::latency_timer timer_;
 
 		Op(
 			HandlerType&& handler,
 			resultset<StreamType>& obj,
 			error_info* output_info
 		):
-			BaseType(std::move(handler), obj.channel_->next_layer().get_executor()),
+			BaseType(std::move(handler), obj.channel_->next_layer().get_executor(), obj.channel_->operation_allocator()),
 			resultset_(obj),
-			output_info_(output_info)
+			output_info_(output_info),
+			timer_(obj.channel_->latency(), latency_operation::fetch)
 		{
 		};
 
+		void before_invoke_hook() override { timer_.finish(); }
+
 		void operator()(
 			error_code err,
-			error_info info,
-			detail::read_row_result result,
 			bool cont=true
 		)
 		{
+			error_info info;
+			auto result = detail::read_row_result::error;
 			reenter(*this)
 			{
 				if (resultset_.complete())
@@ -169,21 +1098,17 @@ boost::mysql::resultset<StreamType>::async_fetch_one(
 				}
 				else
 				{
-					yield detail::async_read_row(
-						resultset_.deserializer_,
-						*resultset_.channel_,
-						resultset_.meta_.fields(),
-						resultset_.buffer_,
-						resultset_.current_row_.values(),
-						resultset_.ok_packet_,
-						std::move(*this)
-					);
-					resultset_.eof_received_ = result == detail::read_row_result::eof;
+					yield resultset_.channel_->async_read(resultset_.buffer_, std::move(*this));
+					if (!err)
+					{
+						result = resultset_.process_lazy_packet(err, info);
+					}
+					resultset_.trace_fetch(result == detail::read_row_result::row ? 1 : 0, err, info);
 					detail::conditional_assign(output_info_, std::move(info));
 					this->complete(
 						cont,
 						err,
-						result == detail::read_row_result::row ? &resultset_.current_row_ : nullptr
+						result == detail::read_row_result::row ? &resultset_.current_lazy_row_ : nullptr
 					);
 				}
 			}
@@ -198,7 +1123,7 @@ boost::mysql::resultset<StreamType>::async_fetch_one(
 		std::move(initiator.completion_handler),
 		*this,
 		info
-	)(error_code(), error_info(), detail::read_row_result::error, false);
+	)(error_code(), false);
 	return initiator.result.get();
 }
 
@@ -206,95 +1131,194 @@ template <typename StreamType>
 template <typename CompletionToken>
 BOOST_ASIO_INITFN_RESULT_TYPE(
 	CompletionToken,
-	typename boost::mysql::resultset<StreamType>::fetch_many_signature
+	typename boost::mysql::resultset<StreamType>::fetch_columnar_signature
 )
-boost::mysql::resultset<StreamType>::async_fetch_many(
-	std::size_t count,
+boost::mysql::resultset<StreamType>::async_fetch_columnar(
+	std::size_t max_rows,
 	CompletionToken&& token,
 	error_info* info
 )
 {
 	detail::conditional_clear(info);
-	detail::check_completion_token<CompletionToken, fetch_many_signature>();
+	detail::check_completion_token<CompletionToken, fetch_columnar_signature>();
 
-	using HandlerSignature = fetch_many_signature;
+	using HandlerSignature = fetch_columnar_signature;
 	using HandlerType = BOOST_ASIO_HANDLER_TYPE(CompletionToken, HandlerSignature);
-	using BaseType = boost::beast::async_base<HandlerType, typename StreamType::executor_type>;
+	using BaseType = boost::beast::async_base<
+		HandlerType,
+		typename StreamType::executor_type,
+		detail::recycling_allocator<void>
+	>;
 
 	struct OpImpl
 	{
 		resultset<StreamType>& parent_resultset;
-		std::vector<owning_row> rows;
-		detail::bytestring buffer;
-		std::vector<value> values;
+		column_batch batch;
+		detail::binary_columnar_plan plan;
 		std::size_t remaining;
 		error_info* output_info_;
+		bool initially_complete;
 
 		OpImpl(resultset<StreamType>& obj, std::size_t count, error_info* output_info):
 			parent_resultset(obj),
+			batch(obj.meta_.fields(), obj.resource_),
+			plan(obj.make_columnar_plan()),
 			remaining(count),
-			output_info_(output_info)
+			output_info_(output_info),
+			initially_complete(obj.complete())
 		{
 		};
-
-		void row_received()
-		{
-			rows.emplace_back(std::move(values), std::move(buffer));
-			values = std::vector<value>();
-			buffer = detail::bytestring();
-			--remaining;
-		}
 	};
 
 	struct Op: BaseType, boost::asio::coroutine
 	{
 		std::shared_ptr<OpImpl> impl_;
+		detail::latency_timer timer_;
 
 		Op(
 			HandlerType&& handler,
 			std::shared_ptr<OpImpl>&& impl
 		):
-			BaseType(std::move(handler), impl->parent_resultset.channel_->next_layer().get_executor()),
-			impl_(std::move(impl))
+			BaseType(std::move(handler), impl->parent_resultset.channel_->next_layer().get_executor(), impl->parent_resultset.channel_->operation_allocator()),
+			impl_(std::move(impl)),
+			timer_(impl_->parent_resultset.channel_->latency(), latency_operation::fetch)
 		{
 		};
 
+		void before_invoke_hook() override { timer_.finish(); }
+
 		void operator()(
 			error_code err,
-			error_info info,
-			detail::read_row_result result,
 			bool cont=true
 		)
 		{
+			error_info info;
 			reenter(*this)
 			{
 				while (!impl_->parent_resultset.complete() && impl_->remaining > 0)
 				{
-					yield detail::async_read_row(
-						impl_->parent_resultset.deserializer_,
-						*impl_->parent_resultset.channel_,
-						impl_->parent_resultset.meta_.fields(),
-						impl_->buffer,
-						impl_->values,
-						impl_->parent_resultset.ok_packet_,
+					yield impl_->parent_resultset.channel_->async_read(
+						impl_->parent_resultset.buffer_,
 						std::move(*this)
 					);
-					if (result == detail::read_row_result::error)
+					if (!err)
 					{
-						detail::conditional_assign(impl_->output_info_, std::move(info));
-						this->complete(cont, err, std::move(impl_->rows));
-						yield break;
+						auto result = impl_->parent_resultset.process_columnar_packet(impl_->batch, impl_->plan, err, info);
+						if (result == detail::read_row_result::row)
+						{
+							--impl_->remaining;
+						}
 					}
-					else if (result == detail::read_row_result::eof)
+					if (err)
 					{
-						impl_->parent_resultset.eof_received_ = true;
+						impl_->parent_resultset.trace_fetch(impl_->batch.size(), err, info);
+						detail::conditional_assign(impl_->output_info_, std::move(info));
+						this->complete(cont, err, std::move(impl_->batch));
+						yield break;
 					}
-					else
+				}
+				if (!impl_->initially_complete)
+				{
+					impl_->parent_resultset.trace_fetch(impl_->batch.size(), err, info);
+				}
+				this->complete(cont, err, std::move(impl_->batch));
+			}
+		}
+	};
+
+	assert(valid());
+
+	boost::asio::async_completion<CompletionToken, HandlerSignature> initiator(token);
+
+	auto impl = detail::allocate_operation_state<OpImpl>(
+		initiator.completion_handler,
+		channel_->operation_allocator(),
+		*this,
+		max_rows,
+		info
+	);
+	Op(
+		std::move(initiator.completion_handler),
+		std::move(impl)
+	)(error_code(), false);
+	return initiator.result.get();
+}
+
+template <typename StreamType>
+template <typename RowType, typename CompletionToken>
+BOOST_ASIO_INITFN_RESULT_TYPE(
+	CompletionToken,
+	typename boost::mysql::resultset<StreamType>::template fetch_one_as_signature<RowType>
+)
+boost::mysql::resultset<StreamType>::async_fetch_one_as(
+	CompletionToken&& token,
+	error_info* info
+)
+{
+	detail::conditional_clear(info);
+	detail::check_completion_token<CompletionToken, fetch_one_as_signature<RowType>>();
+
+	using HandlerSignature = fetch_one_as_signature<RowType>;
+	using HandlerType = BOOST_ASIO_HANDLER_TYPE(CompletionToken, HandlerSignature);
+	using BaseType = boost::beast::async_base<
+		HandlerType,
+		typename StreamType::executor_type,
+		detail::recycling_allocator<void>
+	>;
+
+	struct Op: BaseType, boost::asio::coroutine
+	{
+		resultset<StreamType>& resultset_;
+		error_info* output_info_;
+		detail::latency_timer timer_;
+		RowType output_ {};
+
+		Op(
+			HandlerType&& handler,
+			resultset<StreamType>& obj,
+			error_info* output_info
+		):
+			BaseType(std::move(handler), obj.channel_->next_layer().get_executor(), obj.channel_->operation_allocator()),
+			resultset_(obj),
+			output_info_(output_info),
+			timer_(obj.channel_->latency(), latency_operation::fetch)
+		{
+		};
+
+		void before_invoke_hook() override { timer_.finish(); }
+
+		void operator()(
+			error_code err,
+			bool cont=true
+		)
+		{
+			error_info info;
+			auto result = detail::read_row_result::error;
+			reenter(*this)
+			{
+				if (resultset_.complete())
+				{
+					this->complete(cont, error_code(), std::optional<RowType>());
+				}
+				else
+				{
+					if (resultset_.template check_row_type<RowType>(err, info))
 					{
-						impl_->row_received();
+						yield resultset_.channel_->async_read(resultset_.buffer_, std::move(*this));
+						if (!err)
+						{
+							result = resultset_.process_typed_packet(output_, err, info);
+						}
 					}
+					resultset_.trace_fetch(result == detail::read_row_result::row ? 1 : 0, err, info);
+					detail::conditional_assign(output_info_, std::move(info));
+					this->complete(
+						cont,
+						err,
+						result == detail::read_row_result::row ?
+								std::optional<RowType>(std::move(output_)) : std::optional<RowType>()
+					);
 				}
-				this->complete(cont, err, std::move(impl_->rows));
 			}
 		}
 	};
@@ -305,30 +1329,141 @@ boost::mysql::resultset<StreamType>::async_fetch_many(
 
 	Op(
 		std::move(initiator.completion_handler),
-		std::make_shared<OpImpl>(*this, count, info)
-	)(error_code(), error_info(), detail::read_row_result::error, false);
+		*this,
+		info
+	)(error_code(), false);
 	return initiator.result.get();
 }
 
 template <typename StreamType>
-template <typename CompletionToken>
+template <typename RowType, typename CompletionToken>
 BOOST_ASIO_INITFN_RESULT_TYPE(
 	CompletionToken,
-	typename boost::mysql::resultset<StreamType>::fetch_all_signature
+	typename boost::mysql::resultset<StreamType>::template fetch_many_as_signature<RowType>
 )
-boost::mysql::resultset<StreamType>::async_fetch_all(
+boost::mysql::resultset<StreamType>::async_fetch_many_as(
+	std::size_t count,
 	CompletionToken&& token,
 	error_info* info
 )
 {
-	return async_fetch_many(
-		std::numeric_limits<std::size_t>::max(),
-		std::forward<CompletionToken>(token),
+	static_assert(!detail::row_type_has_views<RowType>,
+		"fetch_many_as rows can't have std::string_view elements, use std::string instead");
+	detail::conditional_clear(info);
+	detail::check_completion_token<CompletionToken, fetch_many_as_signature<RowType>>();
+
+	using HandlerSignature = fetch_many_as_signature<RowType>;
+	using HandlerType = BOOST_ASIO_HANDLER_TYPE(CompletionToken, HandlerSignature);
+	using BaseType = boost::beast::async_base<
+		HandlerType,
+		typename StreamType::executor_type,
+		detail::recycling_allocator<void>
+	>;
+
+	struct OpImpl
+	{
+		resultset<StreamType>& parent_resultset;
+		std::vector<RowType> rows;
+		std::size_t remaining;
+		error_info* output_info_;
+		bool initially_complete;
+
+		OpImpl(resultset<StreamType>& obj, std::size_t count, error_info* output_info):
+			parent_resultset(obj),
+			remaining(count),
+			output_info_(output_info),
+			initially_complete(obj.complete())
+		{
+		};
+	};
+
+	struct Op: BaseType, boost::asio::coroutine
+	{
+		std::shared_ptr<OpImpl> impl_;
+		detail::latency_timer timer_;
+
+		Op(
+			HandlerType&& handler,
+			std::shared_ptr<OpImpl>&& impl
+		):
+			BaseType(std::move(handler), impl->parent_resultset.channel_->next_layer().get_executor(), impl->parent_resultset.channel_->operation_allocator()),
+			impl_(std::move(impl)),
+			timer_(impl_->parent_resultset.channel_->latency(), latency_operation::fetch)
+		{
+		};
+
+		void before_invoke_hook() override { timer_.finish(); }
+
+		void operator()(
+			error_code err,
+			bool cont=true
+		)
+		{
+			error_info info;
+			reenter(*this)
+			{
+				if (!impl_->initially_complete &&
+					!impl_->parent_resultset.template check_row_type<RowType>(err, info))
+				{
+					impl_->parent_resultset.trace_fetch(0, err, info);
+					detail::conditional_assign(impl_->output_info_, std::move(info));
+					this->complete(cont, err, std::move(impl_->rows));
+					yield break;
+				}
+				while (!impl_->parent_resultset.complete() && impl_->remaining > 0)
+				{
+					yield impl_->parent_resultset.channel_->async_read(
+						impl_->parent_resultset.buffer_,
+						std::move(*this)
+					);
+					if (!err)
+					{
+						auto result = impl_->parent_resultset.process_typed_packet(
+							impl_->rows.emplace_back(), err, info);
+						if (result == detail::read_row_result::row)
+						{
+							--impl_->remaining;
+						}
+						else
+						{
+							impl_->rows.pop_back();
+						}
+					}
+					if (err)
+					{
+						impl_->parent_resultset.trace_fetch(impl_->rows.size(), err, info);
+						detail::conditional_assign(impl_->output_info_, std::move(info));
+						this->complete(cont, err, std::move(impl_->rows));
+						yield break;
+					}
+				}
+				if (!impl_->initially_complete)
+				{
+					impl_->parent_resultset.trace_fetch(impl_->rows.size(), err, info);
+				}
+				this->complete(cont, err, std::move(impl_->rows));
+			}
+		}
+	};
+
+	assert(valid());
+
+	boost::asio::async_completion<CompletionToken, HandlerSignature> initiator(token);
+
+	auto impl = detail::allocate_operation_state<OpImpl>(
+		initiator.completion_handler,
+		channel_->operation_allocator(),
+		*this,
+		count,
 		info
 	);
+	Op(
+		std::move(initiator.completion_handler),
+		std::move(impl)
+	)(error_code(), false);
+	return initiator.result.get();
 }
 
-
 #include <boost/asio/unyield.hpp>
 
 
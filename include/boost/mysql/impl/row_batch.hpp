@@ -0,0 +1,78 @@
+#ifndef INCLUDE_BOOST_MYSQL_IMPL_ROW_BATCH_HPP_
+#define INCLUDE_BOOST_MYSQL_IMPL_ROW_BATCH_HPP_
+
+inline std::uint8_t* boost::mysql::row_batch::grow_packet(
+	std::size_t size
+)
+{
+	// Chunks never grow beyond their reserved capacity, as reallocating them
+	// would invalidate the values pointing into them. If the packet does not fit,
+	// the part read so far is moved to a new chunk: no values point into it yet.
+	if (chunks_.empty() || chunks_.back().capacity() - chunks_.back().size() < size)
+	{
+		detail::resource_bytestring chunk (memory_resource());
+		chunk.reserve(std::max(default_chunk_size, pending_size_ + size));
+		if (pending_size_)
+		{
+			auto& old_chunk = chunks_.back();
+			chunk.resize(pending_size_);
+			std::memcpy(chunk.data(), old_chunk.data() + old_chunk.size() - pending_size_, pending_size_);
+			old_chunk.resize(old_chunk.size() - pending_size_);
+		}
+		chunks_.push_back(std::move(chunk));
+	}
+
+	// resize is much faster than insert for non-standard allocators
+	auto& chunk = chunks_.back();
+	std::size_t old_size = chunk.size();
+	chunk.resize(old_size + size);
+	pending_size_ += size;
+	return chunk.data() + old_size;
+}
+
+inline boost::asio::const_buffer boost::mysql::row_batch::pending_packet() const noexcept
+{
+	if (chunks_.empty()) return boost::asio::const_buffer();
+	const auto& chunk = chunks_.back();
+	return boost::asio::buffer(chunk.data() + chunk.size() - pending_size_, pending_size_);
+}
+
+inline void boost::mysql::row_batch::discard_packet() noexcept
+{
+	if (pending_size_ == 0) return;
+	assert(!chunks_.empty() && chunks_.back().size() >= pending_size_);
+	chunks_.back().resize(chunks_.back().size() - pending_size_);
+	pending_size_ = 0;
+}
+
+inline void boost::mysql::row_batch::append_row(
+	const std::pmr::vector<value>& row_values
+)
+{
+	assert(row_values.size() == num_fields_);
+	values_.insert(values_.end(), row_values.begin(), row_values.end());
+	++num_rows_;
+	pending_size_ = 0;
+}
+
+inline std::uint8_t* boost::mysql::row_batch::packet_buffer::data() noexcept
+{
+	auto& chunk = batch_.chunks_.back();
+	return chunk.data() + chunk.size() - batch_.pending_size_;
+}
+
+inline std::size_t boost::mysql::row_batch::packet_buffer::capacity() const noexcept
+{
+	return batch_.chunks_.empty() ? 0 : batch_.chunks_.back().capacity();
+}
+
+inline void boost::mysql::row_batch::packet_buffer::resize(
+	std::size_t size
+)
+{
+	// channel::read only grows packets
+	assert(size >= batch_.pending_size_);
+	batch_.grow_packet(size - batch_.pending_size_);
+}
+
+#endif /* INCLUDE_BOOST_MYSQL_IMPL_ROW_BATCH_HPP_ */
@@ -0,0 +1,56 @@
+#ifndef INCLUDE_BOOST_MYSQL_IMPL_SSL_HPP_
+#define INCLUDE_BOOST_MYSQL_IMPL_SSL_HPP_
+
+inline bool boost::mysql::ssl_session_cache::empty() const
+{
+	std::lock_guard<std::mutex> lock (mtx_);
+	return session_ == nullptr;
+}
+
+inline void boost::mysql::ssl_session_cache::clear()
+{
+	std::lock_guard<std::mutex> lock (mtx_);
+	session_.reset();
+}
+
+inline void boost::mysql::ssl_session_cache::load(
+	SSL* ssl
+) const
+{
+	std::lock_guard<std::mutex> lock (mtx_);
+	if (session_)
+	{
+		// If the server rejects the session, a full handshake is performed transparently.
+		// Hand out a copy: OpenSSL marks a session as not resumable when a connection
+		// using it is closed without a TLS shutdown, which would spoil the cached one
+		SSL_SESSION* copy = SSL_SESSION_dup(session_.get());
+		if (copy)
+		{
+			SSL_set_session(ssl, copy); // takes its own reference
+			SSL_SESSION_free(copy);
+		}
+	}
+}
+
+inline void boost::mysql::ssl_session_cache::store(
+	SSL* ssl
+)
+{
+	// With TLS 1.3, session tickets are sent after the handshake, so this
+	// should be called once some data has been read from the server.
+	// As in load(), we keep a copy, so closing the connection doesn't affect it
+	SSL_SESSION* session = SSL_get0_session(ssl);
+	if (!session || !SSL_SESSION_is_resumable(session))
+	{
+		return;
+	}
+	SSL_SESSION* copy = SSL_SESSION_dup(session);
+	if (!copy)
+	{
+		return;
+	}
+	std::lock_guard<std::mutex> lock (mtx_);
+	session_.reset(copy);
+}
+
+#endif /* INCLUDE_BOOST_MYSQL_IMPL_SSL_HPP_ */
@@ -80,6 +80,22 @@ inline bool boost::mysql::operator==(
 	return detail::container_equals(lhs, rhs);
 }
 
+inline bool boost::mysql::operator==(
+	const std::pmr::vector<value>& lhs,
+	const std::pmr::vector<value>& rhs
+)
+{
+	return detail::container_equals(lhs, rhs);
+}
+
+inline bool boost::mysql::operator==(
+	const std::pmr::vector<value>& lhs,
+	const std::vector<value>& rhs
+)
+{
+	return detail::container_equals(lhs, rhs);
+}
+
 inline std::ostream& boost::mysql::operator<<(
 	std::ostream& os,
 	const value& value
@@ -0,0 +1,115 @@
+#ifndef INCLUDE_BOOST_MYSQL_LATENCY_HISTOGRAM_HPP_
+#define INCLUDE_BOOST_MYSQL_LATENCY_HISTOGRAM_HPP_
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+namespace boost {
+namespace mysql {
+
+/**
+ * \brief A histogram of durations with bounded relative error.
+ * \details Like HDR histograms, values are classified in buckets whose
+ * width is proportional to their magnitude: each power of two is split in 16
+ * buckets, which bounds the relative error of any reported value to 6.25%.
+ * Values up to 2^40 nanoseconds (around 18 minutes) are tracked; bigger ones
+ * are recorded in the last bucket. Recording is constant time and never allocates.
+ */
+class latency_histogram
+{
+public:
+	/// The type of the recorded values.
+	using duration = std::chrono::nanoseconds;
+
+	/// Number of buckets in the histogram.
+	static constexpr std::size_t num_buckets = 592;
+
+	/// Records a value. Negative values are recorded as zero.
+	void record(duration value) noexcept;
+
+	/// The number of recorded values.
+	std::uint64_t count() const noexcept { return count_; }
+
+	/// The smallest recorded value, or zero if count() == 0.
+	duration min() const noexcept { return count_ ? duration(min_) : duration(0); }
+
+	/// The biggest recorded value, or zero if count() == 0.
+	duration max() const noexcept { return duration(max_); }
+
+	/// The mean of the recorded values, or zero if count() == 0.
+	duration mean() const noexcept { return count_ ? duration(sum_ / count_) : duration(0); }
+
+	/**
+	 * \brief The value below which percentile percent of the recorded values fall.
+	 * \details percentile must be between 0 and 100. Returns an upper bound of
+	 * the actual value (the upper bound of its bucket, clamped to max()),
+	 * or zero if count() == 0. E.g. percentile(99) is the p99 latency.
+	 */
+	duration percentile(double percentile) const noexcept;
+
+	/// Adds the values recorded in other to this histogram.
+	void merge(const latency_histogram& other) noexcept;
+
+	/// Removes all recorded values.
+	void reset() noexcept { *this = latency_histogram(); }
+private:
+	std::array<std::uint64_t, num_buckets> buckets_ {};
+	std::uint64_t count_ {0};
+	std::uint64_t sum_ {0};
+	std::uint64_t min_ {UINT64_MAX};
+	std::uint64_t max_ {0};
+
+	static std::size_t bucket_index(std::uint64_t value) noexcept;
+	static std::uint64_t bucket_upper_bound(std::size_t index) noexcept;
+};
+
+/// The network algorithms for which latency is measured (\see connection::latency).
+enum class latency_operation
+{
+	handshake,         ///< connection::handshake.
+	query,             ///< connection::query.
+	prepare_statement, ///< connection::prepare_statement.
+	execute_statement, ///< prepared_statement::execute.
+	fetch,             ///< resultset::fetch_one, fetch_many, fetch_all and fetch_batch.
+	close_statement    ///< prepared_statement::close.
+};
+
+/// Number of values in latency_operation.
+constexpr std::size_t num_latency_operations = 6;
+
+/**
+ * \brief Latency of a network algorithm, split by where the time was spent.
+ * \details network holds the time spent waiting on the stream (the server and the
+ * network). processing holds the rest: serialization, deserialization and
+ * any other client-side processing. Each execution of the algorithm records
+ * one value in each histogram.
+ */
+struct operation_latency
+{
+	latency_histogram network;    ///< Time spent waiting on reads and writes.
+	latency_histogram processing; ///< Time spent in the client, outside reads and writes.
+};
+
+/// Latency histograms for each network algorithm of a connection.
+class latency_histograms
+{
+	std::array<operation_latency, num_latency_operations> ops_;
+public:
+	/// Retrieves the histograms for a given operation.
+	operation_latency& operator[](latency_operation op) noexcept { return ops_[static_cast<std::size_t>(op)]; }
+
+	/// Retrieves the histograms for a given operation.
+	const operation_latency& operator[](latency_operation op) const noexcept { return ops_[static_cast<std::size_t>(op)]; }
+
+	/// Removes all recorded values.
+	void reset() noexcept { for (auto& op: ops_) { op.network.reset(); op.processing.reset(); } }
+};
+
+} // mysql
+} // boost
+
+#include "boost/mysql/impl/latency_histogram.ipp"
+
+#endif /* INCLUDE_BOOST_MYSQL_LATENCY_HISTOGRAM_HPP_ */
@@ -0,0 +1,92 @@
+#ifndef INCLUDE_BOOST_MYSQL_LAZY_ROW_HPP_
+#define INCLUDE_BOOST_MYSQL_LAZY_ROW_HPP_
+
+#include "boost/mysql/error.hpp"
+#include "boost/mysql/value.hpp"
+#include "boost/mysql/row.hpp"
+#include "boost/mysql/metadata.hpp"
+#include "boost/mysql/detail/protocol/row_scanning.hpp"
+#include <cassert>
+#include <memory_resource>
+#include <vector>
+
+namespace boost {
+namespace mysql {
+
+/**
+ * \brief A row whose values are decoded the first time they are accessed.
+ * \details Returned by resultset::fetch_one_lazy. When the row is fetched,
+ * only the location of each value within the received message is computed.
+ * Accessing a value with get() decodes it and caches the result, so
+ * fields you never access (e.g. DATETIMEs or DOUBLEs you are not
+ * interested in) are never parsed.
+ *
+ * Like the row returned by fetch_one, a lazy_row points into memory owned
+ * by the resultset: destroying or moving the resultset, or calling any of
+ * its fetch methods, invalidates it. Fields excluded by the resultset's
+ * projection (\see resultset::set_projection) are reported as NULL.
+ *
+ * get() modifies the row's internal cache, so a lazy_row may not be
+ * accessed concurrently, even if only const member functions are called.
+ */
+class lazy_row
+{
+	const detail::resultset_metadata* meta_ {nullptr};
+	bool binary_ {false};
+	std::pmr::vector<detail::field_bounds> bounds_;
+	mutable std::pmr::vector<value> values_;
+	mutable std::pmr::vector<bool> decoded_;
+public:
+	/// Default constructor.
+	lazy_row() = default;
+
+	/// Constructs an empty row whose memory will be allocated from resource.
+	explicit lazy_row(std::pmr::memory_resource* resource):
+		bounds_(resource), values_(resource), decoded_(resource) {};
+
+	/// The number of values in the row.
+	std::size_t size() const noexcept { return bounds_.size(); }
+
+	/// Returns true if the i-th value is NULL (or projected out), without decoding it.
+	bool is_null(std::size_t i) const noexcept
+	{
+		assert(i < size());
+		return bounds_[i].is_null() || !meta_->is_projected(i);
+	}
+
+	/// Returns true if the i-th value has already been decoded.
+	bool is_decoded(std::size_t i) const noexcept { assert(i < size()); return decoded_[i]; }
+
+	/**
+	 * \brief Returns the i-th value, decoding it if required (error code version).
+	 * \details If the value can't be decoded, err is set and NULL is returned.
+	 */
+	const value& get(std::size_t i, error_code& err) const;
+
+	/// Returns the i-th value, decoding it if required (exceptions version).
+	const value& get(std::size_t i) const;
+
+	/**
+	 * \brief Returns the value of the field called name, decoding it if required (exceptions version).
+	 * \details Lookup takes constant time (\see row::operator[](std::string_view)).
+	 * Throws std::out_of_range if there is no such field.
+	 */
+	const value& get(std::string_view name) const;
+
+	/// Decodes all the values into a (non-owning) row (exceptions version).
+	row to_row() const;
+
+	// Private, do not use. Splits a row message into its fields.
+	errc assign(
+		detail::deserialization_context& ctx,
+		const detail::resultset_metadata& meta,
+		bool binary
+	);
+};
+
+} // mysql
+} // boost
+
+#include "boost/mysql/impl/lazy_row.hpp"
+
+#endif /* INCLUDE_BOOST_MYSQL_LAZY_ROW_HPP_ */
@@ -2,8 +2,20 @@
 #define MYSQL_ASIO_METADATA_HPP
 
 #include "boost/mysql/detail/protocol/common_messages.hpp"
+#include "boost/mysql/detail/protocol/binary_row_plan.hpp"
 #include "boost/mysql/detail/auxiliar/bytestring.hpp"
+#include "boost/mysql/detail/auxiliar/pmr_vector.hpp"
+#include "boost/mysql/detail/auxiliar/field_name_index.hpp"
 #include "boost/mysql/field_type.hpp"
+#include <boost/asio/buffer.hpp>
+#include <cassert>
+#include <cstring>
+#include <memory>
+#include <memory_resource>
+#include <mutex>
+#include <new>
+#include <optional>
+#include <vector>
 
 namespace boost {
 namespace mysql {
@@ -99,20 +111,215 @@ public:
 
 namespace detail {
 
+// A field_name_index built the first time a name is looked up, rather than
+// when rows are read, so resultsets only indexed by position don't pay for it.
+// Shared by a resultset_metadata and the rows read using it.
+class lazy_field_name_index
+{
+	const field_metadata* fields_;
+	std::size_t num_fields_;
+	std::pmr::memory_resource* resource_;
+	mutable std::once_flag built_;
+	mutable std::optional<field_name_index> index_;
+
+	const field_name_index& index() const
+	{
+		std::call_once(built_, [this] {
+			index_.emplace(fields_, fields_ + num_fields_, resource_);
+		});
+		return *index_;
+	}
+public:
+	// fields must remain valid until the index is built
+	lazy_field_name_index(
+		const field_metadata* fields,
+		std::size_t num_fields,
+		std::pmr::memory_resource* resource
+	) noexcept:
+		fields_(fields), num_fields_(num_fields), resource_(resource) {}
+
+	// Returns the position of the first field called name, or field_name_index::npos if there is none
+	std::size_t find(std::string_view name) const { return index().find(name); }
+
+	// Builds the index now, so it no longer needs the fields
+	void build() const { index(); }
+};
+
+// Everything is allocated from the memory resource of packets_,
+// which is the resultset's one
 class resultset_metadata
 {
-	std::vector<bytestring> buffers_;
-	std::vector<field_metadata> fields_;
+	resource_bytestring packets_; // all field definition packets, one after another
+	std::pmr::vector<std::size_t> packet_ends_; // where each packet ends within packets_
+	pmr_vector<field_metadata> fields_; // point into packets_
+	std::shared_ptr<const resultset_metadata> shared_; // if set, fields are taken from it
+	pmr_vector<bool> projection_; // empty means all fields
+	binary_row_plan binary_plan_;
+	mutable std::shared_ptr<const lazy_field_name_index> name_index_; // created on first use
+
+	std::pmr::memory_resource* resource() const noexcept { return packets_.get_allocator().resource(); }
+
+	// Rows may outlive the fields their name index is built from
+	void release_name_index()
+	{
+		if (name_index_ && name_index_.use_count() > 1) name_index_->build();
+		name_index_.reset();
+	}
+
+	void compute_binary_plan()
+	{
+		const auto& fields = this->fields();
+		binary_plan_.clear();
+		if (shared_ && projection_.empty()) return; // shared_'s plan is used
+		binary_plan_.reserve(fields.size());
+		for (std::size_t i = 0; i < fields.size(); ++i)
+		{
+			const auto& field = fields[i];
+			binary_plan_.push_back(is_projected(i) ?
+				get_binary_value_decoder(field.protocol_type(), field.is_unsigned()) :
+				get_binary_value_skipper(field.protocol_type()));
+		}
+	}
 public:
 	resultset_metadata() = default;
-	resultset_metadata(std::vector<bytestring>&& buffers, std::vector<field_metadata>&& fields):
-		buffers_(std::move(buffers)), fields_(std::move(fields)) {};
+	resultset_metadata(
+		resource_bytestring&& packets,
+		std::pmr::vector<std::size_t>&& packet_ends,
+		std::pmr::vector<field_metadata>&& fields
+	):
+		packets_(std::move(packets)),
+		packet_ends_(std::move(packet_ends)),
+		fields_(std::move(fields)),
+		projection_(resource()),
+		binary_plan_(resource())
+	{
+		compute_binary_plan();
+	}
+	// Uses the fields of shared, which must not change while this object is alive.
+	// Used for metadata cached by the client, e.g. by prepared statements
+	resultset_metadata(std::shared_ptr<const resultset_metadata> shared, std::pmr::memory_resource* resource):
+		packets_(resource),
+		packet_ends_(resource),
+		fields_(resource),
+		shared_(std::move(shared)),
+		projection_(resource),
+		binary_plan_(resource)
+	{
+		compute_binary_plan();
+	}
 	resultset_metadata(const resultset_metadata&) = delete;
 	resultset_metadata(resultset_metadata&&) = default;
 	resultset_metadata& operator=(const resultset_metadata&) = delete;
-	resultset_metadata& operator=(resultset_metadata&&) = default;
-	~resultset_metadata() = default;
-	const auto& fields() const noexcept { return fields_; }
+	// Behaves like move construction. Move assigning the pmr containers would keep
+	// our resource, copying the elements if it is not the one of rhs
+	resultset_metadata& operator=(resultset_metadata&& rhs) noexcept
+	{
+		if (this != &rhs)
+		{
+			this->~resultset_metadata();
+			new (this) resultset_metadata(std::move(rhs));
+		}
+		return *this;
+	}
+	~resultset_metadata() { release_name_index(); }
+	const pmr_vector<field_metadata>& fields() const noexcept { return shared_ ? shared_->fields() : fields_; }
+	const binary_row_plan& binary_plan() const noexcept
+	{
+		return shared_ && projection_.empty() ? shared_->binary_plan() : binary_plan_;
+	}
+
+	// Maps field names to positions, shared by the rows read using this metadata.
+	// Allocated from the memory resource of the packets the first time it is
+	// requested, and built the first time a name is looked up
+	const std::shared_ptr<const lazy_field_name_index>& name_index() const
+	{
+		if (shared_) return shared_->name_index();
+		if (!name_index_)
+		{
+			name_index_ = std::allocate_shared<lazy_field_name_index>(
+				resource_allocator<lazy_field_name_index>(resource()),
+				fields_.data(),
+				fields_.size(),
+				resource()
+			);
+		}
+		return name_index_;
+	}
+
+	// The raw field definition packets fields() point into
+	std::size_t num_packets() const noexcept { return shared_ ? shared_->num_packets() : packet_ends_.size(); }
+	boost::asio::const_buffer packet(std::size_t i) const noexcept
+	{
+		if (shared_) return shared_->packet(i);
+		assert(i < packet_ends_.size());
+		std::size_t first = i == 0 ? 0 : packet_ends_[i - 1];
+		return boost::asio::buffer(packets_.data() + first, packet_ends_[i] - first);
+	}
+
+	// Fields not in the projection are not decoded, but reported as NULL
+	const pmr_vector<bool>& projection() const noexcept { return projection_; }
+	bool is_projected(std::size_t field_index) const noexcept
+	{
+		return projection_.empty() || projection_[field_index];
+	}
+	void set_projection(const std::vector<bool>& projection)
+	{
+		assert(projection.empty() || projection.size() == fields().size());
+		projection_.assign(projection.begin(), projection.end());
+		compute_binary_plan();
+	}
+};
+
+// Accumulates the field definition packets of a resultset into a single buffer,
+// rather than allocating one per packet. Packets are parsed once all of them
+// have been received, since growing the buffer moves them around.
+class resultset_metadata_builder
+{
+	resource_bytestring packets_;
+	std::pmr::vector<std::size_t> packet_ends_;
+public:
+	// Guess for the average size of a field definition packet, used to reserve space
+	static constexpr std::size_t estimated_packet_size = 64;
+
+	explicit resultset_metadata_builder(std::pmr::memory_resource* resource):
+		packets_(resource), packet_ends_(resource) {}
+
+	std::size_t num_packets() const noexcept { return packet_ends_.size(); }
+
+	void reserve(std::size_t num_fields)
+	{
+		packets_.reserve(num_fields * estimated_packet_size);
+		packet_ends_.reserve(num_fields);
+	}
+
+	void add_packet(boost::asio::const_buffer packet)
+	{
+		// resize + memcpy is much faster than insert, which constructs
+		// elements one by one for non-standard allocators
+		std::size_t old_size = packets_.size();
+		packets_.resize(old_size + packet.size());
+		if (packet.size()) std::memcpy(packets_.data() + old_size, packet.data(), packet.size());
+		packet_ends_.push_back(packets_.size());
+	}
+
+	// Parses the packets added so far into output
+	error_code build(capabilities caps, resultset_metadata& output) &&
+	{
+		std::pmr::vector<field_metadata> fields (packets_.get_allocator().resource());
+		fields.reserve(packet_ends_.size());
+		std::size_t first = 0;
+		for (std::size_t last: packet_ends_)
+		{
+			column_definition_packet field_definition;
+			deserialization_context ctx (packets_.data() + first, packets_.data() + last, caps);
+			auto err = deserialize_message(field_definition, ctx);
+			if (err) return err;
+			fields.emplace_back(field_definition);
+			first = last;
+		}
+		output = resultset_metadata(std::move(packets_), std::move(packet_ends_), std::move(fields));
+		return error_code();
+	}
 };
 
 } // detail
@@ -0,0 +1,192 @@
+#ifndef INCLUDE_BOOST_MYSQL_PIPELINE_HPP_
+#define INCLUDE_BOOST_MYSQL_PIPELINE_HPP_
+
+#include "boost/mysql/resultset.hpp"
+#include "boost/mysql/prepared_statement.hpp"
+#include "boost/mysql/error.hpp"
+#include "boost/mysql/connection_observer.hpp"
+#include "boost/mysql/detail/protocol/channel.hpp"
+#include "boost/mysql/detail/network_algorithms/common.hpp" // deserialize_row_fn
+#include "boost/mysql/detail/auxiliar/bytestring.hpp"
+#include <boost/asio/ip/tcp.hpp>
+#include <boost/asio/local/stream_protocol.hpp>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace boost {
+namespace mysql {
+
+namespace detail {
+
+// A request queued in a pipeline
+struct pipeline_entry
+{
+	deserialize_row_fn deserializer;
+	std::shared_ptr<const resultset_metadata> cached_metadata; // used if the server omits field definitions
+	traced_operation operation;
+	std::string sql; // for queries, reported to the connection_observer when written
+	std::uint32_t statement_id; // for prepared statement executions, zero otherwise
+	std::uint8_t response_sequence_number; // the one the first response packet (or frame, with compression) will have
+	error_code err; // set if the request could not be queued (e.g. wrong number of params)
+	std::string err_message;
+};
+
+} // detail
+
+/**
+ * \brief Sends several requests to the server in a single write.
+ * \details Obtained by calling connection::make_pipeline(). Normally,
+ * every query or statement execution implies a round-trip to the server:
+ * the request is written, and the response read, before the next request
+ * can be written. A pipeline allows you to queue several requests
+ * (text queries and prepared statement executions), write them all
+ * at once, and then read their responses, one after another.
+ * This saves a round-trip per request.
+ *
+ * Use it as follows:
+ * - Queue requests calling add_query() and add_execute().
+ * - Call write() to send all of them to the server. You may queue more
+ *   requests and call write() again; only requests that have not been written yet are sent.
+ * - Call read_next() once per queued request. Each call returns the resultset
+ *   generated by the corresponding request, in the order they were queued.
+ *   **You must completely read a resultset (until resultset::complete() returns true)
+ *   before calling read_next() again**. Failing to do so results in undefined behavior.
+ *
+ * If the connection has a connection_observer, on_query_start is invoked for every
+ * request when it is written, and the rest of events for a request as its response is read.
+ *
+ * An error in one request (e.g. a SQL syntax error) makes the corresponding
+ * read_next() call fail, but does not affect the rest of requests.
+ * You may call clear() to reuse the pipeline once all responses have been read.
+ *
+ * All requests are kept in memory until clear() is called. Do not queue
+ * requests while an async_write() is in progress. As the server does not
+ * read further requests while its responses are not being read,
+ * keep pipelines reasonably small.
+ *
+ * Pipelines are default-constructible and movable. A default-constructed
+ * pipeline has valid() == false. It is undefined to call any member function on
+ * an invalid pipeline, other than assignment.
+ */
+template <
+	typename Stream ///< The underlying stream to use; must satisfy Boost.Asio's SyncStream and AsyncStream concepts.
+>
+class pipeline
+{
+	detail::channel<Stream>* channel_ {};
+	std::vector<detail::pipeline_entry> entries_;
+	std::size_t next_ {0}; // next entry to read
+	std::size_t next_to_write_ {0}; // entries before this one have already been written
+	detail::bytestring buffer_; // framed requests
+	std::size_t write_offset_ {0}; // requests in buffer_ before this offset have already been written
+	detail::bytestring message_buffer_; // the request being serialized
+
+	template <typename Serializable>
+	void add_request(
+		const Serializable& request,
+		detail::deserialize_row_fn deserializer,
+		std::shared_ptr<const detail::resultset_metadata> cached_metadata,
+		traced_operation operation,
+		std::string_view sql,
+		std::uint32_t statement_id
+	);
+
+	bool next_has_error() const noexcept { return static_cast<bool>(entries_[next_].err); }
+	void consume_next_error(error_code& err, error_info& info);
+	boost::asio::const_buffer prepare_write();
+public:
+	/// Default constructor.
+	pipeline() = default;
+
+	// Private, do not use.
+	explicit pipeline(detail::channel<Stream>& chan) noexcept: channel_(&chan) {}
+
+	/// Retrieves the stream object associated with the underlying connection.
+	Stream& next_layer() noexcept { assert(channel_); return channel_->next_layer(); }
+
+	/// Retrieves the stream object associated with the underlying connection.
+	const Stream& next_layer() const noexcept { assert(channel_); return channel_->next_layer(); }
+
+	/// Returns true if the pipeline is not a default-constructed object.
+	bool valid() const noexcept { return channel_ != nullptr; }
+
+	/// The number of requests queued in the pipeline.
+	std::size_t size() const noexcept { return entries_.size(); }
+
+	/// The number of responses that have not been read yet.
+	std::size_t remaining() const noexcept { return entries_.size() - next_; }
+
+	/// Removes all requests from the pipeline, so it can be reused.
+	void clear() noexcept;
+
+	/// Queues a SQL text query, as connection::query would send it.
+	pipeline& add_query(std::string_view query_string);
+
+	/**
+	 * \brief Queues the execution of a prepared statement (iterator version).
+	 * \details The statement must have been prepared using the same
+	 * connection as this pipeline. If the number of parameters is
+	 * wrong, nothing is sent, and the read_next() call for this
+	 * request will fail with errc::wrong_num_params.
+	 */
+	template <typename ForwardIterator>
+	pipeline& add_execute(const prepared_statement<Stream>& stmt,
+			ForwardIterator params_first, ForwardIterator params_last);
+
+	/// Queues the execution of a prepared statement (collection version).
+	template <typename Collection>
+	pipeline& add_execute(const prepared_statement<Stream>& stmt, const Collection& params)
+	{
+		return add_execute(stmt, std::begin(params), std::end(params));
+	}
+
+	/// Writes all queued requests to the server, in a single write (sync with error code version).
+	void write(error_code& err, error_info& info);
+
+	/// Writes all queued requests to the server, in a single write (sync with exceptions version).
+	void write();
+
+	/// Handler signature for write.
+	using write_signature = void(error_code);
+
+	/// Writes all queued requests to the server, in a single write (async version).
+	template <typename CompletionToken>
+	BOOST_ASIO_INITFN_RESULT_TYPE(CompletionToken, write_signature)
+	async_write(CompletionToken&& token, error_info* info=nullptr);
+
+	/**
+	 * \brief Reads the response to the next request (sync with error code version).
+	 * \details The previously returned resultset, if any, must be complete.
+	 * There must be at least one response remaining (remaining() > 0).
+	 */
+	resultset<Stream> read_next(error_code& err, error_info& info);
+
+	/// Reads the response to the next request (sync with exceptions version).
+	resultset<Stream> read_next();
+
+	/// Handler signature for read_next.
+	using read_next_signature = void(error_code, resultset<Stream>);
+
+	/// Reads the response to the next request (async version).
+	template <typename CompletionToken>
+	BOOST_ASIO_INITFN_RESULT_TYPE(CompletionToken, read_next_signature)
+	async_read_next(CompletionToken&& token, error_info* info=nullptr);
+};
+
+/// A pipeline associated to a TCP connection to the MySQL server.
+using tcp_pipeline = pipeline<boost::asio::ip::tcp::socket>;
+
+#ifdef BOOST_ASIO_HAS_LOCAL_SOCKETS
+
+/// A pipeline associated to a UNIX socket connection to the MySQL server.
+using local_pipeline = pipeline<boost::asio::local::stream_protocol::socket>;
+
+#endif
+
+} // mysql
+} // boost
+
+#include "boost/mysql/impl/pipeline.hpp"
+
+#endif /* INCLUDE_BOOST_MYSQL_PIPELINE_HPP_ */
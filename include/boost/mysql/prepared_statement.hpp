@@ -41,12 +41,23 @@ constexpr std::array<value, 0> no_statement_params {};
  * After the connection with the server is closed, the server deallocates all
  * prepared statements associated with the connection. Prepared statements may
  * also be explicitly deallocated by calling prepared_statement::close.
+ *
+ * The statement keeps the field definitions the server sent when preparing it.
+ * Resultsets whose field definitions match these share them, rather than
+ * parsing and storing their own copy. If the server supports optional resultset metadata (see
+ * connection::supports_optional_metadata) and the session variable
+ * resultset_metadata is set to NONE, the server omits these definitions
+ * when executing the statement, and the resultset uses the cached ones. Only statements
+ * prepared before setting the variable have a cached copy; executing any other
+ * statement, or running a text query, fails with errc::missing_metadata.
+ * The rows of such resultsets are read and discarded, so the connection remains usable.
  */
 template <typename Stream>
 class prepared_statement
 {
 	detail::channel<Stream>* channel_ {};
 	detail::com_stmt_prepare_ok_packet stmt_msg_;
+	std::shared_ptr<const detail::resultset_metadata> metadata_; // field definitions sent at prepare time, if any
 
 	template <typename ForwardIterator>
 	void check_num_params(ForwardIterator first, ForwardIterator last, error_code& err, error_info& info) const;
@@ -55,8 +66,15 @@ public:
 	prepared_statement() = default;
 
 	// Private. Do not use.
-	prepared_statement(detail::channel<Stream>& chan, const detail::com_stmt_prepare_ok_packet& msg) noexcept:
-		channel_(&chan), stmt_msg_(msg) {}
+	prepared_statement(
+		detail::channel<Stream>& chan,
+		const detail::com_stmt_prepare_ok_packet& msg,
+		std::shared_ptr<const detail::resultset_metadata> metadata = nullptr
+	) noexcept:
+		channel_(&chan), stmt_msg_(msg), metadata_(std::move(metadata)) {}
+
+	// Private. Do not use.
+	const std::shared_ptr<const detail::resultset_metadata>& cached_metadata() const noexcept { return metadata_; }
 
 	/// Retrieves the stream object associated with the underlying connection.
 	Stream& next_layer() noexcept { assert(channel_); return channel_->next_layer(); }
@@ -165,6 +183,13 @@ public:
 /// A prepared statement associated to a TCP connection to the MySQL server.
 using tcp_prepared_statement = prepared_statement<boost::asio::ip::tcp::socket>;
 
+#ifdef BOOST_ASIO_HAS_LOCAL_SOCKETS
+
+/// A prepared statement associated to a UNIX socket connection to the MySQL server.
+using local_prepared_statement = prepared_statement<boost::asio::local::stream_protocol::socket>;
+
+#endif
+
 } // mysql
 } // boost
 
@@ -2,13 +2,21 @@
 #define MYSQL_ASIO_RESULTSET_HPP
 
 #include "boost/mysql/row.hpp"
+#include "boost/mysql/row_batch.hpp"
+#include "boost/mysql/lazy_row.hpp"
+#include "boost/mysql/column_batch.hpp"
 #include "boost/mysql/metadata.hpp"
 #include "boost/mysql/detail/protocol/common_messages.hpp"
 #include "boost/mysql/detail/protocol/channel.hpp"
 #include "boost/mysql/detail/auxiliar/bytestring.hpp"
 #include "boost/mysql/detail/network_algorithms/common.hpp" // deserialize_row_fn
+#include "boost/mysql/detail/network_algorithms/read_row.hpp" // read_row_result
+#include "boost/mysql/detail/protocol/columnar_deserialization.hpp" // binary_columnar_plan
 #include <boost/asio/ip/tcp.hpp>
+#include <boost/asio/local/stream_protocol.hpp>
 #include <cassert>
+#include <memory_resource>
+#include <optional>
 
 namespace boost {
 namespace mysql {
@@ -41,6 +49,11 @@ namespace mysql {
  * **only after the resultset is complete**. Failing to do so results
  * in undefined behavior.
  *
+ * Resultsets allocate their metadata and the rows they return from a
+ * std::pmr::memory_resource: the one set in the connection when the resultset
+ * was created (\see connection::set_memory_resource). You can change
+ * the resource used for subsequently fetched rows with resultset::set_memory_resource.
+ *
  * Resultsets are default-constructible. A default-constructed resultset has
  * valid() == false. It is undefined to call any member function on an invalid
  * resultset, other than assignment. Resultsets are movable but not copyable.
@@ -55,19 +68,86 @@ class resultset
 	detail::deserialize_row_fn deserializer_ {};
 	channel_type* channel_;
 	detail::resultset_metadata meta_;
+	std::pmr::memory_resource* resource_ {std::pmr::get_default_resource()};
 	row current_row_;
-	detail::bytestring buffer_;
+	lazy_row current_lazy_row_;
+	detail::resource_bytestring buffer_;
 	detail::ok_packet ok_packet_;
 	bool eof_received_ {false};
+
+	// Processes the packet being read into output, keeping it as a row if it is one
+	detail::read_row_result process_batch_packet(row_batch& output, error_code& err, error_info& info);
+
+	// Processes a packet already read into buffer_, splitting it into current_lazy_row_ if it is a row
+	detail::read_row_result process_lazy_packet(error_code& err, error_info& info);
+
+	// The binary decoders for a columnar batch (empty for text resultsets)
+	detail::binary_columnar_plan make_columnar_plan() const;
+
+	// Processes a packet already read into buffer_, adding it to output if it is a row
+	detail::read_row_result process_columnar_packet(
+		column_batch& output,
+		const detail::binary_columnar_plan& plan,
+		error_code& err,
+		error_info& info
+	);
+
+	// Processes a packet already read into buffer_, decoding it into output if it is a row
+	template <typename RowType>
+	detail::read_row_result process_typed_packet(RowType& output, error_code& err, error_info& info);
+
+	// Checks that rows can be read into a RowType. Done once per row type
+	template <typename RowType>
+	bool check_row_type(error_code& err, error_info& info);
+
+	const void* checked_row_type_ {nullptr}; // the row type that passed check_row_type
+
+	bool is_binary() const noexcept { return deserializer_ == &detail::deserialize_binary_row; }
+
+	// Makes sure output has a row at position i to read into, and returns it
+	template <typename RowVector>
+	owning_row& prepare_output_row(RowVector& output, std::size_t i)
+	{
+		const auto& name_index = meta_.name_index();
+		if (i == output.size())
+		{
+			output.emplace_back(std::pmr::vector<value>(resource_), detail::resource_bytestring(resource_), name_index);
+		}
+		else if (output[i].name_index() != name_index)
+		{
+			output[i].set_name_index(name_index);
+		}
+		return output[i];
+	}
+
+	// Fetches at most count rows into output, reusing the rows it already contains.
+	// RowVector is a std::vector or a std::pmr::vector of owning_row
+	template <typename RowVector>
+	void fetch_rows(std::size_t count, RowVector& output, error_code& err, error_info& info);
+
+	// Returns current_row_, after making it indexable by field name
+	const row* named_current_row()
+	{
+		if (!current_row_.name_index()) current_row_.set_name_index(meta_.name_index());
+		return &current_row_;
+	}
+
+	// Reports the outcome of a fetch call that started on a not complete resultset to the observer
+	void trace_fetch(std::size_t num_rows, const error_code& err, const error_info& info);
+
+	template <typename> friend class field_stream;
 public:
 	/// Default constructor.
 	resultset(): channel_(nullptr) {};
 
 	// Private, do not use
 	resultset(channel_type& channel, detail::resultset_metadata&& meta, detail::deserialize_row_fn deserializer):
-		deserializer_(deserializer), channel_(&channel), meta_(std::move(meta)) {};
-	resultset(channel_type& channel, detail::bytestring&& buffer, const detail::ok_packet& ok_pack):
-		channel_(&channel), buffer_(std::move(buffer)), ok_packet_(ok_pack), eof_received_(true) {};
+		deserializer_(deserializer), channel_(&channel), meta_(std::move(meta)),
+		resource_(channel.memory_resource()), current_row_(resource_), current_lazy_row_(resource_),
+		buffer_(resource_) {};
+	resultset(channel_type& channel, detail::resource_bytestring&& buffer, const detail::ok_packet& ok_pack):
+		channel_(&channel), resource_(buffer.get_allocator().resource()), current_row_(resource_),
+		current_lazy_row_(resource_), buffer_(std::move(buffer)), ok_packet_(ok_pack), eof_received_(true) {};
 
 	/// Retrieves the stream object associated with the underlying connection.
 	StreamType& next_layer() noexcept { assert(channel_); return channel_->next_layer(); }
@@ -99,11 +179,15 @@ public:
 	 *
 	 * Only if count is **greater** than the available number of rows,
 	 * the resultset will be completed.
+	 *
+	 * The returned vector is a std::pmr::vector allocated from memory_resource().
+	 * It still converts to a std::vector<owning_row>, moving the rows, but this
+	 * is deprecated.
 	 */
-	std::vector<owning_row> fetch_many(std::size_t count, error_code& err, error_info& info);
+	detail::pmr_vector<owning_row> fetch_many(std::size_t count, error_code& err, error_info& info);
 
 	/// Fetches at most count rows (sync with exceptions version).
-	std::vector<owning_row> fetch_many(std::size_t count);
+	detail::pmr_vector<owning_row> fetch_many(std::size_t count);
 
 	/**
 	 * \brief Fetches all available rows (sync with error code version).
@@ -113,10 +197,121 @@ public:
 	 *
 	 * The resultset is guaranteed to be complete() after this call returns.
 	 */
-	std::vector<owning_row> fetch_all(error_code& err, error_info& info);
+	detail::pmr_vector<owning_row> fetch_all(error_code& err, error_info& info);
 
 	/// Fetches all available rows (sync with exceptions version).
-	std::vector<owning_row> fetch_all();
+	detail::pmr_vector<owning_row> fetch_all();
+
+	/**
+	 * \brief Fetches at most count rows into output, reusing its memory (sync with error code version).
+	 * \details Behaves like the fetch_many overload returning a vector, but output is
+	 * refilled in place: the rows it already contains are overwritten, reusing
+	 * their values and string storage, and new rows are only created when
+	 * output has less than the fetched number of rows. output is then resized
+	 * to the number of rows fetched, destroying any surplus rows. A paging loop
+	 * fetching the same number of rows every time into the same vector performs
+	 * no allocations once warmed up (save for the final, shorter page).
+	 *
+	 * Reused rows keep the memory resource they were created with, which must outlive them.
+	 */
+	void fetch_many(std::size_t count, std::vector<owning_row>& output, error_code& err, error_info& info);
+
+	/// Fetches at most count rows into output, reusing its memory (sync with exceptions version).
+	void fetch_many(std::size_t count, std::vector<owning_row>& output);
+
+	/**
+	 * \brief Fetches all available rows into output, reusing its memory (sync with error code version).
+	 * \details \see fetch_many(std::size_t, std::vector<owning_row>&, error_code&, error_info&).
+	 */
+	void fetch_all(std::vector<owning_row>& output, error_code& err, error_info& info);
+
+	/// Fetches all available rows into output, reusing its memory (sync with exceptions version).
+	void fetch_all(std::vector<owning_row>& output);
+
+	/**
+	 * \brief Fetches at most count rows into a row_batch (sync with error code version).
+	 * \details Behaves like fetch_many, but rows are stored in a row_batch,
+	 * which shares memory between all the rows it contains. This performs
+	 * much less memory allocations than fetch_many, specially for big
+	 * resultsets with small rows. Rows are read from the network straight
+	 * into the batch's memory, without intermediate copies. The returned batch
+	 * is guaranteed to be valid as long as it is alive, even if the resultset is destroyed.
+	 *
+	 * Calling this function invalidates any row returned by fetch_one.
+	 */
+	row_batch fetch_batch(std::size_t count, error_code& err, error_info& info);
+
+	/// Fetches at most count rows into a row_batch (sync with exceptions version).
+	row_batch fetch_batch(std::size_t count);
+
+	/**
+	 * \brief Fetches a single row, deferring value decoding (sync with error code version).
+	 * \details Behaves like fetch_one, but values are decoded the first
+	 * time they are accessed (\see lazy_row). Prefer it to fetch_one
+	 * when you only use a few of the fields of each row.
+	 *
+	 * The returned row has the same validity rules as the one returned
+	 * by fetch_one: destroying or moving the resultset, or calling any of the
+	 * fetch methods again, invalidates it.
+	 */
+	const lazy_row* fetch_one_lazy(error_code& err, error_info& info);
+
+	/// Fetches a single row, deferring value decoding (sync with exceptions version).
+	const lazy_row* fetch_one_lazy();
+
+	/**
+	 * \brief Fetches at most max_rows rows into a column_batch (sync with error code version).
+	 * \details Behaves like fetch_batch, but values are decoded straight into
+	 * a typed array per field (\see column_batch), without creating
+	 * any mysql::value. Fields excluded by the projection (\see set_projection)
+	 * are reported as NULL. The returned batch is valid as long as it
+	 * is alive, even if the resultset is destroyed.
+	 *
+	 * Calling this function invalidates any row returned by fetch_one.
+	 */
+	column_batch fetch_columnar(std::size_t max_rows, error_code& err, error_info& info);
+
+	/// Fetches at most max_rows rows into a column_batch (sync with exceptions version).
+	column_batch fetch_columnar(std::size_t max_rows);
+
+	/**
+	 * \brief Fetches a single row into a std::tuple or aggregate (sync with error code version).
+	 * \details Values are decoded straight from the message into RowType's
+	 * elements or members, in field order, without creating any mysql::value.
+	 * Supported element types are integers, float, double, date, datetime, time,
+	 * std::string, std::string_view and std::optional's of them. std::optional
+	 * elements are required for fields that may be NULL or are excluded by the
+	 * projection (\see set_projection); otherwise, a NULL value yields
+	 * errc::unexpected_null.
+	 *
+	 * The first time a RowType is used, the resultset metadata is checked
+	 * against it, before reading any row: if the number of fields differs, or
+	 * a field can not be represented by the corresponding element type without
+	 * losing information, errc::row_type_mismatch is returned and info
+	 * describes the offending field.
+	 *
+	 * The returned object is empty if there are no more rows to be read.
+	 * std::string_view elements point into memory owned by the resultset,
+	 * and are invalidated as the row returned by fetch_one is.
+	 */
+	template <typename RowType>
+	std::optional<RowType> fetch_one_as(error_code& err, error_info& info);
+
+	/// Fetches a single row into a std::tuple or aggregate (sync with exceptions version).
+	template <typename RowType>
+	std::optional<RowType> fetch_one_as();
+
+	/**
+	 * \brief Fetches at most count rows into std::tuple's or aggregates (sync with error code version).
+	 * \details Behaves like fetch_one_as. As returned rows outlive the resultset's
+	 * internal buffer, RowType may not have std::string_view elements.
+	 */
+	template <typename RowType>
+	std::vector<RowType> fetch_many_as(std::size_t count, error_code& err, error_info& info);
+
+	/// Fetches at most count rows into std::tuple's or aggregates (sync with exceptions version).
+	template <typename RowType>
+	std::vector<RowType> fetch_many_as(std::size_t count);
 
 	/// Handler signature for fetch_one.
 	using fetch_one_signature = void(error_code, const row*);
@@ -127,7 +322,7 @@ public:
 	async_fetch_one(CompletionToken&& token, error_info* info=nullptr);
 
 	/// Handler signature for fetch_many.
-	using fetch_many_signature = void(error_code, std::vector<owning_row>);
+	using fetch_many_signature = void(error_code, detail::pmr_vector<owning_row>);
 
 	/// Fetches at most count rows (async version).
 	template <typename CompletionToken>
@@ -135,13 +330,79 @@ public:
 	async_fetch_many(std::size_t count, CompletionToken&& token, error_info* info=nullptr);
 
 	/// Handler signature for fetch_all.
-	using fetch_all_signature = void(error_code, std::vector<owning_row>);
+	using fetch_all_signature = void(error_code, detail::pmr_vector<owning_row>);
 
 	/// Fetches all available rows (async version).
 	template <typename CompletionToken>
 	BOOST_ASIO_INITFN_RESULT_TYPE(CompletionToken, fetch_all_signature)
 	async_fetch_all(CompletionToken&& token, error_info* info=nullptr);
 
+	/// Handler signature for fetch_many and fetch_all into a caller-supplied vector.
+	using fetch_into_signature = void(error_code);
+
+	/**
+	 * \brief Fetches at most count rows into output, reusing its memory (async version).
+	 * \details output must be kept alive until the operation completes.
+	 */
+	template <typename CompletionToken>
+	BOOST_ASIO_INITFN_RESULT_TYPE(CompletionToken, fetch_into_signature)
+	async_fetch_many(
+		std::size_t count,
+		std::vector<owning_row>& output,
+		CompletionToken&& token,
+		error_info* info=nullptr
+	);
+
+	/**
+	 * \brief Fetches all available rows into output, reusing its memory (async version).
+	 * \details output must be kept alive until the operation completes.
+	 */
+	template <typename CompletionToken>
+	BOOST_ASIO_INITFN_RESULT_TYPE(CompletionToken, fetch_into_signature)
+	async_fetch_all(std::vector<owning_row>& output, CompletionToken&& token, error_info* info=nullptr);
+
+	/// Handler signature for fetch_batch.
+	using fetch_batch_signature = void(error_code, row_batch);
+
+	/// Fetches at most count rows into a row_batch (async version).
+	template <typename CompletionToken>
+	BOOST_ASIO_INITFN_RESULT_TYPE(CompletionToken, fetch_batch_signature)
+	async_fetch_batch(std::size_t count, CompletionToken&& token, error_info* info=nullptr);
+
+	/// Handler signature for fetch_one_lazy.
+	using fetch_one_lazy_signature = void(error_code, const lazy_row*);
+
+	/// Fetches a single row, deferring value decoding (async version).
+	template <typename CompletionToken>
+	BOOST_ASIO_INITFN_RESULT_TYPE(CompletionToken, fetch_one_lazy_signature)
+	async_fetch_one_lazy(CompletionToken&& token, error_info* info=nullptr);
+
+	/// Handler signature for fetch_columnar.
+	using fetch_columnar_signature = void(error_code, column_batch);
+
+	/// Fetches at most max_rows rows into a column_batch (async version).
+	template <typename CompletionToken>
+	BOOST_ASIO_INITFN_RESULT_TYPE(CompletionToken, fetch_columnar_signature)
+	async_fetch_columnar(std::size_t max_rows, CompletionToken&& token, error_info* info=nullptr);
+
+	/// Handler signature for fetch_one_as.
+	template <typename RowType>
+	using fetch_one_as_signature = void(error_code, std::optional<RowType>);
+
+	/// Fetches a single row into a std::tuple or aggregate (async version).
+	template <typename RowType, typename CompletionToken>
+	BOOST_ASIO_INITFN_RESULT_TYPE(CompletionToken, fetch_one_as_signature<RowType>)
+	async_fetch_one_as(CompletionToken&& token, error_info* info=nullptr);
+
+	/// Handler signature for fetch_many_as.
+	template <typename RowType>
+	using fetch_many_as_signature = void(error_code, std::vector<RowType>);
+
+	/// Fetches at most count rows into std::tuple's or aggregates (async version).
+	template <typename RowType, typename CompletionToken>
+	BOOST_ASIO_INITFN_RESULT_TYPE(CompletionToken, fetch_many_as_signature<RowType>)
+	async_fetch_many_as(std::size_t count, CompletionToken&& token, error_info* info=nullptr);
+
 	/**
 	 * \brief Returns whether this object represents a valid resultset.
 	 * \details Returns false for default-constructed resultsets. It is
@@ -150,6 +411,36 @@ public:
 	 */
 	bool valid() const noexcept { return channel_ != nullptr; }
 
+	/// The memory resource rows returned by the fetch functions are allocated from.
+	std::pmr::memory_resource* memory_resource() const noexcept { return resource_; }
+
+	/**
+	 * \brief Sets the memory resource to allocate rows returned by subsequent fetch calls from.
+	 * \details The resource must outlive these rows. It does not affect the
+	 * resultset's metadata, nor rows already fetched.
+	 */
+	void set_memory_resource(std::pmr::memory_resource* resource) noexcept { assert(resource); resource_ = resource; }
+
+	/**
+	 * \brief Restricts the fields decoded by subsequent fetch calls.
+	 * \details mask must either be empty or have one element per field
+	 * (\see fields). Fields whose element is false are skipped without
+	 * being decoded and reported as NULL. An empty mask (the default)
+	 * decodes all fields. Values already decoded are not affected.
+	 */
+	void set_projection(const std::vector<bool>& mask)
+	{
+		assert(mask.empty() || mask.size() == fields().size());
+		meta_.set_projection(mask);
+	}
+
+	/**
+	 * \brief The mask set by set_projection, or an empty vector if all fields are decoded.
+	 * \details Allocated from memory_resource(). Converting it to a std::vector<bool>
+	 * is deprecated, like for fields().
+	 */
+	const detail::pmr_vector<bool>& projection() const noexcept { return meta_.projection(); }
+
 	/// Returns whether the resultset has been completely read or not.
 	bool complete() const noexcept { return eof_received_; }
 
@@ -158,9 +449,25 @@ public:
 	 * \details There will be as many field_metadata objects as fields
 	 * in the SQL query, and in the same order. For SQL statements
 	 * that do not return values (like UPDATEs), it will be empty.
+	 *
+	 * The fields are stored in a std::pmr::vector allocated from memory_resource().
+	 * The result still converts to a std::vector<field_metadata>, copying the
+	 * fields, but this is deprecated.
 	 * \see field_metadata for more details.
 	 */
-	const std::vector<field_metadata>& fields() const noexcept { return meta_.fields(); }
+	const detail::pmr_vector<field_metadata>& fields() const noexcept { return meta_.fields(); }
+
+	/**
+	 * \brief Returns the position within fields() of the field called name.
+	 * \details Takes constant time, using the same index as row::operator[](std::string_view).
+	 * Names are compared case-sensitively. If several fields share the name, the first one
+	 * is returned. Returns an empty optional if there is no such field.
+	 */
+	std::optional<std::size_t> field_index(std::string_view name) const
+	{
+		std::size_t res = meta_.name_index()->find(name);
+		return res == detail::field_name_index::npos ? std::nullopt : std::optional<std::size_t>(res);
+	}
 
 	/**
 	 * \brief The number of rows affected by the SQL that generated this resultset.
@@ -193,6 +500,13 @@ public:
 /// Specialization of resultset for TCP sockets.
 using tcp_resultset = resultset<boost::asio::ip::tcp::socket>;
 
+#ifdef BOOST_ASIO_HAS_LOCAL_SOCKETS
+
+/// Specialization of resultset for UNIX sockets.
+using local_resultset = resultset<boost::asio::local::stream_protocol::socket>;
+
+#endif
+
 } // mysql
 } // boost
 
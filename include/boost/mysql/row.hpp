@@ -3,9 +3,16 @@
 
 #include "boost/mysql/detail/auxiliar/bytestring.hpp"
 #include "boost/mysql/detail/auxiliar/container_equals.hpp"
+#include "boost/mysql/detail/auxiliar/pmr_vector.hpp"
 #include "boost/mysql/value.hpp"
 #include "boost/mysql/metadata.hpp"
 #include <algorithm>
+#include <cassert>
+#include <initializer_list>
+#include <memory>
+#include <memory_resource>
+#include <stdexcept>
+#include <string_view>
 
 namespace boost {
 namespace mysql {
@@ -21,33 +28,111 @@ namespace mysql {
  * as actual type), it will point to an externally owned piece of memory.
  * Thus, the row base class is not owning; this is contrary to owning_row,
  * that actually owns the string memory of its values.
+ *
+ * Rows fetched from a resultset can also be indexed by field name, in constant
+ * time, using row::operator[] or row::at. Rows constructed by the user can't.
  */
 class row
 {
-	std::vector<value> values_;
+	detail::pmr_vector<value> values_;
+	std::shared_ptr<const detail::lazy_field_name_index> name_index_;
+
+	std::size_t find_field(std::string_view name) const
+	{
+		return name_index_ ? name_index_->find(name) : detail::field_name_index::npos;
+	}
 public:
-	/// Default and initializing constructor.
-	row(std::vector<value>&& values = {}):
-		values_(std::move(values)) {};
+	/// Default constructor.
+	row() = default;
 
-	/// Accessor for the sequence of values.
-	const std::vector<value>& values() const noexcept { return values_; }
+	/// Constructs an empty row whose values will be allocated from resource.
+	explicit row(std::pmr::memory_resource* resource): values_(resource) {};
+
+	/// Initializing constructor.
+	row(std::pmr::vector<value>&& values): values_(std::move(values)) {};
+
+	/// Initializing constructor, copying the values.
+	row(const std::vector<value>& values): values_(values.begin(), values.end()) {};
+
+	/// Initializing constructor, copying the values.
+	row(std::initializer_list<value> values): values_(values) {};
+
+	/**
+	 * \brief Accessor for the sequence of values.
+	 * \details Values are stored in a std::pmr::vector, so they can be allocated
+	 * from a resultset's memory resource. The result still converts to a
+	 * std::vector<value>, copying the values, but this is deprecated: bind it
+	 * to a const std::pmr::vector<value>& instead.
+	 */
+	const detail::pmr_vector<value>& values() const noexcept { return values_; }
 
 	/// Accessor for the sequence of values.
-	std::vector<value>& values() noexcept { return values_; }
+	detail::pmr_vector<value>& values() noexcept { return values_; }
+
+	/// Returns the i-th value. i must be less than values().size().
+	const value& operator[](std::size_t i) const noexcept { assert(i < values_.size()); return values_[i]; }
+
+	/// Returns the i-th value. Throws std::out_of_range if i is not less than values().size().
+	const value& at(std::size_t i) const { return values_.at(i); }
+
+	/**
+	 * \brief Returns the value of the field called name.
+	 * \details Lookup takes constant time: it uses an index shared by all the rows
+	 * of a resultset, built the first time any of them is looked up by name.
+	 * Names are compared case-sensitively. If several fields share the name,
+	 * the first one is returned. The field must exist.
+	 */
+	const value& operator[](std::string_view name) const
+	{
+		std::size_t i = find_field(name);
+		assert(i < values_.size());
+		return values_[i];
+	}
+
+	/// Like operator[](std::string_view), but throws std::out_of_range if there is no such field.
+	const value& at(std::string_view name) const
+	{
+		std::size_t i = find_field(name);
+		if (i >= values_.size())
+		{
+			throw std::out_of_range("row::at: no field named " + std::string(name));
+		}
+		return values_[i];
+	}
+
+	// Private, do not use.
+	void set_name_index(std::shared_ptr<const detail::lazy_field_name_index> index) noexcept
+	{
+		name_index_ = std::move(index);
+	}
+	const std::shared_ptr<const detail::lazy_field_name_index>& name_index() const noexcept { return name_index_; }
 };
 
 /**
  * \brief A row that owns a chunk of memory for its string values.
  * \detail Default constructible and movable, but not copyable.
+ * The values and the string memory are allocated from the memory resource
+ * of the resultset that returned the row (\see resultset::memory_resource),
+ * which must outlive the row. Moving an owning_row (even between rows
+ * using different memory resources) does not invalidate its string values.
  */
 class owning_row : public row
 {
-	detail::bytestring buffer_;
+	detail::resource_bytestring buffer_;
 public:
 	owning_row() = default;
-	owning_row(std::vector<value>&& values, detail::bytestring&& buffer) :
-			row(std::move(values)), buffer_(std::move(buffer)) {};
+	owning_row(
+		std::pmr::vector<value>&& values,
+		detail::resource_bytestring&& buffer,
+		std::shared_ptr<const detail::lazy_field_name_index> name_index = nullptr
+	) :
+			row(std::move(values)), buffer_(std::move(buffer))
+	{
+		set_name_index(std::move(name_index));
+	}
+	// Private, do not use. The memory string values point into.
+	detail::resource_bytestring& buffer() noexcept { return buffer_; }
+
 	owning_row(const owning_row&) = delete;
 	owning_row(owning_row&&) = default;
 	owning_row& operator=(const owning_row&) = delete;
@@ -77,23 +162,33 @@ inline std::ostream& operator<<(std::ostream& os, const row& value)
 	return os << '}';
 }
 
-// Allow comparisons between vectors of rows and owning rows
+// Allow comparisons between vectors of rows and owning rows, like the ones returned by fetch_all
 template <
 	typename RowTypeLeft,
+	typename AllocatorLeft,
 	typename RowTypeRight,
+	typename AllocatorRight,
 	typename=std::enable_if_t<std::is_base_of_v<row, RowTypeLeft> && std::is_base_of_v<row, RowTypeRight>>
 >
-inline bool operator==(const std::vector<RowTypeLeft>& lhs, const std::vector<RowTypeRight>& rhs)
+inline bool operator==(
+	const std::vector<RowTypeLeft, AllocatorLeft>& lhs,
+	const std::vector<RowTypeRight, AllocatorRight>& rhs
+)
 {
 	return detail::container_equals(lhs, rhs);
 }
 
 template <
 	typename RowTypeLeft,
+	typename AllocatorLeft,
 	typename RowTypeRight,
+	typename AllocatorRight,
 	typename=std::enable_if_t<std::is_base_of_v<row, RowTypeLeft> && std::is_base_of_v<row, RowTypeRight>>
 >
-inline bool operator!=(const std::vector<RowTypeLeft>& lhs, const std::vector<RowTypeRight>& rhs)
+inline bool operator!=(
+	const std::vector<RowTypeLeft, AllocatorLeft>& lhs,
+	const std::vector<RowTypeRight, AllocatorRight>& rhs
+)
 {
 	return !(lhs == rhs);
 }
@@ -0,0 +1,140 @@
+#ifndef INCLUDE_BOOST_MYSQL_ROW_BATCH_HPP_
+#define INCLUDE_BOOST_MYSQL_ROW_BATCH_HPP_
+
+#include "boost/mysql/detail/auxiliar/bytestring.hpp"
+#include "boost/mysql/value.hpp"
+#include "boost/mysql/row.hpp"
+#include <boost/asio/buffer.hpp>
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+#include <memory_resource>
+#include <vector>
+
+namespace boost {
+namespace mysql {
+
+/**
+ * \brief A set of rows that share their memory.
+ * \details Returned by resultset::fetch_batch. Instead of allocating
+ * a buffer and a vector of mysql::value per row (as owning_row does),
+ * a row_batch stores the raw packets of all its rows in a few
+ * big contiguous chunks of memory, and the values of all its rows
+ * in a single flat array. Any string value points into
+ * one of these chunks, so it remains valid as long as the row_batch is alive.
+ *
+ * All rows in a batch have the same number of values, num_fields().
+ * You can access individual rows using operator[], which returns a
+ * lightweight row_batch::row_view, or iterate over all values using values().
+ *
+ * Row batches are default constructible and movable, but not copyable.
+ * Moving a row_batch does not invalidate the string values it contains.
+ *
+ * Values and chunks are allocated from the memory resource of the resultset
+ * that returned the batch (\see resultset::memory_resource), which must
+ * outlive the batch.
+ */
+class row_batch
+{
+public:
+	/**
+	 * \brief A non-owning reference to a row within a row_batch.
+	 * \details Valid as long as the parent row_batch is alive and not modified.
+	 */
+	class row_view
+	{
+		const value* first_;
+		std::size_t size_;
+	public:
+		row_view(const value* first, std::size_t size) noexcept: first_(first), size_(size) {}
+		const value* begin() const noexcept { return first_; }
+		const value* end() const noexcept { return first_ + size_; }
+		std::size_t size() const noexcept { return size_; }
+		const value& operator[](std::size_t i) const noexcept { assert(i < size_); return first_[i]; }
+
+		/// Creates a (non-owning) row with a copy of the values.
+		row to_row() const { return row(std::pmr::vector<value>(begin(), end())); }
+	};
+
+	/// Size of each of the chunks storing the raw packets, unless a packet is bigger.
+	static constexpr std::size_t default_chunk_size = 64 * 1024;
+
+	/// Default constructor.
+	row_batch() = default;
+
+	// Private, do not use.
+	row_batch(
+		std::size_t num_fields,
+		std::pmr::memory_resource* resource = std::pmr::get_default_resource()
+	) noexcept:
+		chunks_(resource), values_(resource), num_fields_(num_fields) {}
+
+	row_batch(const row_batch&) = delete;
+	row_batch(row_batch&&) = default;
+	row_batch& operator=(const row_batch&) = delete;
+	row_batch& operator=(row_batch&&) = default;
+	~row_batch() = default;
+
+	/// The number of rows in the batch.
+	std::size_t size() const noexcept { return num_rows_; }
+
+	/// Returns true if the batch contains no rows.
+	bool empty() const noexcept { return num_rows_ == 0; }
+
+	/// The number of values in each row.
+	std::size_t num_fields() const noexcept { return num_fields_; }
+
+	/// Accesses the i-th row in the batch.
+	row_view operator[](std::size_t i) const noexcept
+	{
+		assert(i < num_rows_);
+		return row_view(values_.data() + i * num_fields_, num_fields_);
+	}
+
+	/// The values of all rows, one row after the other.
+	const std::pmr::vector<value>& values() const noexcept { return values_; }
+
+	/// The memory resource used to allocate the batch's memory.
+	std::pmr::memory_resource* memory_resource() const noexcept { return values_.get_allocator().resource(); }
+
+	// Private, do not use. Extends the packet being read by size bytes,
+	// at the free tail of the current chunk. Returns a pointer to these bytes.
+	std::uint8_t* grow_packet(std::size_t size);
+
+	// Private, do not use. The packet being read.
+	boost::asio::const_buffer pending_packet() const noexcept;
+
+	// Private, do not use. Removes the packet being read.
+	void discard_packet() noexcept;
+
+	// Private, do not use. Adds a row whose values point into the packet being read,
+	// which becomes part of the batch.
+	void append_row(const std::pmr::vector<value>& row_values);
+
+	// Private, do not use. Lets channel::read place the packet being read straight
+	// into the batch's chunks, by exposing it with the members of a bytestring.
+	class packet_buffer
+	{
+		row_batch& batch_;
+	public:
+		explicit packet_buffer(row_batch& batch) noexcept: batch_(batch) {}
+		std::uint8_t* data() noexcept;
+		std::size_t size() const noexcept { return batch_.pending_size_; }
+		std::size_t capacity() const noexcept;
+		void clear() noexcept { batch_.discard_packet(); }
+		void resize(std::size_t size);
+	};
+private:
+	std::pmr::vector<detail::resource_bytestring> chunks_;
+	std::pmr::vector<value> values_;
+	std::size_t num_fields_ {0};
+	std::size_t num_rows_ {0};
+	std::size_t pending_size_ {0}; // size of the packet being read, at the end of the last chunk
+};
+
+} // mysql
+} // boost
+
+#include "boost/mysql/impl/row_batch.hpp"
+
+#endif /* INCLUDE_BOOST_MYSQL_ROW_BATCH_HPP_ */
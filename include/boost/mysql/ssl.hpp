@@ -0,0 +1,65 @@
+#ifndef INCLUDE_BOOST_MYSQL_SSL_HPP_
+#define INCLUDE_BOOST_MYSQL_SSL_HPP_
+
+#include <openssl/ssl.h>
+#include <memory>
+#include <mutex>
+
+namespace boost {
+namespace mysql {
+
+/**
+ * \brief Whether to use TLS for a connection.
+ * \details Only relevant for connections over boost::asio::ssl::stream.
+ * For any other stream type, TLS is never used and this setting is ignored.
+ * The TLS upgrade happens in-band, during the MySQL handshake, so the stream
+ * should be connected but the TLS handshake should not have been performed.
+ */
+enum class ssl_mode
+{
+	disable, ///< Never use TLS.
+	enable,  ///< Use TLS if the server supports it; use an unencrypted connection otherwise.
+	require  ///< Always use TLS. The handshake fails if the server does not support it.
+};
+
+/**
+ * \brief Stores a TLS session, so that subsequent connections can resume it.
+ * \details Resuming a session (via session tickets or session IDs) makes the TLS
+ * handshake skip the certificate exchange and key agreement, which makes reconnecting
+ * considerably cheaper. Share an instance among all the connections to the same server
+ * (\see connection_params::ssl_sessions). It is safe to use from several threads.
+ */
+class ssl_session_cache
+{
+	struct session_deleter
+	{
+		void operator()(SSL_SESSION* session) const noexcept { SSL_SESSION_free(session); }
+	};
+
+	mutable std::mutex mtx_;
+	std::unique_ptr<SSL_SESSION, session_deleter> session_;
+public:
+	/// Constructs an empty cache.
+	ssl_session_cache() = default;
+	ssl_session_cache(const ssl_session_cache&) = delete;
+	ssl_session_cache& operator=(const ssl_session_cache&) = delete;
+
+	/// Returns true if there is no session to resume.
+	bool empty() const;
+
+	/// Discards the stored session, if any.
+	void clear();
+
+	/// Makes ssl attempt to resume the stored session, if any. Called before the TLS handshake.
+	void load(SSL* ssl) const;
+
+	/// Stores the session negotiated by ssl, if it can be resumed. Called after the handshake.
+	void store(SSL* ssl);
+};
+
+} // mysql
+} // boost
+
+#include "boost/mysql/impl/ssl.hpp"
+
+#endif /* INCLUDE_BOOST_MYSQL_SSL_HPP_ */
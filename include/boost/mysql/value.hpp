@@ -9,6 +9,7 @@
 #include <ostream>
 #include <array>
 #include <vector>
+#include <memory_resource>
 
 namespace boost {
 namespace mysql {
@@ -55,6 +56,12 @@ inline bool operator!=(const value& lhs, const value& rhs) { return !(lhs == rhs
 
 inline bool operator==(const std::vector<value>& lhs, const std::vector<value>& rhs);
 inline bool operator!=(const std::vector<value>& lhs, const std::vector<value>& rhs) { return !(lhs == rhs); }
+inline bool operator==(const std::pmr::vector<value>& lhs, const std::pmr::vector<value>& rhs);
+inline bool operator!=(const std::pmr::vector<value>& lhs, const std::pmr::vector<value>& rhs) { return !(lhs == rhs); }
+inline bool operator==(const std::pmr::vector<value>& lhs, const std::vector<value>& rhs);
+inline bool operator!=(const std::pmr::vector<value>& lhs, const std::vector<value>& rhs) { return !(lhs == rhs); }
+inline bool operator==(const std::vector<value>& lhs, const std::pmr::vector<value>& rhs) { return rhs == lhs; }
+inline bool operator!=(const std::vector<value>& lhs, const std::pmr::vector<value>& rhs) { return !(lhs == rhs); }
 
 /// Streams a value.
 inline std::ostream& operator<<(std::ostream& os, const value& value);
@@ -4,10 +4,12 @@
 #include "boost/mysql/value.hpp"
 #include "boost/mysql/row.hpp"
 #include "boost/mysql/error.hpp"
+#include "boost/mysql/metadata.hpp"
 #include <boost/asio/buffer.hpp>
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 #include <vector>
+#include <memory_resource>
 #include <algorithm>
 #include <sstream>
 #include <type_traits>
@@ -26,7 +28,8 @@ std::vector<value> makevalues(Types&&... args)
 template <typename... Types>
 row makerow(Types&&... args)
 {
-	return row(makevalues(std::forward<Types>(args)...));
+	auto values = makevalues(std::forward<Types>(args)...);
+	return row(std::pmr::vector<value>(values.begin(), values.end()));
 }
 
 template <typename... Types>
@@ -37,7 +40,7 @@ std::vector<row> makerows(std::size_t row_size, Types&&... args)
 	std::vector<row> res;
 	for (std::size_t i = 0; i < values.size(); i += row_size)
 	{
-		std::vector<value> row_values (values.begin() + i, values.begin() + i + row_size);
+		std::pmr::vector<value> row_values (values.begin() + i, values.begin() + i + row_size);
 		res.push_back(row(std::move(row_values)));
 	}
 	return res;
@@ -61,6 +64,22 @@ inline mysql::time maket(int hours, int mins, int secs, int micros=0)
 	     + std::chrono::seconds(secs) + std::chrono::microseconds(micros);
 }
 
+// name is not copied, so it must outlive the returned field (e.g. a literal)
+inline field_metadata makefield(
+	detail::protocol_field_type type,
+	std::uint16_t flags = 0,
+	unsigned decimals = 0,
+	std::string_view name = ""
+)
+{
+	detail::column_definition_packet coldef;
+	coldef.type = type;
+	coldef.flags.value = flags;
+	coldef.decimals.value = static_cast<std::uint8_t>(decimals);
+	coldef.name.value = name;
+	return field_metadata(coldef);
+}
+
 template <std::size_t N>
 inline std::string_view makesv(const char (&value) [N])
 {
@@ -140,6 +159,27 @@ inline std::vector<std::uint8_t> concat_copy(
 	return std::move(lhs);
 }
 
+// Forwards to the default resource, counting outstanding allocations
+class counting_resource : public std::pmr::memory_resource
+{
+	void* do_allocate(std::size_t bytes, std::size_t alignment) override
+	{
+		++allocations;
+		return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+	}
+	void do_deallocate(void* p, std::size_t bytes, std::size_t alignment) override
+	{
+		--allocations;
+		std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+	}
+	bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override
+	{
+		return this == &other;
+	}
+public:
+	int allocations {0};
+};
+
 struct named_param {};
 
 template <typename T, typename=std::enable_if_t<std::is_base_of_v<named_param, T>>>
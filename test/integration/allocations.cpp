@@ -0,0 +1,177 @@
+/*
+ * allocations.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: ruben
+ */
+
+#include "boost/mysql/connection.hpp"
+#include "integration_test_common.hpp"
+#include <cstdlib>
+#include <memory_resource>
+#include <new>
+
+using boost::mysql::error_code;
+
+namespace
+{
+
+// Allocations are only counted in the thread running the operations under test
+thread_local bool counting_allocations = false;
+thread_local std::size_t allocation_count = 0;
+
+void* counted_allocate(std::size_t size, std::size_t alignment)
+{
+	if (counting_allocations)
+	{
+		++allocation_count;
+	}
+	size = (size + alignment - 1) / alignment * alignment; // aligned_alloc requires a multiple
+	void* res = std::aligned_alloc(alignment, size ? size : alignment);
+	if (!res)
+	{
+		throw std::bad_alloc();
+	}
+	return res;
+}
+
+} // anon namespace
+
+void* operator new(std::size_t size) { return counted_allocate(size, alignof(std::max_align_t)); }
+void* operator new(std::size_t size, std::align_val_t al) { return counted_allocate(size, static_cast<std::size_t>(al)); }
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+void operator delete(void* p, std::align_val_t) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t, std::align_val_t) noexcept { std::free(p); }
+
+namespace
+{
+
+// The default type-erased executor allocates when dispatching completions
+// (see the connection docs), so use the io_context executor directly
+using socket_type = boost::asio::basic_stream_socket<
+	boost::asio::ip::tcp,
+	boost::asio::io_context::executor_type
+>;
+using connection_type = boost::mysql::connection<socket_type>;
+using resultset_type = boost::mysql::resultset<socket_type>;
+using statement_type = boost::mysql::prepared_statement<socket_type>;
+using boost::mysql::row;
+
+constexpr std::size_t warmup_iterations = 10;
+
+// Reuses the fixture's endpoint and credentials, but runs its own connection
+// in the test thread, where allocations are counted
+struct AllocationsTest : boost::mysql::test::IntegTest
+{
+	std::pmr::unsynchronized_pool_resource pool; // resultsets own their buffers
+	boost::asio::io_context alloc_ctx;
+	connection_type alloc_conn {alloc_ctx};
+	std::size_t remaining {2 * warmup_iterations};
+	error_code err;
+
+	AllocationsTest()
+	{
+		alloc_conn.set_memory_resource(&pool);
+		alloc_conn.next_layer().connect(endpoint);
+		alloc_conn.handshake(connection_params);
+	}
+
+	// Returns false once all iterations have been performed or on error.
+	// Starts counting allocations after the warm-up iterations
+	bool next_iteration(error_code code)
+	{
+		if (code)
+		{
+			err = code;
+			counting_allocations = false;
+			return false;
+		}
+		if (remaining == 0)
+		{
+			counting_allocations = false;
+			return false;
+		}
+		if (--remaining == warmup_iterations)
+		{
+			counting_allocations = true;
+		}
+		return true;
+	}
+
+	void run()
+	{
+		allocation_count = 0;
+		alloc_ctx.run();
+		EXPECT_EQ(err, error_code());
+		EXPECT_EQ(remaining, 0);
+		EXPECT_EQ(allocation_count, 0);
+	}
+};
+
+// Issues queries returning no rows, one after another
+struct query_chain
+{
+	AllocationsTest* test;
+
+	void operator()(error_code code, resultset_type)
+	{
+		if (test->next_iteration(code))
+		{
+			test->alloc_conn.async_query("DO 1", *this);
+		}
+	}
+};
+
+TEST_F(AllocationsTest, AsyncQuery_SteadyState_DoesNotAllocate)
+{
+	alloc_conn.async_query("DO 1", query_chain{this});
+	run();
+}
+
+// Executes a statement and fetches all of its rows, one execution after another
+struct execute_chain
+{
+	AllocationsTest* test;
+	statement_type* stmt;
+	resultset_type* result;
+	std::size_t* num_rows;
+
+	// Statement executed
+	void operator()(error_code code, resultset_type res)
+	{
+		if (code)
+		{
+			test->next_iteration(code);
+			return;
+		}
+		*result = std::move(res);
+		result->async_fetch_one(*this);
+	}
+
+	// Row fetched
+	void operator()(error_code code, const row* r)
+	{
+		if (!code && r)
+		{
+			++*num_rows;
+			result->async_fetch_one(*this);
+		}
+		else if (test->next_iteration(code))
+		{
+			stmt->async_execute(boost::mysql::no_statement_params, *this);
+		}
+	}
+};
+
+TEST_F(AllocationsTest, AsyncExecuteAndFetch_SteadyState_DoesNotAllocate)
+{
+	auto stmt = alloc_conn.prepare_statement("SELECT * FROM two_rows_table");
+	resultset_type result;
+	std::size_t num_rows = 0;
+	stmt.async_execute(boost::mysql::no_statement_params, execute_chain{this, &stmt, &result, &num_rows});
+	run();
+	EXPECT_EQ(num_rows, 2 * (2 * warmup_iterations + 1));
+}
+
+} // anon namespace
@@ -0,0 +1,101 @@
+/*
+ * compression.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: ruben
+ */
+
+#include "boost/mysql/connection.hpp"
+#include "integration_test_common.hpp"
+#include "test_common.hpp"
+
+using namespace boost::mysql::test;
+using boost::mysql::compression_algorithm;
+using boost::mysql::tcp_pipeline;
+
+namespace
+{
+
+// 3^7 = 2187 rows of about 60 bytes each, much more than the server's
+// net_buffer_length (16KB by default). The server flushes a frame each time
+// its buffer fills up, so the resultset spans many frames, and packet
+// sequence numbers are resynced to frame ones after each flush.
+constexpr std::size_t num_rows = 2187;
+constexpr const char* many_rows_query =
+	"SELECT t1.id, REPEAT('a', 50) FROM three_rows_table t1, three_rows_table t2, "
+	"three_rows_table t3, three_rows_table t4, three_rows_table t5, three_rows_table t6, "
+	"three_rows_table t7";
+
+struct CompressionTest : public NetworkTest<IntegTest>
+{
+	CompressionTest()
+	{
+		connection_params.compression = compression_algorithm::zlib;
+		handshake();
+	}
+
+	void validate_many_rows(const std::pmr::vector<boost::mysql::owning_row>& rows)
+	{
+		ASSERT_EQ(rows.size(), num_rows);
+		for (const auto& r: rows)
+		{
+			ASSERT_EQ(r.values().size(), 2);
+			EXPECT_EQ(r.values()[1], boost::mysql::value(std::string(50, 'a')));
+		}
+	}
+};
+
+TEST_P(CompressionTest, ResultsetBiggerThanNetBufferLength_AllRowsRead)
+{
+	auto* net = GetParam();
+	auto bigger_than_buffer = conn.query("SELECT @@net_buffer_length < 2187 * 50").fetch_all();
+	ASSERT_EQ(bigger_than_buffer.at(0).values(), makerow(1).values());
+
+	auto result = net->query(conn, many_rows_query);
+	result.validate_no_error();
+	auto rows = net->fetch_all(result.value);
+	rows.validate_no_error();
+	validate_many_rows(rows.value);
+
+	// Sequence numbers are still in sync for subsequent commands
+	result = net->query(conn, "SELECT 42");
+	result.validate_no_error();
+	EXPECT_EQ(result.value.fetch_all().at(0).values(), makerow(42).values());
+}
+
+TEST_P(CompressionTest, StatementResultsetBiggerThanNetBufferLength_AllRowsRead)
+{
+	auto* net = GetParam();
+	auto stmt = conn.prepare_statement(many_rows_query);
+	auto result = net->execute_statement(stmt, makevalues());
+	result.validate_no_error();
+	auto rows = net->fetch_all(result.value);
+	rows.validate_no_error();
+	validate_many_rows(rows.value);
+}
+
+TEST_P(CompressionTest, PipelineBiggerThanNetBufferLength_AllResultsetsRead)
+{
+	auto* net = GetParam();
+	tcp_pipeline pipe = conn.make_pipeline();
+	pipe.add_query(many_rows_query)
+		.add_query("SELECT 42")
+		.add_query(many_rows_query);
+	net->write_pipeline(pipe).validate_no_error();
+
+	auto result = net->read_next(pipe);
+	result.validate_no_error();
+	validate_many_rows(result.value.fetch_all());
+
+	result = net->read_next(pipe);
+	result.validate_no_error();
+	EXPECT_EQ(result.value.fetch_all().at(0).values(), makerow(42).values());
+
+	result = net->read_next(pipe);
+	result.validate_no_error();
+	validate_many_rows(result.value.fetch_all());
+}
+
+MYSQL_NETWORK_TEST_SUITE(CompressionTest);
+
+} // anon namespace
@@ -113,4 +113,72 @@ TEST_F(ExecuteStatementOtherContainersTest, CArray)
 	EXPECT_TRUE(result.valid());
 }
 
+TEST_F(ExecuteStatementOtherContainersTest, RepeatedExecutions_ShareMetadata)
+{
+	auto stmt = conn.prepare_statement("SELECT * FROM two_rows_table WHERE id = ?");
+	auto result1 = stmt.execute(makevalues(1));
+	result1.fetch_all();
+	auto result2 = stmt.execute(makevalues(2));
+	auto rows = result2.fetch_all();
+	EXPECT_EQ(&result1.fields(), &result2.fields());
+	ASSERT_EQ(result2.fields().size(), 2);
+	EXPECT_EQ(result2.fields()[1].field_name(), "field_varchar");
+	EXPECT_EQ(rows, makerows(2, 2, "f1"));
+}
+
+// Optional resultset metadata
+struct ExecuteStatementOptionalMetadataTest : IntegTestAfterHandshake {};
+
+TEST_F(ExecuteStatementOptionalMetadataTest, MetadataNone_UsesCachedMetadata)
+{
+	if (!conn.supports_optional_metadata())
+	{
+		GTEST_SKIP() << "Server does not support optional resultset metadata";
+	}
+	auto stmt = conn.prepare_statement("SELECT * FROM two_rows_table WHERE id = ?");
+	conn.query("SET resultset_metadata = 'NONE'");
+	auto result = stmt.execute(makevalues(2));
+	ASSERT_EQ(result.fields().size(), 2);
+	EXPECT_EQ(result.fields()[0].field_name(), "id");
+	EXPECT_EQ(result.fields()[1].field_name(), "field_varchar");
+	auto rows = result.fetch_all();
+	EXPECT_EQ(rows, makerows(2, 2, "f1"));
+}
+
+TEST_F(ExecuteStatementOptionalMetadataTest, MetadataNone_StatementPreparedAfterwards_ReturnsMissingMetadata)
+{
+	if (!conn.supports_optional_metadata())
+	{
+		GTEST_SKIP() << "Server does not support optional resultset metadata";
+	}
+	conn.query("SET resultset_metadata = 'NONE'");
+	auto stmt = conn.prepare_statement("SELECT * FROM two_rows_table WHERE id = ?");
+	error_code err;
+	error_info info;
+	auto result = stmt.execute(makevalues(2), err, info);
+	EXPECT_EQ(err, boost::mysql::detail::make_error_code(errc::missing_metadata));
+
+	// The rows were discarded, so the connection is still usable
+	conn.query("SET resultset_metadata = 'FULL'");
+	auto rows = conn.query("SELECT * FROM two_rows_table").fetch_all();
+	EXPECT_EQ(rows, makerows(2, 1, "f0", 2, "f1"));
+}
+
+TEST_F(ExecuteStatementOptionalMetadataTest, MetadataNone_TextQuery_ReturnsMissingMetadataAndConnectionRemainsUsable)
+{
+	if (!conn.supports_optional_metadata())
+	{
+		GTEST_SKIP() << "Server does not support optional resultset metadata";
+	}
+	conn.query("SET resultset_metadata = 'NONE'");
+	error_code err;
+	error_info info;
+	auto result = conn.query("SELECT * FROM two_rows_table", err, info);
+	EXPECT_EQ(err, boost::mysql::detail::make_error_code(errc::missing_metadata));
+
+	conn.query("SET resultset_metadata = 'FULL'");
+	auto rows = conn.query("SELECT * FROM two_rows_table").fetch_all();
+	EXPECT_EQ(rows, makerows(2, 1, "f0", 2, "f1"));
+}
+
 }
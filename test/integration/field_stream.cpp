@@ -0,0 +1,132 @@
+/*
+ * field_stream.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: ruben
+ */
+
+#include "boost/mysql/field_stream.hpp"
+#include "integration_test_common.hpp"
+#include "test_common.hpp"
+#include <boost/asio/read.hpp>
+#include <boost/asio/use_future.hpp>
+
+using namespace boost::mysql::test;
+using boost::mysql::error_code;
+using boost::mysql::tcp_field_stream;
+namespace net = boost::asio;
+
+namespace
+{
+
+// Bigger than a protocol frame, so the value spans several of them
+constexpr std::size_t big_size = 17 * 1024 * 1024;
+
+struct FieldStreamTest : IntegTestAfterHandshake
+{
+	// Reads the current value in chunks, verifying all of its bytes are fill
+	std::size_t read_value_sync(tcp_field_stream& stream, char fill)
+	{
+		std::vector<char> chunk (64 * 1024);
+		std::size_t total = 0;
+		error_code err;
+		while (true)
+		{
+			std::size_t size = stream.read_some(net::buffer(chunk), err);
+			if (err == net::error::eof) break;
+			EXPECT_EQ(err, error_code());
+			if (err) break;
+			EXPECT_EQ(std::count(chunk.begin(), chunk.begin() + size, fill), size);
+			total += size;
+		}
+		return total;
+	}
+
+	std::size_t read_value_async(tcp_field_stream& stream, char fill)
+	{
+		std::vector<char> chunk (64 * 1024);
+		std::size_t total = 0;
+		while (true)
+		{
+			std::size_t size = 0;
+			try
+			{
+				size = stream.async_read_some(net::buffer(chunk), net::use_future).get();
+			}
+			catch (const boost::system::system_error& err)
+			{
+				EXPECT_EQ(err.code(), net::error::eof);
+				break;
+			}
+			EXPECT_EQ(std::count(chunk.begin(), chunk.begin() + size, fill), size);
+			total += size;
+		}
+		return total;
+	}
+};
+
+TEST_F(FieldStreamTest, TextProtocol_BigValue_StreamsValueAndRestOfRow)
+{
+	auto result = conn.query("SELECT 42, REPEAT('a', " + std::to_string(big_size) + "), 'tail'");
+	tcp_field_stream stream (result, 1);
+	ASSERT_TRUE(stream.next_row());
+	EXPECT_FALSE(stream.is_null());
+	EXPECT_EQ(stream.size(), big_size);
+	EXPECT_EQ(read_value_sync(stream, 'a'), big_size);
+	EXPECT_EQ(stream.remaining(), 0);
+	EXPECT_EQ(stream.current_row().values(), makerow(std::int64_t(42), "", "tail").values());
+	EXPECT_FALSE(stream.next_row());
+	EXPECT_TRUE(result.complete());
+}
+
+TEST_F(FieldStreamTest, BinaryProtocol_BigValue_StreamsValueAndRestOfRow)
+{
+	auto stmt = conn.prepare_statement("SELECT ?, REPEAT('b', ?), 'tail'");
+	auto result = stmt.execute(makevalues(std::int64_t(42), std::int64_t(big_size)));
+	tcp_field_stream stream (result, 1);
+	ASSERT_TRUE(stream.next_row());
+	EXPECT_EQ(stream.size(), big_size);
+	EXPECT_EQ(read_value_sync(stream, 'b'), big_size);
+	EXPECT_EQ(stream.current_row().values().at(2), boost::mysql::value("tail"));
+	EXPECT_FALSE(stream.next_row());
+	EXPECT_TRUE(result.complete());
+}
+
+TEST_F(FieldStreamTest, Async_SeveralRows_SkipsUnreadValues)
+{
+	auto result = conn.query(
+		"SELECT id, REPEAT('c', id * 100000) FROM "
+		"(SELECT 1 AS id UNION ALL SELECT 2 UNION ALL SELECT 3) AS t"
+	);
+	tcp_field_stream stream (result, 1);
+
+	ASSERT_TRUE(stream.async_next_row(net::use_future).get());
+	EXPECT_EQ(read_value_async(stream, 'c'), 100000);
+	EXPECT_EQ(stream.current_row().values().at(0), boost::mysql::value(std::int64_t(1)));
+
+	// Leave the second value half-read
+	ASSERT_TRUE(stream.async_next_row(net::use_future).get());
+	std::vector<char> chunk (1000);
+	net::async_read(stream, net::buffer(chunk), net::use_future).get();
+	EXPECT_EQ(stream.remaining(), 200000 - 1000);
+
+	ASSERT_TRUE(stream.async_next_row(net::use_future).get());
+	EXPECT_EQ(read_value_async(stream, 'c'), 300000);
+	EXPECT_EQ(stream.current_row().values().at(0), boost::mysql::value(std::int64_t(3)));
+	EXPECT_FALSE(stream.async_next_row(net::use_future).get());
+	EXPECT_TRUE(result.complete());
+	EXPECT_EQ(conn.query("SELECT 1").fetch_all().at(0).values(), makerow(std::int64_t(1)).values());
+}
+
+TEST_F(FieldStreamTest, NullValue_ReadsEof)
+{
+	auto result = conn.query("SELECT CAST(NULL AS CHAR), 'tail'");
+	tcp_field_stream stream (result, 0);
+	ASSERT_TRUE(stream.next_row());
+	EXPECT_TRUE(stream.is_null());
+	EXPECT_EQ(read_value_sync(stream, 'a'), 0);
+	EXPECT_EQ(stream.current_row().values(), makerow(nullptr, "tail").values());
+	EXPECT_FALSE(stream.next_row());
+}
+
+} // anon namespace
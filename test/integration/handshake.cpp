@@ -18,6 +18,7 @@ using boost::mysql::detail::make_error_code;
 using boost::mysql::error_info;
 using boost::mysql::errc;
 using boost::mysql::error_code;
+using boost::mysql::compression_algorithm;
 
 namespace
 {
@@ -71,6 +72,38 @@ TEST_P(HandshakeTest, FastAuthBadDatabase)
 	result.validate_error(errc::dbaccess_denied_error, {"database", "bad_database"});
 }
 
+TEST_P(HandshakeTest, CompressionZlib_QueriesAndBigResultsetsWork)
+{
+	connection_params.compression = compression_algorithm::zlib;
+	connection_params.compression_threshold = 0;
+	auto result = do_handshake();
+	result.validate_no_error();
+
+	auto* net = GetParam();
+	auto query_result = net->query(conn, "SELECT REPEAT('abc', 100000), 42");
+	query_result.validate_no_error();
+	auto rows = net->fetch_all(query_result.value);
+	rows.validate_no_error();
+	ASSERT_EQ(rows.value.size(), 1);
+	std::string expected;
+	for (int i = 0; i < 100000; ++i) expected += "abc";
+	EXPECT_EQ(rows.value[0].values(), makerow(std::string_view(expected), 42).values());
+
+	// Error packets are also compressed
+	query_result = net->query(conn, "SELECT * FROM bad_table");
+	query_result.validate_error(errc::no_such_table, {"table", "doesn't exist", "bad_table"});
+}
+
+TEST_P(HandshakeTest, CompressionZstd_FallsBackIfUnsupported)
+{
+	connection_params.compression = compression_algorithm::zstd;
+	auto result = do_handshake();
+	result.validate_no_error();
+	auto query_result = GetParam()->query(conn, "SELECT 1");
+	query_result.validate_no_error();
+	EXPECT_EQ(query_result.value.fetch_all().at(0).values(), makerow(1).values());
+}
+
 MYSQL_NETWORK_TEST_SUITE(HandshakeTest);
 
 } // anon namespace
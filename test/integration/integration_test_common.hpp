@@ -19,6 +19,7 @@ namespace test {
 struct IntegTest : testing::Test
 {
 	mysql::connection_params connection_params {"integ_user", "integ_password", "awesome"};
+	boost::asio::ip::tcp::endpoint endpoint {boost::asio::ip::address_v4::loopback(), 3306};
 	boost::asio::io_context ctx;
 	mysql::connection<boost::asio::ip::tcp::socket> conn {ctx};
 	boost::asio::executor_work_guard<boost::asio::io_context::executor_type> guard { ctx.get_executor() };
@@ -28,7 +29,6 @@ struct IntegTest : testing::Test
 	{
 		try
 		{
-			boost::asio::ip::tcp::endpoint endpoint (boost::asio::ip::address_v4::loopback(), 3306);
 			conn.next_layer().connect(endpoint);
 		}
 		catch (...) // prevent terminate without an active exception on connect error
@@ -69,7 +69,7 @@ struct IntegTest : testing::Test
 	}
 
 	void validate_2fields_meta(
-		const std::vector<field_metadata>& fields,
+		const std::pmr::vector<field_metadata>& fields,
 		const std::string& table
 	) const
 	{
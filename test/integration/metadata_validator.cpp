@@ -77,7 +77,7 @@ void meta_validator::validate(
 }
 
 void boost::mysql::test::validate_meta(
-	const std::vector<field_metadata>& actual,
+	const std::pmr::vector<field_metadata>& actual,
 	const std::vector<meta_validator>& expected
 )
 {
@@ -43,7 +43,7 @@ private:
 	std::vector<flag_getter> ignore_flags_;
 };
 
-void validate_meta(const std::vector<field_metadata>& actual, const std::vector<meta_validator>& expected);
+void validate_meta(const std::pmr::vector<field_metadata>& actual, const std::vector<meta_validator>& expected);
 
 } // test
 } // mysql
@@ -14,6 +14,10 @@ using boost::mysql::errc;
 using boost::mysql::value;
 using boost::mysql::row;
 using boost::mysql::owning_row;
+using boost::mysql::row_batch;
+using boost::mysql::lazy_row;
+using boost::mysql::column_batch;
+using boost::mysql::tcp_pipeline;
 using boost::asio::yield_context;
 using boost::asio::use_future;
 
@@ -106,7 +110,7 @@ public:
 			return r.fetch_one(code, info);
 		});
 	}
-	network_result<std::vector<owning_row>> fetch_many(
+	network_result<owning_rows> fetch_many(
 		tcp_resultset& r,
 		std::size_t count
 	) override
@@ -115,7 +119,7 @@ public:
 			return r.fetch_many(count, code, info);
 		});
 	}
-	network_result<std::vector<owning_row>> fetch_all(
+	network_result<owning_rows> fetch_all(
 		tcp_resultset& r
 	) override
 	{
@@ -123,6 +127,77 @@ public:
 			return r.fetch_all(code, info);
 		});
 	}
+	network_result<const lazy_row*> fetch_one_lazy(
+		tcp_resultset& r
+	) override
+	{
+		return impl([&](error_code& code, error_info& info) {
+			return r.fetch_one_lazy(code, info);
+		});
+	}
+	network_result<row_batch> fetch_batch(
+		tcp_resultset& r,
+		std::size_t count
+	) override
+	{
+		return impl([&](error_code& code, error_info& info) {
+			return r.fetch_batch(count, code, info);
+		});
+	}
+	network_result<column_batch> fetch_columnar(
+		tcp_resultset& r,
+		std::size_t max_rows
+	) override
+	{
+		return impl([&](error_code& code, error_info& info) {
+			return r.fetch_columnar(max_rows, code, info);
+		});
+	}
+	network_result<std::optional<typed_row>> fetch_one_as(
+		tcp_resultset& r
+	) override
+	{
+		return impl([&](error_code& code, error_info& info) {
+			return r.fetch_one_as<typed_row>(code, info);
+		});
+	}
+	network_result<std::vector<typed_row>> fetch_many_as(
+		tcp_resultset& r,
+		std::size_t count
+	) override
+	{
+		return impl([&](error_code& code, error_info& info) {
+			return r.fetch_many_as<typed_row>(count, code, info);
+		});
+	}
+	network_result<no_result> fetch_many_into(
+		tcp_resultset& r,
+		std::size_t count,
+		std::vector<owning_row>& output
+	) override
+	{
+		return impl([&](error_code& code, error_info& info) {
+			r.fetch_many(count, output, code, info);
+			return no_result();
+		});
+	}
+	network_result<no_result> write_pipeline(
+		tcp_pipeline& p
+	) override
+	{
+		return impl([&](error_code& code, error_info& info) {
+			p.write(code, info);
+			return no_result();
+		});
+	}
+	network_result<tcp_resultset> read_next(
+		tcp_pipeline& p
+	) override
+	{
+		return impl([&](error_code& code, error_info& info) {
+			return p.read_next(code, info);
+		});
+	}
 };
 
 class sync_exc : public network_functions
@@ -208,7 +283,7 @@ public:
 			return r.fetch_one();
 		});
 	}
-	network_result<std::vector<owning_row>> fetch_many(
+	network_result<owning_rows> fetch_many(
 		tcp_resultset& r,
 		std::size_t count
 	) override
@@ -217,7 +292,7 @@ public:
 			return r.fetch_many(count);
 		});
 	}
-	network_result<std::vector<owning_row>> fetch_all(
+	network_result<owning_rows> fetch_all(
 		tcp_resultset& r
 	) override
 	{
@@ -225,6 +300,77 @@ public:
 			return r.fetch_all();
 		});
 	}
+	network_result<const lazy_row*> fetch_one_lazy(
+		tcp_resultset& r
+	) override
+	{
+		return impl([&] {
+			return r.fetch_one_lazy();
+		});
+	}
+	network_result<row_batch> fetch_batch(
+		tcp_resultset& r,
+		std::size_t count
+	) override
+	{
+		return impl([&] {
+			return r.fetch_batch(count);
+		});
+	}
+	network_result<column_batch> fetch_columnar(
+		tcp_resultset& r,
+		std::size_t max_rows
+	) override
+	{
+		return impl([&] {
+			return r.fetch_columnar(max_rows);
+		});
+	}
+	network_result<std::optional<typed_row>> fetch_one_as(
+		tcp_resultset& r
+	) override
+	{
+		return impl([&] {
+			return r.fetch_one_as<typed_row>();
+		});
+	}
+	network_result<std::vector<typed_row>> fetch_many_as(
+		tcp_resultset& r,
+		std::size_t count
+	) override
+	{
+		return impl([&] {
+			return r.fetch_many_as<typed_row>(count);
+		});
+	}
+	network_result<no_result> fetch_many_into(
+		tcp_resultset& r,
+		std::size_t count,
+		std::vector<owning_row>& output
+	) override
+	{
+		return impl([&] {
+			r.fetch_many(count, output);
+			return no_result();
+		});
+	}
+	network_result<no_result> write_pipeline(
+		tcp_pipeline& p
+	) override
+	{
+		return impl([&] {
+			p.write();
+			return no_result();
+		});
+	}
+	network_result<tcp_resultset> read_next(
+		tcp_pipeline& p
+	) override
+	{
+		return impl([&] {
+			return p.read_next();
+		});
+	}
 };
 
 class async_callback : public network_functions
@@ -344,23 +490,92 @@ public:
 			return r.async_fetch_one(std::forward<decltype(token)>(token), info);
 		});
 	}
-	network_result<std::vector<owning_row>> fetch_many(
+	network_result<owning_rows> fetch_many(
 		tcp_resultset& r,
 		std::size_t count
 	) override
 	{
-		return impl<std::vector<owning_row>>([&](auto&& token, error_info* info) {
+		return impl<owning_rows>([&](auto&& token, error_info* info) {
 			return r.async_fetch_many(count, std::forward<decltype(token)>(token), info);
 		});
 	}
-	network_result<std::vector<owning_row>> fetch_all(
+	network_result<owning_rows> fetch_all(
 		tcp_resultset& r
 	) override
 	{
-		return impl<std::vector<owning_row>>([&](auto&& token, error_info* info) {
+		return impl<owning_rows>([&](auto&& token, error_info* info) {
 			return r.async_fetch_all(std::forward<decltype(token)>(token), info);
 		});
 	}
+	network_result<const lazy_row*> fetch_one_lazy(
+		tcp_resultset& r
+	) override
+	{
+		return impl<const lazy_row*>([&](auto&& token, error_info* info) {
+			return r.async_fetch_one_lazy(std::forward<decltype(token)>(token), info);
+		});
+	}
+	network_result<row_batch> fetch_batch(
+		tcp_resultset& r,
+		std::size_t count
+	) override
+	{
+		return impl<row_batch>([&](auto&& token, error_info* info) {
+			return r.async_fetch_batch(count, std::forward<decltype(token)>(token), info);
+		});
+	}
+	network_result<column_batch> fetch_columnar(
+		tcp_resultset& r,
+		std::size_t max_rows
+	) override
+	{
+		return impl<column_batch>([&](auto&& token, error_info* info) {
+			return r.async_fetch_columnar(max_rows, std::forward<decltype(token)>(token), info);
+		});
+	}
+	network_result<std::optional<typed_row>> fetch_one_as(
+		tcp_resultset& r
+	) override
+	{
+		return impl<std::optional<typed_row>>([&](auto&& token, error_info* info) {
+			return r.async_fetch_one_as<typed_row>(std::forward<decltype(token)>(token), info);
+		});
+	}
+	network_result<std::vector<typed_row>> fetch_many_as(
+		tcp_resultset& r,
+		std::size_t count
+	) override
+	{
+		return impl<std::vector<typed_row>>([&](auto&& token, error_info* info) {
+			return r.async_fetch_many_as<typed_row>(count, std::forward<decltype(token)>(token), info);
+		});
+	}
+	network_result<no_result> fetch_many_into(
+		tcp_resultset& r,
+		std::size_t count,
+		std::vector<owning_row>& output
+	) override
+	{
+		return impl<no_result>([&](auto&& token, error_info* info) {
+			return r.async_fetch_many(count, output, std::forward<decltype(token)>(token), info);
+		});
+	}
+	network_result<no_result> write_pipeline(
+		tcp_pipeline& p
+	) override
+	{
+		return impl<no_result>([&](auto&& token, error_info* info) {
+			return p.async_write(std::forward<decltype(token)>(token), info);
+		});
+	}
+	network_result<tcp_resultset> read_next(
+		tcp_pipeline& p
+	) override
+	{
+		return impl<tcp_resultset>([&](auto&& token, error_info* info) {
+			return p.async_read_next(std::forward<decltype(token)>(token), info);
+		});
+	}
 };
 
 class async_coroutine : public network_functions
@@ -463,7 +678,7 @@ public:
 			return r.async_fetch_one(yield, info);
 		});
 	}
-	network_result<std::vector<owning_row>> fetch_many(
+	network_result<owning_rows> fetch_many(
 		tcp_resultset& r,
 		std::size_t count
 	) override
@@ -472,7 +687,7 @@ public:
 			return r.async_fetch_many(count, yield, info);
 		});
 	}
-	network_result<std::vector<owning_row>> fetch_all(
+	network_result<owning_rows> fetch_all(
 		tcp_resultset& r
 	) override
 	{
@@ -480,6 +695,77 @@ public:
 			return r.async_fetch_all(yield, info);
 		});
 	}
+	network_result<const lazy_row*> fetch_one_lazy(
+		tcp_resultset& r
+	) override
+	{
+		return impl(r, [&](yield_context yield, error_info* info) {
+			return r.async_fetch_one_lazy(yield, info);
+		});
+	}
+	network_result<row_batch> fetch_batch(
+		tcp_resultset& r,
+		std::size_t count
+	) override
+	{
+		return impl(r, [&](yield_context yield, error_info* info) {
+			return r.async_fetch_batch(count, yield, info);
+		});
+	}
+	network_result<column_batch> fetch_columnar(
+		tcp_resultset& r,
+		std::size_t max_rows
+	) override
+	{
+		return impl(r, [&](yield_context yield, error_info* info) {
+			return r.async_fetch_columnar(max_rows, yield, info);
+		});
+	}
+	network_result<std::optional<typed_row>> fetch_one_as(
+		tcp_resultset& r
+	) override
+	{
+		return impl(r, [&](yield_context yield, error_info* info) {
+			return r.async_fetch_one_as<typed_row>(yield, info);
+		});
+	}
+	network_result<std::vector<typed_row>> fetch_many_as(
+		tcp_resultset& r,
+		std::size_t count
+	) override
+	{
+		return impl(r, [&](yield_context yield, error_info* info) {
+			return r.async_fetch_many_as<typed_row>(count, yield, info);
+		});
+	}
+	network_result<no_result> fetch_many_into(
+		tcp_resultset& r,
+		std::size_t count,
+		std::vector<owning_row>& output
+	) override
+	{
+		return impl(r, [&](yield_context yield, error_info* info) {
+			r.async_fetch_many(count, output, yield, info);
+			return no_result();
+		});
+	}
+	network_result<no_result> write_pipeline(
+		tcp_pipeline& p
+	) override
+	{
+		return impl(p, [&](yield_context yield, error_info* info) {
+			p.async_write(yield, info);
+			return no_result();
+		});
+	}
+	network_result<tcp_resultset> read_next(
+		tcp_pipeline& p
+	) override
+	{
+		return impl(p, [&](yield_context yield, error_info* info) {
+			return p.async_read_next(yield, info);
+		});
+	}
 };
 
 
@@ -583,7 +869,7 @@ public:
 			return r.async_fetch_one(use_future);
 		});
 	}
-	network_result<std::vector<owning_row>> fetch_many(
+	network_result<owning_rows> fetch_many(
 		tcp_resultset& r,
 		std::size_t count
 	) override
@@ -592,7 +878,7 @@ public:
 			return r.async_fetch_many(count, use_future);
 		});
 	}
-	network_result<std::vector<owning_row>> fetch_all(
+	network_result<owning_rows> fetch_all(
 		tcp_resultset& r
 	) override
 	{
@@ -600,6 +886,75 @@ public:
 			return r.async_fetch_all(use_future);
 		});
 	}
+	network_result<const lazy_row*> fetch_one_lazy(
+		tcp_resultset& r
+	) override
+	{
+		return impl([&] {
+			return r.async_fetch_one_lazy(use_future);
+		});
+	}
+	network_result<row_batch> fetch_batch(
+		tcp_resultset& r,
+		std::size_t count
+	) override
+	{
+		return impl([&] {
+			return r.async_fetch_batch(count, use_future);
+		});
+	}
+	network_result<column_batch> fetch_columnar(
+		tcp_resultset& r,
+		std::size_t max_rows
+	) override
+	{
+		return impl([&] {
+			return r.async_fetch_columnar(max_rows, use_future);
+		});
+	}
+	network_result<std::optional<typed_row>> fetch_one_as(
+		tcp_resultset& r
+	) override
+	{
+		return impl([&] {
+			return r.async_fetch_one_as<typed_row>(use_future);
+		});
+	}
+	network_result<std::vector<typed_row>> fetch_many_as(
+		tcp_resultset& r,
+		std::size_t count
+	) override
+	{
+		return impl([&] {
+			return r.async_fetch_many_as<typed_row>(count, use_future);
+		});
+	}
+	network_result<no_result> fetch_many_into(
+		tcp_resultset& r,
+		std::size_t count,
+		std::vector<owning_row>& output
+	) override
+	{
+		return impl_no_result([&] {
+			return r.async_fetch_many(count, output, use_future);
+		});
+	}
+	network_result<no_result> write_pipeline(
+		tcp_pipeline& p
+	) override
+	{
+		return impl_no_result([&] {
+			return p.async_write(use_future);
+		});
+	}
+	network_result<tcp_resultset> read_next(
+		tcp_pipeline& p
+	) override
+	{
+		return impl([&] {
+			return p.async_read_next(use_future);
+		});
+	}
 };
 
 // Global objects to be exposed
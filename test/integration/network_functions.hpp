@@ -59,6 +59,8 @@ struct network_result
 };
 
 using value_list_it = std::forward_list<value>::const_iterator;
+using typed_row = std::tuple<std::int32_t, std::optional<std::string>>; // for fetch_one_as and fetch_many_as
+using owning_rows = detail::pmr_vector<owning_row>; // returned by fetch_many and fetch_all
 
 class network_functions
 {
@@ -75,8 +77,16 @@ public:
 			tcp_prepared_statement&, const std::vector<value>&) = 0;
 	virtual network_result<no_result> close_statement(tcp_prepared_statement&) = 0;
 	virtual network_result<const row*> fetch_one(tcp_resultset&) = 0;
-	virtual network_result<std::vector<owning_row>> fetch_many(tcp_resultset&, std::size_t count) = 0;
-	virtual network_result<std::vector<owning_row>> fetch_all(tcp_resultset&) = 0;
+	virtual network_result<owning_rows> fetch_many(tcp_resultset&, std::size_t count) = 0;
+	virtual network_result<owning_rows> fetch_all(tcp_resultset&) = 0;
+	virtual network_result<row_batch> fetch_batch(tcp_resultset&, std::size_t count) = 0;
+	virtual network_result<const lazy_row*> fetch_one_lazy(tcp_resultset&) = 0;
+	virtual network_result<column_batch> fetch_columnar(tcp_resultset&, std::size_t max_rows) = 0;
+	virtual network_result<std::optional<typed_row>> fetch_one_as(tcp_resultset&) = 0;
+	virtual network_result<std::vector<typed_row>> fetch_many_as(tcp_resultset&, std::size_t count) = 0;
+	virtual network_result<no_result> fetch_many_into(tcp_resultset&, std::size_t count, std::vector<owning_row>&) = 0;
+	virtual network_result<no_result> write_pipeline(tcp_pipeline&) = 0;
+	virtual network_result<tcp_resultset> read_next(tcp_pipeline&) = 0;
 };
 
 extern network_functions* sync_errc_network_functions;
@@ -0,0 +1,174 @@
+/*
+ * pipeline.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: ruben
+ */
+
+#include "boost/mysql/connection.hpp"
+#include <gmock/gmock.h> // for EXPECT_THAT()
+#include "integration_test_common.hpp"
+#include "test_common.hpp"
+
+using namespace boost::mysql::test;
+using boost::mysql::errc;
+using boost::mysql::tcp_pipeline;
+using testing::ElementsAre;
+
+namespace
+{
+
+struct PipelineTest : public NetworkTest<>
+{
+	tcp_pipeline pipe {conn.make_pipeline()};
+
+	auto do_write() { return GetParam()->write_pipeline(pipe); }
+	auto do_read_next() { return GetParam()->read_next(pipe); }
+};
+
+TEST_P(PipelineTest, SeveralQueries_ResultsetsReadInOrder)
+{
+	pipe.add_query("SELECT * FROM two_rows_table")
+		.add_query("SELECT * FROM one_row_table")
+		.add_query("UPDATE updates_table SET field_int = field_int+1");
+	EXPECT_EQ(pipe.size(), 3);
+	EXPECT_EQ(pipe.remaining(), 3);
+	do_write().validate_no_error();
+
+	auto result = do_read_next();
+	result.validate_no_error();
+	validate_2fields_meta(result.value, "two_rows_table");
+	EXPECT_EQ(result.value.fetch_all().size(), 2);
+
+	result = do_read_next();
+	result.validate_no_error();
+	validate_2fields_meta(result.value, "one_row_table");
+	EXPECT_EQ(result.value.fetch_all().size(), 1);
+
+	result = do_read_next();
+	result.validate_no_error();
+	EXPECT_TRUE(result.value.complete());
+	EXPECT_EQ(result.value.affected_rows(), 2);
+	EXPECT_EQ(pipe.remaining(), 0);
+}
+
+TEST_P(PipelineTest, QueryFails_FollowingQueriesUnaffected)
+{
+	pipe.add_query("SELECT * FROM bad_table")
+		.add_query("SELECT * FROM one_row_table");
+	do_write().validate_no_error();
+
+	auto result = do_read_next();
+	result.validate_error(errc::no_such_table, {"table", "doesn't exist", "bad_table"});
+	EXPECT_FALSE(result.value.valid());
+
+	result = do_read_next();
+	result.validate_no_error();
+	EXPECT_EQ(result.value.fetch_all().size(), 1);
+}
+
+TEST_P(PipelineTest, QueriesAndStatements_ResultsetsReadInOrder)
+{
+	auto stmt = conn.prepare_statement("SELECT * FROM two_rows_table WHERE id = ?");
+	pipe.add_execute(stmt, makevalues(2))
+		.add_query("SELECT * FROM empty_table")
+		.add_execute(stmt, makevalues(1));
+	do_write().validate_no_error();
+
+	auto result = do_read_next();
+	result.validate_no_error();
+	auto rows = result.value.fetch_all();
+	ASSERT_EQ(rows.size(), 1);
+	EXPECT_EQ(rows[0].values(), makerow(2, "f1").values());
+
+	result = do_read_next();
+	result.validate_no_error();
+	EXPECT_TRUE(result.value.fetch_all().empty());
+
+	result = do_read_next();
+	result.validate_no_error();
+	rows = result.value.fetch_all();
+	ASSERT_EQ(rows.size(), 1);
+	EXPECT_EQ(rows[0].values(), makerow(1, "f0").values());
+}
+
+TEST_P(PipelineTest, StatementWrongNumParams_ErrorWithoutAffectingOthers)
+{
+	auto stmt = conn.prepare_statement("SELECT * FROM two_rows_table WHERE id = ?");
+	pipe.add_execute(stmt, makevalues(1, 2))
+		.add_query("SELECT * FROM one_row_table");
+	do_write().validate_no_error();
+
+	auto result = do_read_next();
+	result.validate_error(errc::wrong_num_params, {"param", "2", "1", "pipeline::add_execute"});
+	EXPECT_FALSE(result.value.valid());
+
+	result = do_read_next();
+	result.validate_no_error();
+	EXPECT_EQ(result.value.fetch_all().size(), 1);
+}
+
+TEST_P(PipelineTest, Clear_PipelineReused)
+{
+	pipe.add_query("SELECT * FROM one_row_table");
+	do_write().validate_no_error();
+	auto result = do_read_next();
+	result.validate_no_error();
+	result.value.fetch_all();
+
+	pipe.clear();
+	EXPECT_EQ(pipe.size(), 0);
+	pipe.add_query("SELECT * FROM two_rows_table");
+	do_write().validate_no_error();
+	result = do_read_next();
+	result.validate_no_error();
+	EXPECT_EQ(result.value.fetch_all().size(), 2);
+
+	// The connection remains usable
+	EXPECT_EQ(conn.query("SELECT * FROM one_row_table").fetch_all().size(), 1);
+}
+
+// Records query starts and resultset completions
+struct pipeline_observer : boost::mysql::connection_observer
+{
+	std::vector<std::string> events;
+
+	void on_query_start(const boost::mysql::trace_event& ev, std::string_view sql) override
+	{
+		events.push_back("start " + std::to_string(ev.statement_id) + " " + std::string(sql));
+	}
+	void on_resultset_complete(const boost::mysql::trace_event& ev, std::uint64_t) override
+	{
+		events.push_back("complete " + std::to_string(ev.statement_id));
+	}
+};
+
+TEST_P(PipelineTest, Observer_QueryStartReportedPerRequestOnWrite)
+{
+	auto stmt = conn.prepare_statement("SELECT * FROM two_rows_table WHERE id = ?");
+	auto stmt_id = std::to_string(stmt.id());
+	pipeline_observer observer;
+	conn.set_observer(&observer);
+	pipe.add_query("SELECT * FROM one_row_table")
+		.add_execute(stmt, makevalues(1));
+	do_write().validate_no_error();
+	EXPECT_THAT(observer.events, ElementsAre("start 0 SELECT * FROM one_row_table", "start " + stmt_id + " "));
+
+	auto result = do_read_next();
+	result.validate_no_error();
+	result.value.fetch_all();
+	result = do_read_next();
+	result.validate_no_error();
+	result.value.fetch_all();
+	conn.set_observer(nullptr);
+	EXPECT_THAT(observer.events, ElementsAre(
+		"start 0 SELECT * FROM one_row_table",
+		"start " + stmt_id + " ",
+		"complete 0",
+		"complete " + stmt_id
+	));
+}
+
+MYSQL_NETWORK_TEST_SUITE(PipelineTest);
+
+} // anon namespace
@@ -8,6 +8,7 @@
 #include "boost/mysql/connection.hpp"
 #include <gmock/gmock.h> // for EXPECT_THAT()
 #include <boost/asio/use_future.hpp>
+#include <memory_resource>
 #include "metadata_validator.hpp"
 #include "integration_test_common.hpp"
 #include "test_common.hpp"
@@ -28,6 +29,45 @@ struct QueryTest : public NetworkTest<>
 	auto do_query(std::string_view sql) { return GetParam()->query(conn, sql); }
 };
 
+// Records the names of the events it receives
+struct recording_observer : boost::mysql::connection_observer
+{
+	std::vector<std::string> events;
+	std::string sql;
+	boost::mysql::trace_event first_event;
+	boost::mysql::trace_event last_event;
+
+	void record(const boost::mysql::trace_event& ev, std::string name)
+	{
+		if (events.empty()) first_event = ev;
+		last_event = ev;
+		events.push_back(std::move(name));
+	}
+
+	void on_query_start(const boost::mysql::trace_event& ev, std::string_view query) override
+	{
+		sql = query;
+		record(ev, "start");
+	}
+	void on_first_byte(const boost::mysql::trace_event& ev) override { record(ev, "first_byte"); }
+	void on_metadata_complete(const boost::mysql::trace_event& ev, std::size_t num_fields) override
+	{
+		record(ev, "metadata " + std::to_string(num_fields));
+	}
+	void on_row_batch(const boost::mysql::trace_event& ev, std::size_t num_rows) override
+	{
+		record(ev, "rows " + std::to_string(num_rows));
+	}
+	void on_resultset_complete(const boost::mysql::trace_event& ev, std::uint64_t affected_rows) override
+	{
+		record(ev, "complete " + std::to_string(affected_rows));
+	}
+	void on_error(const boost::mysql::trace_event& ev, const boost::mysql::error_code&, const boost::mysql::error_info&) override
+	{
+		record(ev, "error");
+	}
+};
+
 TEST_P(QueryTest, InsertQueryOk)
 {
 	const char* sql = "INSERT INTO inserts_table (field_varchar, field_date) VALUES ('v0', '2010-10-11')";
@@ -80,6 +120,74 @@ TEST_P(QueryTest, SelectQueryFailed)
 	EXPECT_FALSE(result.value.valid());
 }
 
+TEST_P(QueryTest, SelectOk_CustomMemoryResource_RowsAllocatedFromResource)
+{
+	std::pmr::monotonic_buffer_resource resource;
+	conn.set_memory_resource(&resource);
+	auto result = do_query("SELECT * FROM one_row_table");
+	result.validate_no_error();
+	EXPECT_EQ(result.value.memory_resource(), &resource);
+	auto rows = GetParam()->fetch_all(result.value);
+	rows.validate_no_error();
+	ASSERT_EQ(rows.value.size(), 1);
+	EXPECT_EQ(rows.value[0].values(), makerow(1, "f0").values());
+	EXPECT_EQ(rows.value[0].values().get_allocator().resource(), &resource);
+	conn.set_memory_resource(std::pmr::get_default_resource());
+}
+
+TEST_P(QueryTest, SelectOk_Stats_CountsPacketsAndBytes)
+{
+	auto before = conn.stats();
+	auto result = do_query("SELECT * FROM one_row_table");
+	result.validate_no_error();
+	auto rows = GetParam()->fetch_all(result.value);
+	rows.validate_no_error();
+	auto after = conn.stats();
+	EXPECT_EQ(after.packets_written - before.packets_written, 1);
+	EXPECT_EQ(after.packets_read - before.packets_read, 5); // field count, 2 fields, row, OK packet
+	EXPECT_GT(after.bytes_written, before.bytes_written);
+	EXPECT_GT(after.bytes_read, before.bytes_read);
+	EXPECT_GE(after.read_calls, before.read_calls + 1);
+	EXPECT_EQ(after.multiframe_packets_read, before.multiframe_packets_read);
+}
+
+TEST_P(QueryTest, SelectOk_Observer_ReceivesLifecycleEvents)
+{
+	recording_observer observer;
+	conn.set_observer(&observer);
+	auto result = do_query("SELECT * FROM one_row_table");
+	result.validate_no_error();
+	auto rows = GetParam()->fetch_all(result.value);
+	rows.validate_no_error();
+	conn.set_observer(nullptr);
+
+	EXPECT_EQ(observer.sql, "SELECT * FROM one_row_table");
+	EXPECT_THAT(observer.events, ElementsAre("start", "first_byte", "metadata 2", "rows 1", "complete 0"));
+	EXPECT_EQ(observer.last_event.operation, boost::mysql::traced_operation::query);
+	EXPECT_GT(observer.last_event.bytes_read, observer.first_event.bytes_read);
+	EXPECT_GT(observer.last_event.bytes_written, observer.first_event.bytes_written);
+	EXPECT_GE(observer.last_event.time, observer.first_event.time);
+}
+
+TEST_P(QueryTest, InsertQueryOk_Observer_CompletesWithoutMetadata)
+{
+	recording_observer observer;
+	conn.set_observer(&observer);
+	auto result = do_query("INSERT INTO inserts_table (field_varchar, field_date) VALUES ('v0', '2010-10-11')");
+	result.validate_no_error();
+	conn.set_observer(nullptr);
+	EXPECT_THAT(observer.events, ElementsAre("start", "first_byte", "complete 1"));
+}
+
+TEST_P(QueryTest, SelectQueryFailed_Observer_ReceivesError)
+{
+	recording_observer observer;
+	conn.set_observer(&observer);
+	auto result = do_query("SELECT field_varchar, field_bad FROM one_row_table");
+	result.validate_error(errc::bad_field_error, {"unknown column", "field_bad"});
+	conn.set_observer(nullptr);
+	EXPECT_THAT(observer.events, ElementsAre("start", "first_byte", "error"));
+}
 
 // Some system-level query tests (TODO: this does not feel right here)
 TEST_P(QueryTest, QueryAndFetch_AliasedTableAndField_MetadataCorrect)
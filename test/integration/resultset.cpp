@@ -10,9 +10,11 @@
 
 using namespace boost::mysql::test;
 using boost::mysql::detail::make_error_code;
+using boost::mysql::value;
 using boost::mysql::field_metadata;
 using boost::mysql::field_type;
 using boost::mysql::error_code;
+using boost::mysql::errc;
 using boost::mysql::error_info;
 using boost::mysql::tcp_resultset;
 using boost::mysql::tcp_connection;
@@ -50,6 +52,11 @@ struct ResultsetTest : public IntegTestAfterHandshake,
 	auto do_fetch_one(tcp_resultset& r) { return GetParam().net->fetch_one(r); }
 	auto do_fetch_many(tcp_resultset& r, std::size_t count) { return GetParam().net->fetch_many(r, count); }
 	auto do_fetch_all(tcp_resultset& r) { return GetParam().net->fetch_all(r); }
+	auto do_fetch_batch(tcp_resultset& r, std::size_t count) { return GetParam().net->fetch_batch(r, count); }
+	auto do_fetch_one_lazy(tcp_resultset& r) { return GetParam().net->fetch_one_lazy(r); }
+	auto do_fetch_columnar(tcp_resultset& r, std::size_t max_rows) { return GetParam().net->fetch_columnar(r, max_rows); }
+	auto do_fetch_one_as(tcp_resultset& r) { return GetParam().net->fetch_one_as(r); }
+	auto do_fetch_many_as(tcp_resultset& r, std::size_t count) { return GetParam().net->fetch_many_as(r, count); }
 };
 
 // FetchOne
@@ -85,7 +92,7 @@ TEST_P(ResultsetTest, FetchOne_OneRow)
 	row_result.validate_no_error();
 	ASSERT_NE(row_result.value, nullptr);
 	validate_2fields_meta(result, "one_row_table");
-	EXPECT_EQ(row_result.value->values(), makevalues(1, "f0"));
+	EXPECT_EQ(row_result.value->values(), makerow(1, "f0").values());
 	EXPECT_FALSE(result.complete());
 
 	// Fetch next: end of resultset
@@ -107,7 +114,7 @@ TEST_P(ResultsetTest, FetchOne_TwoRows)
 	row_result.validate_no_error();
 	ASSERT_NE(row_result.value, nullptr);
 	validate_2fields_meta(result, "two_rows_table");
-	EXPECT_EQ(row_result.value->values(), makevalues(1, "f0"));
+	EXPECT_EQ(row_result.value->values(), makerow(1, "f0").values());
 	EXPECT_FALSE(result.complete());
 
 	// Fetch next row
@@ -115,7 +122,7 @@ TEST_P(ResultsetTest, FetchOne_TwoRows)
 	row_result.validate_no_error();
 	ASSERT_NE(row_result.value, nullptr);
 	validate_2fields_meta(result, "two_rows_table");
-	EXPECT_EQ(row_result.value->values(), makevalues(2, "f1"));
+	EXPECT_EQ(row_result.value->values(), makerow(2, "f1").values());
 	EXPECT_FALSE(result.complete());
 
 	// Fetch next: end of resultset
@@ -125,6 +132,21 @@ TEST_P(ResultsetTest, FetchOne_TwoRows)
 	validate_eof(result);
 }
 
+TEST_P(ResultsetTest, FetchOne_IndexByName)
+{
+	auto result = do_generate("SELECT * FROM two_rows_table");
+	EXPECT_EQ(result.field_index("field_varchar"), std::optional<std::size_t>(1));
+	EXPECT_EQ(result.field_index("bad_field"), std::nullopt);
+
+	auto row_result = do_fetch_one(result);
+	row_result.validate_no_error();
+	ASSERT_NE(row_result.value, nullptr);
+	EXPECT_EQ((*row_result.value)["id"], value(1));
+	EXPECT_EQ(row_result.value->at("field_varchar"), value("f0"));
+	EXPECT_THROW(row_result.value->at("bad_field"), std::out_of_range);
+	do_fetch_all(result).validate_no_error();
+}
+
 // There seems to be no real case where fetch can fail (other than net fails)
 
 // FetchMany
@@ -243,6 +265,287 @@ TEST_P(ResultsetTest, FetchAll_SeveralRows)
 	EXPECT_EQ(rows_result.value, (makerows(2, 1, "f0", 2, "f1")));
 }
 
+// FetchMany into a caller-supplied vector
+TEST_P(ResultsetTest, FetchManyInto_ReusesRows)
+{
+	auto result = do_generate("SELECT * FROM three_rows_table");
+	std::vector<boost::mysql::owning_row> rows;
+
+	// First call creates the rows
+	GetParam().net->fetch_many_into(result, 2, rows).validate_no_error();
+	EXPECT_EQ(rows, (makerows(2, 1, "f0", 2, "f1")));
+	EXPECT_FALSE(result.complete());
+	const value* first_values = rows[0].values().data();
+
+	// Second call overwrites them, keeping their memory
+	GetParam().net->fetch_many_into(result, 2, rows).validate_no_error();
+	EXPECT_EQ(rows, (makerows(2, 3, "f2")));
+	EXPECT_EQ(rows[0].values().data(), first_values);
+	EXPECT_EQ(rows[0]["field_varchar"], value("f2"));
+	validate_eof(result);
+
+	// Exhausted resultset
+	GetParam().net->fetch_many_into(result, 2, rows).validate_no_error();
+	EXPECT_TRUE(rows.empty());
+}
+
+TEST_P(ResultsetTest, FetchManyInto_NoResults)
+{
+	auto result = do_generate("SELECT * FROM empty_table");
+	std::vector<boost::mysql::owning_row> rows;
+	rows.emplace_back();
+	GetParam().net->fetch_many_into(result, 10, rows).validate_no_error();
+	EXPECT_TRUE(rows.empty());
+	validate_eof(result);
+}
+
+TEST_P(ResultsetTest, FetchAll_IndexByName_OutlivesResultset)
+{
+	std::pmr::vector<boost::mysql::owning_row> rows;
+	{
+		auto result = do_generate("SELECT field_varchar AS name, id FROM two_rows_table");
+		auto rows_result = do_fetch_all(result);
+		rows_result.validate_no_error();
+		rows = std::move(rows_result.value);
+	}
+	ASSERT_EQ(rows.size(), 2);
+	EXPECT_EQ(rows[1]["name"], value("f1"));
+	EXPECT_EQ(rows[1].at("id"), value(2));
+	EXPECT_EQ(rows[0].name_index(), rows[1].name_index());
+}
+
+
+// FetchBatch
+TEST_P(ResultsetTest, FetchBatch_NoResults)
+{
+	auto result = do_generate("SELECT * FROM empty_table");
+
+	// Fetch a batch, but there are no results
+	auto batch_result = do_fetch_batch(result, 10);
+	batch_result.validate_no_error();
+	EXPECT_TRUE(batch_result.value.empty());
+	EXPECT_TRUE(result.complete());
+	validate_eof(result);
+
+	// Fetch again, should return OK and empty
+	batch_result = do_fetch_batch(result, 10);
+	batch_result.validate_no_error();
+	EXPECT_TRUE(batch_result.value.empty());
+	validate_eof(result);
+}
+
+TEST_P(ResultsetTest, FetchBatch_MoreRowsThanCount)
+{
+	auto result = do_generate("SELECT * FROM three_rows_table");
+
+	// Fetch 2, one remaining
+	auto batch_result = do_fetch_batch(result, 2);
+	batch_result.validate_no_error();
+	EXPECT_FALSE(result.complete());
+	EXPECT_EQ(batch_result.value.num_fields(), 2);
+	EXPECT_EQ(batch_result.value.values(), makerow(1, "f0", 2, "f1").values());
+
+	// Fetch another two (completes the resultset)
+	auto batch_result2 = do_fetch_batch(result, 2);
+	batch_result2.validate_no_error();
+	validate_eof(result);
+	EXPECT_EQ(batch_result2.value.values(), makerow(3, "f2").values());
+
+	// The first batch is still valid
+	EXPECT_EQ(batch_result.value.values(), makerow(1, "f0", 2, "f1").values());
+}
+
+TEST_P(ResultsetTest, FetchBatch_SameRowsAsCount)
+{
+	auto result = do_generate("SELECT * FROM two_rows_table");
+
+	// Fetch 2, 0 remaining but resultset not exhausted
+	auto batch_result = do_fetch_batch(result, 2);
+	batch_result.validate_no_error();
+	EXPECT_FALSE(result.complete());
+	EXPECT_EQ(batch_result.value.values(), makerow(1, "f0", 2, "f1").values());
+
+	// Fetch again, exhausts the resultset
+	batch_result = do_fetch_batch(result, 2);
+	batch_result.validate_no_error();
+	EXPECT_TRUE(batch_result.value.empty());
+	validate_eof(result);
+}
+
+TEST_P(ResultsetTest, FetchBatch_OutlivesResultset)
+{
+	boost::mysql::row_batch batch;
+	{
+		auto result = do_generate("SELECT * FROM two_rows_table");
+		auto batch_result = do_fetch_batch(result, std::numeric_limits<std::size_t>::max());
+		batch_result.validate_no_error();
+		validate_eof(result);
+		batch = std::move(batch_result.value);
+	}
+	EXPECT_EQ(batch.values(), makerow(1, "f0", 2, "f1").values());
+}
+
+// FetchOneLazy
+TEST_P(ResultsetTest, FetchOneLazy_NoResults)
+{
+	auto result = do_generate("SELECT * FROM empty_table");
+	auto row_result = do_fetch_one_lazy(result);
+	row_result.validate_no_error();
+	EXPECT_EQ(row_result.value, nullptr);
+	validate_eof(result);
+
+	// Fetching again just returns null
+	row_result = do_fetch_one_lazy(result);
+	row_result.validate_no_error();
+	EXPECT_EQ(row_result.value, nullptr);
+	validate_eof(result);
+}
+
+TEST_P(ResultsetTest, FetchOneLazy_TwoRows)
+{
+	auto result = do_generate("SELECT * FROM two_rows_table");
+
+	// Fetch first row, accessing the last field only
+	auto row_result = do_fetch_one_lazy(result);
+	row_result.validate_no_error();
+	ASSERT_NE(row_result.value, nullptr);
+	validate_2fields_meta(result, "two_rows_table");
+	ASSERT_EQ(row_result.value->size(), 2);
+	EXPECT_EQ(row_result.value->get(1), boost::mysql::value("f0"));
+	EXPECT_FALSE(row_result.value->is_decoded(0));
+	EXPECT_EQ(row_result.value->get(0), boost::mysql::value(std::int32_t(1)));
+	EXPECT_FALSE(result.complete());
+
+	// Fetch next row
+	row_result = do_fetch_one_lazy(result);
+	row_result.validate_no_error();
+	ASSERT_NE(row_result.value, nullptr);
+	EXPECT_EQ(row_result.value->to_row().values(), makerow(2, "f1").values());
+
+	// Fetch next: end of resultset
+	row_result = do_fetch_one_lazy(result);
+	row_result.validate_no_error();
+	ASSERT_EQ(row_result.value, nullptr);
+	validate_eof(result);
+}
+
+// FetchColumnar
+TEST_P(ResultsetTest, FetchColumnar_NoResults)
+{
+	auto result = do_generate("SELECT * FROM empty_table");
+	auto batch_result = do_fetch_columnar(result, 10);
+	batch_result.validate_no_error();
+	EXPECT_TRUE(batch_result.value.empty());
+	EXPECT_EQ(batch_result.value.num_columns(), 2);
+	validate_eof(result);
+}
+
+TEST_P(ResultsetTest, FetchColumnar_MoreRowsThanCount)
+{
+	auto result = do_generate("SELECT * FROM three_rows_table");
+
+	auto batch_result = do_fetch_columnar(result, 2);
+	batch_result.validate_no_error();
+	EXPECT_FALSE(result.complete());
+	const auto& batch = batch_result.value;
+	ASSERT_EQ(batch.size(), 2);
+	EXPECT_EQ(batch[0].kind(), boost::mysql::column_kind::int64);
+	EXPECT_EQ(batch[0].int64_values(), std::pmr::vector<std::int64_t>({1, 2}));
+	EXPECT_EQ(batch[1].kind(), boost::mysql::column_kind::string);
+	EXPECT_EQ(batch[1].string_value(0), "f0");
+	EXPECT_EQ(batch[1].string_value(1), "f1");
+
+	auto batch_result2 = do_fetch_columnar(result, 2);
+	batch_result2.validate_no_error();
+	validate_eof(result);
+	ASSERT_EQ(batch_result2.value.size(), 1);
+	EXPECT_EQ(batch_result2.value[0].int64_values()[0], 3);
+	EXPECT_EQ(batch_result2.value[1].string_value(0), "f2");
+}
+
+// FetchOneAs
+TEST_P(ResultsetTest, FetchOneAs_NoResults)
+{
+	auto result = do_generate("SELECT * FROM empty_table");
+	auto row_result = do_fetch_one_as(result);
+	row_result.validate_no_error();
+	EXPECT_EQ(row_result.value, std::nullopt);
+	validate_eof(result);
+}
+
+TEST_P(ResultsetTest, FetchOneAs_SeveralRows)
+{
+	auto result = do_generate("SELECT * FROM two_rows_table");
+
+	auto row_result = do_fetch_one_as(result);
+	row_result.validate_no_error();
+	EXPECT_EQ(row_result.value, typed_row(1, "f0"));
+	EXPECT_FALSE(result.complete());
+
+	row_result = do_fetch_one_as(result);
+	row_result.validate_no_error();
+	EXPECT_EQ(row_result.value, typed_row(2, "f1"));
+
+	row_result = do_fetch_one_as(result);
+	row_result.validate_no_error();
+	EXPECT_EQ(row_result.value, std::nullopt);
+	validate_eof(result);
+}
+
+TEST_P(ResultsetTest, FetchOneAs_IncompatibleFields_FailsBeforeReadingRows)
+{
+	auto result = do_generate("SELECT field_varchar, id FROM two_rows_table");
+	auto row_result = do_fetch_one_as(result);
+	row_result.validate_error(errc::row_type_mismatch, {"Field 0", "field_varchar"});
+	EXPECT_EQ(row_result.value, std::nullopt);
+
+	// The resultset can still be read
+	auto rows_result = do_fetch_all(result);
+	rows_result.validate_no_error();
+	EXPECT_EQ(rows_result.value.size(), 2);
+}
+
+// FetchManyAs
+TEST_P(ResultsetTest, FetchManyAs_MoreRowsThanCount)
+{
+	auto result = do_generate("SELECT * FROM three_rows_table");
+
+	auto rows_result = do_fetch_many_as(result, 2);
+	rows_result.validate_no_error();
+	EXPECT_FALSE(result.complete());
+	EXPECT_EQ(rows_result.value, (std::vector<typed_row>{{1, "f0"}, {2, "f1"}}));
+
+	rows_result = do_fetch_many_as(result, 2);
+	rows_result.validate_no_error();
+	validate_eof(result);
+	EXPECT_EQ(rows_result.value, (std::vector<typed_row>{{3, "f2"}}));
+}
+
+TEST_P(ResultsetTest, FetchManyAs_NullValues)
+{
+	auto result = do_generate("SELECT id, NULL FROM one_row_table");
+	auto rows_result = do_fetch_many_as(result, 10);
+	rows_result.validate_no_error();
+	EXPECT_EQ(rows_result.value, (std::vector<typed_row>{{1, std::nullopt}}));
+}
+
+// Projection
+TEST_P(ResultsetTest, Projection_FieldsNotProjectedAreNull)
+{
+	auto result = do_generate("SELECT * FROM two_rows_table");
+	result.set_projection({false, true});
+	EXPECT_EQ(result.projection(), std::pmr::vector<bool>({false, true}));
+	auto row_result = do_fetch_one(result);
+	row_result.validate_no_error();
+	ASSERT_NE(row_result.value, nullptr);
+	EXPECT_EQ(row_result.value->values(), makerow(nullptr, "f0").values());
+
+	result.set_projection({});
+	row_result = do_fetch_one(result);
+	row_result.validate_no_error();
+	ASSERT_NE(row_result.value, nullptr);
+	EXPECT_EQ(row_result.value->values(), makerow(2, "f1").values());
+}
 
 // Instantiate the test suites
 class text_resultset_generator : public resultset_generator
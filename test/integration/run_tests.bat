@@ -1,4 +1,4 @@
 SET SCRIPTPATH=%~dp0
 
 mysql.exe -u root < "%SCRIPTPATH%db_setup.sql"
-mysql_integrationtests
\ No newline at end of file
+IF "%1"=="" (mysql_integrationtests) ELSE (%1)
\ No newline at end of file
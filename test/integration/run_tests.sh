@@ -9,4 +9,4 @@ then
 	mysql -u root < $SCRIPTPATH/db_setup.sql
 fi
 
-./mysql_integrationtests
\ No newline at end of file
+./${1:-mysql_integrationtests}
\ No newline at end of file
@@ -0,0 +1,107 @@
+/*
+ * ssl.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: ruben
+ */
+
+#include "boost/mysql/connection.hpp"
+#include "integration_test_common.hpp"
+#include "test_common.hpp"
+#include <boost/asio/ssl/context.hpp>
+#include <boost/asio/use_future.hpp>
+
+using namespace testing;
+using namespace boost::mysql::test;
+using boost::mysql::tcp_ssl_connection;
+using boost::mysql::ssl_mode;
+using boost::mysql::ssl_session_cache;
+
+namespace
+{
+
+struct SslTest : testing::Test
+{
+	boost::mysql::connection_params params {"integ_user", "integ_password", "awesome"};
+	boost::asio::io_context ctx;
+	boost::asio::ssl::context ssl_ctx {boost::asio::ssl::context::tls_client};
+	boost::asio::executor_work_guard<boost::asio::io_context::executor_type> guard { ctx.get_executor() };
+	std::thread runner {[this]{ ctx.run(); } };
+
+	~SslTest()
+	{
+		guard.reset();
+		runner.join();
+	}
+
+	std::unique_ptr<tcp_ssl_connection> make_connection()
+	{
+		auto res = std::make_unique<tcp_ssl_connection>(ctx, ssl_ctx);
+		boost::asio::ip::tcp::endpoint endpoint (boost::asio::ip::address_v4::loopback(), 3306);
+		res->next_layer().next_layer().connect(endpoint);
+		return res;
+	}
+
+	void validate_query_works(tcp_ssl_connection& conn)
+	{
+		auto result = conn.query("SELECT * FROM one_row_table");
+		EXPECT_EQ(result.fetch_all().size(), 1);
+	}
+};
+
+TEST_F(SslTest, Handshake_RequireSync_UsesSsl)
+{
+	auto conn = make_connection();
+	params.ssl = ssl_mode::require;
+	conn->handshake(params);
+	EXPECT_TRUE(conn->uses_ssl());
+	validate_query_works(*conn);
+}
+
+TEST_F(SslTest, Handshake_RequireAsync_UsesSsl)
+{
+	auto conn = make_connection();
+	params.ssl = ssl_mode::require;
+	conn->async_handshake(params, boost::asio::use_future).get();
+	EXPECT_TRUE(conn->uses_ssl());
+	validate_query_works(*conn);
+}
+
+TEST_F(SslTest, Handshake_Disable_DoesNotUseSsl)
+{
+	auto conn = make_connection();
+	params.ssl = ssl_mode::disable;
+	conn->handshake(params);
+	EXPECT_FALSE(conn->uses_ssl());
+	validate_query_works(*conn);
+}
+
+TEST_F(SslTest, Handshake_SslAndCompression_QueriesWork)
+{
+	auto conn = make_connection();
+	params.ssl = ssl_mode::require;
+	params.compression = boost::mysql::compression_algorithm::zlib;
+	conn->handshake(params);
+	EXPECT_TRUE(conn->uses_ssl());
+	validate_query_works(*conn);
+}
+
+TEST_F(SslTest, Handshake_SessionCache_ResumesSession)
+{
+	ssl_session_cache cache;
+	params.ssl = ssl_mode::require;
+	params.ssl_sessions = &cache;
+
+	auto conn1 = make_connection();
+	conn1->handshake(params);
+	EXPECT_FALSE(SSL_session_reused(conn1->next_layer().native_handle()));
+	EXPECT_FALSE(cache.empty());
+
+	auto conn2 = make_connection();
+	conn2->async_handshake(params, boost::asio::use_future).get();
+	EXPECT_TRUE(conn2->uses_ssl());
+	EXPECT_TRUE(SSL_session_reused(conn2->next_layer().native_handle()));
+	validate_query_works(*conn2);
+}
+
+} // anon namespace
@@ -0,0 +1,115 @@
+/*
+ * unix_socket.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: ruben
+ */
+
+#include "boost/mysql/connection.hpp"
+#include "integration_test_common.hpp"
+#include "test_common.hpp"
+#include <boost/asio/use_future.hpp>
+#include <cstdlib>
+
+#ifdef BOOST_ASIO_HAS_LOCAL_SOCKETS
+
+using namespace testing;
+using namespace boost::mysql::test;
+using boost::mysql::local_connection;
+using boost::mysql::local_pipeline;
+using boost::mysql::errc;
+using boost::mysql::detail::make_error_code;
+
+namespace
+{
+
+// Override with the MYSQL_UNIX_SOCKET_PATH environment variable
+const char* get_socket_path()
+{
+	const char* res = std::getenv("MYSQL_UNIX_SOCKET_PATH");
+	return res ? res : "/var/run/mysqld/mysqld.sock";
+}
+
+struct UnixSocketTest : testing::Test
+{
+	boost::mysql::connection_params params {"integ_user", "integ_password", "awesome"};
+	boost::asio::io_context ctx;
+	local_connection conn {ctx};
+	boost::asio::executor_work_guard<boost::asio::io_context::executor_type> guard { ctx.get_executor() };
+	std::thread runner {[this]{ ctx.run(); } };
+
+	UnixSocketTest()
+	{
+		try
+		{
+			conn.next_layer().connect(boost::asio::local::stream_protocol::endpoint(get_socket_path()));
+		}
+		catch (...) // prevent terminate without an active exception on connect error
+		{
+			guard.reset();
+			runner.join();
+			throw;
+		}
+	}
+
+	~UnixSocketTest()
+	{
+		boost::mysql::error_code code;
+		conn.next_layer().close(code);
+		guard.reset();
+		runner.join();
+	}
+};
+
+TEST_F(UnixSocketTest, HandshakeSync_QueryWorks)
+{
+	conn.handshake(params);
+	auto result = conn.query("SELECT * FROM two_rows_table");
+	auto rows = result.fetch_all();
+	ASSERT_EQ(rows.size(), 2);
+	EXPECT_EQ(rows[0].values(), makerow(1, "f0").values());
+	EXPECT_EQ(rows[1].values(), makerow(2, "f1").values());
+}
+
+TEST_F(UnixSocketTest, HandshakeAsync_QueryWorks)
+{
+	conn.async_handshake(params, boost::asio::use_future).get();
+	auto result = conn.async_query("SELECT * FROM one_row_table", boost::asio::use_future).get();
+	auto row = result.async_fetch_one(boost::asio::use_future).get();
+	ASSERT_NE(row, nullptr);
+	EXPECT_EQ(row->values(), makerow(1, "f0").values());
+}
+
+TEST_F(UnixSocketTest, QueryError_ReportsError)
+{
+	conn.handshake(params);
+	boost::mysql::error_code err;
+	boost::mysql::error_info info;
+	conn.query("SELECT * FROM bad_table", err, info);
+	EXPECT_EQ(err, make_error_code(errc::no_such_table));
+}
+
+TEST_F(UnixSocketTest, PreparedStatement_ExecuteWorks)
+{
+	conn.handshake(params);
+	auto stmt = conn.prepare_statement("SELECT * FROM two_rows_table WHERE id = ?");
+	auto result = stmt.execute(makevalues(2));
+	auto rows = result.fetch_all();
+	ASSERT_EQ(rows.size(), 1);
+	EXPECT_EQ(rows[0].values(), makerow(2, "f1").values());
+	stmt.close();
+}
+
+TEST_F(UnixSocketTest, Pipeline_ReadsAllResponses)
+{
+	conn.handshake(params);
+	local_pipeline pipe = conn.make_pipeline();
+	pipe.add_query("SELECT * FROM one_row_table").add_query("SELECT * FROM two_rows_table");
+	pipe.write();
+	EXPECT_EQ(pipe.read_next().fetch_all().size(), 1);
+	EXPECT_EQ(pipe.read_next().fetch_all().size(), 2);
+}
+
+} // anon namespace
+
+#endif
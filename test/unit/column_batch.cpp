@@ -0,0 +1,139 @@
+#include <gtest/gtest.h>
+#include "boost/mysql/column_batch.hpp"
+#include "test_common.hpp"
+
+using boost::mysql::column;
+using boost::mysql::column_batch;
+using boost::mysql::column_kind;
+using boost::mysql::field_metadata;
+using boost::mysql::get_column_kind;
+using boost::mysql::test::makefield;
+namespace column_flags = boost::mysql::detail::column_flags;
+using boost::mysql::detail::protocol_field_type;
+
+namespace
+{
+
+TEST(GetColumnKind, AllTypes_ReturnsExpectedKind)
+{
+	EXPECT_EQ(get_column_kind(makefield(protocol_field_type::tiny)), column_kind::int64);
+	EXPECT_EQ(get_column_kind(makefield(protocol_field_type::longlong)), column_kind::int64);
+	EXPECT_EQ(get_column_kind(makefield(protocol_field_type::long_, column_flags::unsigned_)), column_kind::uint64);
+	EXPECT_EQ(get_column_kind(makefield(protocol_field_type::year)), column_kind::int64);
+	EXPECT_EQ(get_column_kind(makefield(protocol_field_type::float_)), column_kind::double_);
+	EXPECT_EQ(get_column_kind(makefield(protocol_field_type::double_)), column_kind::double_);
+	EXPECT_EQ(get_column_kind(makefield(protocol_field_type::date)), column_kind::date);
+	EXPECT_EQ(get_column_kind(makefield(protocol_field_type::datetime)), column_kind::datetime);
+	EXPECT_EQ(get_column_kind(makefield(protocol_field_type::timestamp)), column_kind::datetime);
+	EXPECT_EQ(get_column_kind(makefield(protocol_field_type::time)), column_kind::time);
+	EXPECT_EQ(get_column_kind(makefield(protocol_field_type::var_string)), column_kind::string);
+	EXPECT_EQ(get_column_kind(makefield(protocol_field_type::newdecimal)), column_kind::string);
+	EXPECT_EQ(get_column_kind(makefield(protocol_field_type::bit)), column_kind::string);
+}
+
+TEST(Column, Constructor_Empty)
+{
+	column col (column_kind::string);
+	EXPECT_EQ(col.kind(), column_kind::string);
+	EXPECT_EQ(col.size(), 0);
+	EXPECT_TRUE(col.validity().empty());
+	EXPECT_EQ(col.string_offsets(), std::pmr::vector<std::size_t>({0}));
+}
+
+TEST(Column, AppendInt64_ValuesAndNulls)
+{
+	column col (column_kind::int64);
+	col.append(std::int64_t(-1));
+	col.append_null();
+	col.append(std::int64_t(42));
+	ASSERT_EQ(col.size(), 3);
+	EXPECT_EQ(col.int64_values(), std::pmr::vector<std::int64_t>({-1, 0, 42}));
+	EXPECT_FALSE(col.is_null(0));
+	EXPECT_TRUE(col.is_null(1));
+	EXPECT_FALSE(col.is_null(2));
+	EXPECT_EQ(col.validity(), std::pmr::vector<std::uint8_t>({0x05}));
+	EXPECT_TRUE(col.uint64_values().empty());
+	EXPECT_TRUE(col.double_values().empty());
+}
+
+TEST(Column, AppendString_OffsetsAndData)
+{
+	column col (column_kind::string);
+	col.append(std::string_view("abc"));
+	col.append_null();
+	col.append(std::string_view(""));
+	col.append(std::string_view("de"));
+	ASSERT_EQ(col.size(), 4);
+	EXPECT_EQ(col.string_offsets(), std::pmr::vector<std::size_t>({0, 3, 3, 3, 5}));
+	EXPECT_EQ(std::string_view(col.string_data().data(), col.string_data().size()), "abcde");
+	EXPECT_EQ(col.string_value(0), "abc");
+	EXPECT_EQ(col.string_value(1), "");
+	EXPECT_TRUE(col.is_null(1));
+	EXPECT_EQ(col.string_value(2), "");
+	EXPECT_FALSE(col.is_null(2));
+	EXPECT_EQ(col.string_value(3), "de");
+}
+
+TEST(Column, Append_ManyValues_GrowsBitmap)
+{
+	column col (column_kind::double_);
+	for (int i = 0; i < 20; ++i)
+	{
+		if (i % 3 == 0) col.append_null();
+		else col.append(double(i));
+	}
+	ASSERT_EQ(col.size(), 20);
+	EXPECT_EQ(col.validity().size(), 3);
+	for (std::size_t i = 0; i < 20; ++i)
+	{
+		EXPECT_EQ(col.is_null(i), i % 3 == 0) << i;
+	}
+	EXPECT_EQ(col.double_values()[19], 19.0);
+}
+
+TEST(Column, Truncate_RemovesValues)
+{
+	column col (column_kind::string);
+	col.append(std::string_view("abc"));
+	col.append(std::string_view("de"));
+	col.append_null();
+	col.truncate(1);
+	ASSERT_EQ(col.size(), 1);
+	EXPECT_EQ(col.string_offsets(), std::pmr::vector<std::size_t>({0, 3}));
+	EXPECT_EQ(col.string_data().size(), 3);
+	col.append_null();
+	EXPECT_TRUE(col.is_null(1));
+	EXPECT_FALSE(col.is_null(0));
+}
+
+TEST(ColumnBatch, DefaultConstructor_Empty)
+{
+	column_batch batch;
+	EXPECT_TRUE(batch.empty());
+	EXPECT_EQ(batch.size(), 0);
+	EXPECT_EQ(batch.num_columns(), 0);
+}
+
+TEST(ColumnBatch, Constructor_OneColumnPerField)
+{
+	column_batch batch ({makefield(protocol_field_type::long_), makefield(protocol_field_type::blob)});
+	EXPECT_TRUE(batch.empty());
+	ASSERT_EQ(batch.num_columns(), 2);
+	EXPECT_EQ(batch[0].kind(), column_kind::int64);
+	EXPECT_EQ(batch[1].kind(), column_kind::string);
+}
+
+TEST(ColumnBatch, DiscardRow_RemovesPartialRow)
+{
+	column_batch batch ({makefield(protocol_field_type::long_), makefield(protocol_field_type::blob)});
+	batch.get_column(0).append(std::int64_t(1));
+	batch.get_column(1).append(std::string_view("a"));
+	batch.finish_row();
+	batch.get_column(0).append(std::int64_t(2));
+	batch.discard_row();
+	EXPECT_EQ(batch.size(), 1);
+	EXPECT_EQ(batch[0].size(), 1);
+	EXPECT_EQ(batch[1].size(), 1);
+}
+
+} // anon namespace
@@ -0,0 +1,149 @@
+#include <gtest/gtest.h>
+#include "boost/mysql/compact_row.hpp"
+#include "test_common.hpp"
+#include <cstring>
+#include <memory_resource>
+#include <string>
+
+using namespace boost::mysql::test;
+using boost::mysql::compact_value;
+using boost::mysql::compact_row;
+using boost::mysql::value;
+using boost::mysql::row;
+
+namespace
+{
+
+// compact_value
+struct CompactValueRoundTripTest : testing::TestWithParam<value> {};
+
+TEST_P(CompactValueRoundTripTest, ToValue_ReturnsEquivalentValue)
+{
+	compact_value v (GetParam());
+	EXPECT_EQ(v.index(), GetParam().index());
+	EXPECT_EQ(v.to_value(), GetParam());
+	EXPECT_EQ(v.is_null(), GetParam() == value(nullptr));
+}
+
+INSTANTIATE_TEST_SUITE_P(Default, CompactValueRoundTripTest, testing::Values(
+	value(nullptr),
+	value(std::int32_t(-20)),
+	value(std::int64_t(-0x7fffffffffffffff)),
+	value(std::uint32_t(0xffffffff)),
+	value(std::uint64_t(0xffffffffffffffff)),
+	value(makesv("abc")),
+	value(std::string_view()),
+	value(4.2f),
+	value(-1.5e300),
+	value(makedate(2020, 2, 29)),
+	value(makedt(1969, 12, 31, 23, 59, 59, 999999)),
+	value(-maket(838, 59, 59))
+));
+
+TEST(CompactValue, Size_Is16Bytes)
+{
+	EXPECT_EQ(sizeof(compact_value), 16);
+	EXPECT_LT(sizeof(compact_value), sizeof(value));
+}
+
+TEST(CompactValue, DefaultConstructor_IsNull)
+{
+	compact_value v;
+	EXPECT_TRUE(v.is_null());
+	EXPECT_TRUE(v.is<std::nullptr_t>());
+	EXPECT_EQ(v.to_value(), value(nullptr));
+}
+
+TEST(CompactValue, String_PointsToSameMemory)
+{
+	std::string s = "hello";
+	compact_value v {value(std::string_view(s))};
+	EXPECT_TRUE(v.is<std::string_view>());
+	EXPECT_EQ(v.get<std::string_view>().data(), s.data());
+	EXPECT_EQ(v.get<std::string_view>(), "hello");
+}
+
+TEST(CompactValue, OperatorEquals_ComparesTypeAndValue)
+{
+	EXPECT_EQ(compact_value(value(std::int64_t(1))), compact_value(value(std::int64_t(1))));
+	EXPECT_NE(compact_value(value(std::int64_t(1))), compact_value(value(std::uint64_t(1))));
+	EXPECT_NE(compact_value(value(std::int64_t(1))), compact_value(value(std::int64_t(2))));
+}
+
+// compact_row
+TEST(CompactRow, DefaultConstructor_Empty)
+{
+	compact_row r;
+	EXPECT_TRUE(r.empty());
+	EXPECT_EQ(r.size(), 0);
+	EXPECT_EQ(r.allocated_size(), 0);
+	EXPECT_EQ(r.begin(), r.end());
+}
+
+TEST(CompactRow, ConstructFromRow_SameValues)
+{
+	auto input = makerow(std::int64_t(-1), "abc", nullptr, 2.0, makedate(2020, 1, 1), "", std::uint64_t(10));
+	compact_row r (input);
+	ASSERT_EQ(r.size(), 7);
+	EXPECT_EQ(r[0].get<std::int64_t>(), -1);
+	EXPECT_EQ(r[1].get<std::string_view>(), "abc");
+	EXPECT_TRUE(r[2].is_null());
+	EXPECT_EQ(r.to_row(), input);
+}
+
+TEST(CompactRow, ConstructFromRow_StringsIndependentFromSource)
+{
+	std::string s1 = "first";
+	std::string s2 = "second";
+	compact_row r (row({value(std::string_view(s1)), value(std::int32_t(5)), value(std::string_view(s2))}));
+	std::memset(s1.data(), 'x', s1.size());
+	std::memset(s2.data(), 'x', s2.size());
+	EXPECT_EQ(r[0].get<std::string_view>(), "first");
+	EXPECT_EQ(r[2].get<std::string_view>(), "second");
+	EXPECT_EQ(r.allocated_size(), 3 * sizeof(compact_value) + 11);
+}
+
+TEST(CompactRow, ConstructFromRow_SingleAllocationFromResource)
+{
+	counting_resource resource;
+	{
+		compact_row r (makerow("abc", "def", std::int64_t(1)), &resource);
+		EXPECT_EQ(r.memory_resource(), &resource);
+		EXPECT_EQ(resource.allocations, 1);
+	}
+	EXPECT_EQ(resource.allocations, 0);
+}
+
+TEST(CompactRow, ConstructFromEmptyRow_DoesNotAllocate)
+{
+	counting_resource resource;
+	compact_row r (row(), &resource);
+	EXPECT_TRUE(r.empty());
+	EXPECT_EQ(resource.allocations, 0);
+}
+
+TEST(CompactRow, MoveConstructor_StringsRemainValid)
+{
+	compact_row r1 (makerow("abc", std::int32_t(2)));
+	const char* data = r1[0].get<std::string_view>().data();
+	compact_row r2 (std::move(r1));
+	EXPECT_TRUE(r1.empty());
+	ASSERT_EQ(r2.size(), 2);
+	EXPECT_EQ(r2[0].get<std::string_view>().data(), data);
+	EXPECT_EQ(r2[0].get<std::string_view>(), "abc");
+}
+
+TEST(CompactRow, MoveAssignment_ReleasesPreviousMemory)
+{
+	counting_resource resource1;
+	counting_resource resource2;
+	compact_row r1 (makerow("abc"), &resource1);
+	compact_row r2 (makerow("def"), &resource2);
+	r1 = std::move(r2);
+	EXPECT_EQ(resource1.allocations, 0);
+	EXPECT_EQ(resource2.allocations, 1);
+	EXPECT_EQ(r1.memory_resource(), &resource2);
+	EXPECT_EQ(r1[0].get<std::string_view>(), "def");
+}
+
+} // anon namespace
@@ -0,0 +1,74 @@
+#include <gtest/gtest.h>
+#include "boost/mysql/detail/auxiliar/field_name_index.hpp"
+#include <string>
+#include <vector>
+
+using boost::mysql::detail::field_name_index;
+
+namespace
+{
+
+struct named_field
+{
+	std::string name;
+	std::string_view field_name() const noexcept { return name; }
+};
+
+field_name_index make_index(const std::vector<named_field>& fields)
+{
+	return field_name_index(fields.begin(), fields.end());
+}
+
+TEST(FieldNameIndex, Find_ExistingNames_ReturnsPositions)
+{
+	auto index = make_index({{"id"}, {"field_varchar"}, {"field_date"}});
+	EXPECT_EQ(index.find("id"), 0);
+	EXPECT_EQ(index.find("field_varchar"), 1);
+	EXPECT_EQ(index.find("field_date"), 2);
+}
+
+TEST(FieldNameIndex, Find_MissingName_ReturnsNpos)
+{
+	auto index = make_index({{"id"}, {"field_varchar"}});
+	EXPECT_EQ(index.find("ID"), field_name_index::npos); // case-sensitive
+	EXPECT_EQ(index.find("field"), field_name_index::npos);
+	EXPECT_EQ(index.find(""), field_name_index::npos);
+}
+
+TEST(FieldNameIndex, Find_DuplicateNames_ReturnsFirst)
+{
+	auto index = make_index({{"a"}, {"id"}, {"b"}, {"id"}});
+	EXPECT_EQ(index.find("id"), 1);
+	EXPECT_EQ(index.find("b"), 2);
+}
+
+TEST(FieldNameIndex, Find_NoFields_ReturnsNpos)
+{
+	auto index = make_index({});
+	EXPECT_EQ(index.find("id"), field_name_index::npos);
+}
+
+TEST(FieldNameIndex, Find_ManyFields_ReturnsPositions)
+{
+	std::vector<named_field> fields;
+	for (std::size_t i = 0; i < 500; ++i)
+	{
+		fields.push_back({"field_" + std::to_string(i)});
+	}
+	fields.push_back({""});
+	auto index = make_index(fields);
+	for (std::size_t i = 0; i < fields.size(); ++i)
+	{
+		EXPECT_EQ(index.find(fields[i].name), i);
+	}
+}
+
+TEST(FieldNameIndex, Find_SourceDestroyed_StillValid)
+{
+	std::vector<named_field> fields {{"first"}, {"second"}};
+	field_name_index index (fields.begin(), fields.end());
+	fields.clear();
+	EXPECT_EQ(index.find("second"), 1);
+}
+
+} // anon namespace
@@ -0,0 +1,104 @@
+#include <gtest/gtest.h>
+#include "boost/mysql/detail/auxiliar/read_buffer.hpp"
+#include "test_common.hpp"
+
+using boost::mysql::detail::read_buffer;
+using boost::mysql::detail::bytestring;
+
+namespace
+{
+
+void write_bytes(read_buffer& buff, const bytestring& bytes)
+{
+	ASSERT_GE(buff.free_size(), bytes.size());
+	memcpy(buff.free_area().data(), bytes.data(), bytes.size());
+	buff.commit(bytes.size());
+}
+
+bytestring pending_bytes(const read_buffer& buff)
+{
+	return bytestring(buff.pending_first(), buff.pending_first() + buff.pending_size());
+}
+
+TEST(ReadBuffer, Constructor_Default_AllFree)
+{
+	read_buffer buff (8);
+	EXPECT_EQ(buff.capacity(), 8);
+	EXPECT_EQ(buff.pending_size(), 0);
+	EXPECT_EQ(buff.free_size(), 8);
+}
+
+TEST(ReadBuffer, Commit_SomeBytes_BecomePending)
+{
+	read_buffer buff (8);
+	write_bytes(buff, {0x01, 0x02, 0x03});
+	EXPECT_EQ(pending_bytes(buff), (bytestring{0x01, 0x02, 0x03}));
+	EXPECT_EQ(buff.free_size(), 5);
+}
+
+TEST(ReadBuffer, Consume_Partial_KeepsRemainingPending)
+{
+	read_buffer buff (8);
+	write_bytes(buff, {0x01, 0x02, 0x03});
+	buff.consume(1);
+	EXPECT_EQ(pending_bytes(buff), (bytestring{0x02, 0x03}));
+	EXPECT_EQ(buff.free_size(), 5);
+}
+
+TEST(ReadBuffer, Consume_All_ReclaimsFreeSpace)
+{
+	read_buffer buff (8);
+	write_bytes(buff, {0x01, 0x02, 0x03});
+	buff.consume(3);
+	EXPECT_EQ(buff.pending_size(), 0);
+	EXPECT_EQ(buff.free_size(), 8);
+}
+
+TEST(ReadBuffer, ConsumeInto_LessThanPending_CopiesRequestedSize)
+{
+	read_buffer buff (8);
+	write_bytes(buff, {0x01, 0x02, 0x03});
+	bytestring output (2);
+	EXPECT_EQ(buff.consume_into(output.data(), 2), 2);
+	EXPECT_EQ(output, (bytestring{0x01, 0x02}));
+	EXPECT_EQ(pending_bytes(buff), (bytestring{0x03}));
+}
+
+TEST(ReadBuffer, ConsumeInto_MoreThanPending_CopiesPendingSize)
+{
+	read_buffer buff (8);
+	write_bytes(buff, {0x01, 0x02, 0x03});
+	bytestring output (5);
+	EXPECT_EQ(buff.consume_into(output.data(), 5), 3);
+	EXPECT_EQ(output, (bytestring{0x01, 0x02, 0x03, 0x00, 0x00}));
+	EXPECT_EQ(buff.pending_size(), 0);
+}
+
+TEST(ReadBuffer, ConsumeInto_NothingPending_ReturnsZero)
+{
+	read_buffer buff (8);
+	bytestring output (5);
+	EXPECT_EQ(buff.consume_into(output.data(), 5), 0);
+}
+
+TEST(ReadBuffer, Relocate_PendingNotAtBeginning_MovesToBeginning)
+{
+	read_buffer buff (8);
+	write_bytes(buff, {0x01, 0x02, 0x03, 0x04, 0x05, 0x06});
+	buff.consume(4);
+	EXPECT_EQ(buff.free_size(), 2);
+	buff.relocate();
+	EXPECT_EQ(pending_bytes(buff), (bytestring{0x05, 0x06}));
+	EXPECT_EQ(buff.free_size(), 6);
+}
+
+TEST(ReadBuffer, Relocate_PendingAtBeginning_NoOp)
+{
+	read_buffer buff (8);
+	write_bytes(buff, {0x01, 0x02});
+	buff.relocate();
+	EXPECT_EQ(pending_bytes(buff), (bytestring{0x01, 0x02}));
+	EXPECT_EQ(buff.free_size(), 6);
+}
+
+} // anon namespace
@@ -0,0 +1,118 @@
+#include <gtest/gtest.h>
+#include "boost/mysql/detail/auxiliar/recycling_allocator.hpp"
+#include <vector>
+
+using boost::mysql::detail::recycling_memory;
+using boost::mysql::detail::recycling_allocator;
+using boost::mysql::detail::allocate_operation_state;
+
+namespace
+{
+
+TEST(RecyclingMemory, Allocate_AfterDeallocate_ReusesBlock)
+{
+	recycling_memory mem;
+	void* p1 = mem.allocate(64);
+	mem.deallocate(p1);
+	void* p2 = mem.allocate(64);
+	EXPECT_EQ(p1, p2);
+	mem.deallocate(p2);
+}
+
+TEST(RecyclingMemory, Allocate_SmallerSize_ReusesBlock)
+{
+	recycling_memory mem;
+	void* p1 = mem.allocate(64);
+	mem.deallocate(p1);
+	void* p2 = mem.allocate(10);
+	EXPECT_EQ(p1, p2);
+	mem.deallocate(p2);
+}
+
+TEST(RecyclingMemory, Allocate_BiggerSize_DoesNotReuseBlock)
+{
+	recycling_memory mem;
+	void* p1 = mem.allocate(10);
+	mem.deallocate(p1);
+	void* p2 = mem.allocate(64);
+	EXPECT_NE(p1, p2);
+	mem.deallocate(p2);
+}
+
+TEST(RecyclingMemory, Allocate_SeveralCachedBlocks_UsesSmallestThatFits)
+{
+	recycling_memory mem;
+	void* big = mem.allocate(256);
+	void* medium = mem.allocate(64);
+	void* small = mem.allocate(16);
+	mem.deallocate(big);
+	mem.deallocate(medium);
+	mem.deallocate(small);
+	void* p = mem.allocate(32);
+	EXPECT_EQ(p, medium);
+	mem.deallocate(p);
+}
+
+TEST(RecyclingMemory, Allocate_SeveralOutstanding_AllValid)
+{
+	recycling_memory mem;
+	std::vector<void*> blocks;
+	for (std::size_t i = 0; i < 20; ++i)
+	{
+		blocks.push_back(mem.allocate(8));
+		*static_cast<std::uint64_t*>(blocks.back()) = i;
+	}
+	for (std::size_t i = 0; i < 20; ++i)
+	{
+		EXPECT_EQ(*static_cast<std::uint64_t*>(blocks[i]), i);
+		mem.deallocate(blocks[i]);
+	}
+}
+
+TEST(RecyclingAllocator, Equality_SameMemory_Equal)
+{
+	recycling_memory mem1, mem2;
+	recycling_allocator<int> alloc1 (mem1);
+	recycling_allocator<char> alloc2 (mem1);
+	recycling_allocator<int> alloc3 (mem2);
+	EXPECT_TRUE(alloc1 == alloc2);
+	EXPECT_FALSE(alloc1 != alloc2);
+	EXPECT_FALSE(alloc1 == alloc3);
+	EXPECT_TRUE(alloc1 != alloc3);
+}
+
+TEST(RecyclingAllocator, AllocateOperationState_NoAssociatedAllocator_UsesDefault)
+{
+	recycling_memory mem;
+	auto handler = [](){};
+	auto p1 = allocate_operation_state<int>(handler, recycling_allocator<void>(mem), 42);
+	EXPECT_EQ(*p1, 42);
+	const void* addr = p1.get();
+	p1.reset();
+	auto p2 = allocate_operation_state<int>(handler, recycling_allocator<void>(mem), 43);
+	EXPECT_EQ(*p2, 43);
+	EXPECT_EQ(p2.get(), addr); // memory has been recycled
+}
+
+struct handler_with_allocator
+{
+	recycling_memory* mem;
+	using allocator_type = recycling_allocator<void>;
+	allocator_type get_allocator() const noexcept { return allocator_type(*mem); }
+	void operator()() {}
+};
+
+TEST(RecyclingAllocator, AllocateOperationState_AssociatedAllocator_UsesIt)
+{
+	recycling_memory default_mem, handler_mem;
+	handler_with_allocator handler {&handler_mem};
+	auto p1 = allocate_operation_state<int>(handler, recycling_allocator<void>(handler_mem), 1);
+	const void* addr = p1.get();
+	p1.reset();
+
+	// The block is now cached in handler_mem, not in default_mem
+	auto p2 = allocate_operation_state<int>(handler, recycling_allocator<void>(default_mem), 2);
+	EXPECT_EQ(p2.get(), addr);
+}
+
+} // anon namespace
@@ -0,0 +1,59 @@
+#include <gtest/gtest.h>
+#include "boost/mysql/detail/auxiliar/struct_tie.hpp"
+#include <optional>
+#include <string>
+#include <string_view>
+
+using boost::mysql::detail::aggregate_field_count;
+using boost::mysql::detail::tie_row;
+using boost::mysql::detail::row_tuple_t;
+
+namespace
+{
+
+struct one_member { int a; };
+struct several_members { std::int64_t a; std::string b; std::optional<double> c; std::string_view d; };
+struct sixteen_members { int a, b, c, d, e, f, g, h, i, j, k, l, m, n, o, p; };
+
+static_assert(aggregate_field_count<one_member>() == 1);
+static_assert(aggregate_field_count<several_members>() == 4);
+static_assert(aggregate_field_count<sixteen_members>() == 16);
+static_assert(std::is_same_v<
+	row_tuple_t<several_members>,
+	std::tuple<std::int64_t, std::string, std::optional<double>, std::string_view>
+>);
+static_assert(std::is_same_v<row_tuple_t<std::tuple<int, float>>, std::tuple<int, float>>);
+
+TEST(TieRow, Aggregate_ReferencesMembers)
+{
+	several_members v {};
+	auto members = tie_row(v);
+	std::get<0>(members) = 42;
+	std::get<1>(members) = "abc";
+	std::get<2>(members) = 4.2;
+	EXPECT_EQ(v.a, 42);
+	EXPECT_EQ(v.b, "abc");
+	EXPECT_EQ(v.c, 4.2);
+	EXPECT_EQ(&std::get<3>(members), &v.d);
+}
+
+TEST(TieRow, SixteenMembers_ReferencesMembers)
+{
+	sixteen_members v {};
+	auto members = tie_row(v);
+	std::get<0>(members) = 1;
+	std::get<15>(members) = 16;
+	EXPECT_EQ(v.a, 1);
+	EXPECT_EQ(v.p, 16);
+}
+
+TEST(TieRow, Tuple_ReferencesElements)
+{
+	std::tuple<int, std::string> v;
+	auto members = tie_row(v);
+	std::get<0>(members) = 5;
+	std::get<1>(members) = "a";
+	EXPECT_EQ(v, std::make_tuple(5, std::string("a")));
+}
+
+} // anon namespace
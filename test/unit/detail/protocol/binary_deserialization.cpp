@@ -23,18 +23,18 @@ namespace
 
 using boost::mysql::operator<<;
 
-std::vector<boost::mysql::field_metadata> make_meta(
+resultset_metadata make_meta(
 	const std::vector<protocol_field_type>& types
 )
 {
-	std::vector<boost::mysql::field_metadata> res;
+	std::pmr::vector<boost::mysql::field_metadata> res;
 	for (const auto type: types)
 	{
 		column_definition_packet coldef;
 		coldef.type = type;
 		res.emplace_back(coldef);
 	}
-	return res;
+	return resultset_metadata({}, {}, std::move(res));
 }
 
 // for deserialize_binary_value
@@ -142,13 +142,13 @@ struct BinaryRowParam : named_param
 {
 	std::string name;
 	std::vector<std::uint8_t> from;
-	std::vector<value> expected;
+	std::pmr::vector<value> expected;
 	std::vector<protocol_field_type> types;
 
 	BinaryRowParam(
 		std::string name,
 		std::vector<std::uint8_t> from,
-		std::vector<value> expected,
+		std::pmr::vector<value> expected,
 		std::vector<protocol_field_type> types
 	):
 		name(std::move(name)),
@@ -168,31 +168,31 @@ TEST_P(DeserializeBinaryRowTest, CorrectFormat_SetsOutputValueReturnsTrue)
 	const auto& buffer = GetParam().from;
 	deserialization_context ctx (buffer.data(), buffer.data() + buffer.size(), capabilities());
 
-	std::vector<value> actual;
+	std::pmr::vector<value> actual;
 	auto err = deserialize_binary_row(ctx, meta, actual);
 	EXPECT_EQ(err, error_code());
 	EXPECT_EQ(actual, GetParam().expected);
 }
 
 INSTANTIATE_TEST_SUITE_P(Default, DeserializeBinaryRowTest, testing::Values(
-	BinaryRowParam("one_value", {0x00, 0x00, 0x14}, makevalues(std::int32_t(20)), {protocol_field_type::tiny}),
-	BinaryRowParam("one_null", {0x00, 0x04}, makevalues(nullptr), {protocol_field_type::tiny}),
+	BinaryRowParam("one_value", {0x00, 0x00, 0x14}, makerow(std::int32_t(20)).values(), {protocol_field_type::tiny}),
+	BinaryRowParam("one_null", {0x00, 0x04}, makerow(nullptr).values(), {protocol_field_type::tiny}),
 	BinaryRowParam("two_values", {0x00, 0x00, 0x03, 0x6d, 0x69, 0x6e, 0x6d, 0x07},
-			makevalues("min", std::int32_t(1901)), {protocol_field_type::var_string, protocol_field_type::short_}),
+			makerow("min", std::int32_t(1901)).values(), {protocol_field_type::var_string, protocol_field_type::short_}),
 	BinaryRowParam("one_value_one_null", {0x00, 0x08, 0x03, 0x6d, 0x61, 0x78},
-			makevalues("max", nullptr), {protocol_field_type::var_string, protocol_field_type::tiny}),
+			makerow("max", nullptr).values(), {protocol_field_type::var_string, protocol_field_type::tiny}),
 	BinaryRowParam("two_nulls", {0x00, 0x0c},
-			makevalues(nullptr, nullptr), {protocol_field_type::tiny, protocol_field_type::tiny}),
-	BinaryRowParam("six_nulls", {0x00, 0xfc}, std::vector<value>(6, value(nullptr)),
+			makerow(nullptr, nullptr).values(), {protocol_field_type::tiny, protocol_field_type::tiny}),
+	BinaryRowParam("six_nulls", {0x00, 0xfc}, std::pmr::vector<value>(6, value(nullptr)),
 			std::vector<protocol_field_type>(6, protocol_field_type::tiny)),
-	BinaryRowParam("seven_nulls", {0x00, 0xfc, 0x01}, std::vector<value>(7, value(nullptr)),
+	BinaryRowParam("seven_nulls", {0x00, 0xfc, 0x01}, std::pmr::vector<value>(7, value(nullptr)),
 			std::vector<protocol_field_type>(7, protocol_field_type::tiny)),
 	BinaryRowParam("several_values", {
 			0x00, 0x90, 0x00, 0xfd, 0x14, 0x00, 0xc3, 0xf5, 0x48,
 			0x40, 0x02, 0x61, 0x62, 0x04, 0xe2, 0x07, 0x0a,
 			0x05, 0x71, 0x99, 0x6d, 0xe2, 0x93, 0x4d, 0xf5,
 			0x3d
-		}, makevalues(
+		}, makerow(
 			std::int32_t(-3),
 			std::int32_t(20),
 			nullptr,
@@ -201,7 +201,7 @@ INSTANTIATE_TEST_SUITE_P(Default, DeserializeBinaryRowTest, testing::Values(
 			nullptr,
 			makedate(2018, 10, 5),
 			3.10e-10
-		), {
+		).values(), {
 			protocol_field_type::tiny,
 			protocol_field_type::short_,
 			protocol_field_type::long_,
@@ -244,7 +244,7 @@ TEST_P(DeserializeBinaryRowErrorTest, ErrorCondition_ReturnsErrorCode)
 	const auto& buffer = GetParam().from;
 	deserialization_context ctx (buffer.data(), buffer.data() + buffer.size(), capabilities());
 
-	std::vector<value> actual;
+	std::pmr::vector<value> actual;
 	auto err = deserialize_binary_row(ctx, meta, actual);
 	EXPECT_EQ(err, make_error_code(GetParam().expected));
 }
@@ -261,6 +261,68 @@ INSTANTIATE_TEST_SUITE_P(Default, DeserializeBinaryRowErrorTest, testing::Values
 	BinaryRowErrorParam("extra_bytes", {0x00, 0x00, 0x01, 0x02}, errc::extra_bytes, {protocol_field_type::tiny})
 ), test_name_generator);
 
+// binary_row_plan
+TEST(BinaryRowPlanTest, ResultsetMetadata_OneDecoderPerField)
+{
+	auto meta = make_meta({protocol_field_type::tiny, protocol_field_type::var_string, protocol_field_type::tiny});
+	const auto& plan = meta.binary_plan();
+	ASSERT_EQ(plan.size(), 3);
+	EXPECT_EQ(plan[0], get_binary_value_decoder(protocol_field_type::tiny, false));
+	EXPECT_EQ(plan[1], get_binary_value_decoder(protocol_field_type::var_string, false));
+	EXPECT_EQ(plan[2], plan[0]);
+	EXPECT_NE(plan[0], plan[1]);
+}
+
+TEST(BinaryRowPlanTest, ResultsetMetadata_TakesSignednessIntoAccount)
+{
+	column_definition_packet coldef;
+	coldef.type = protocol_field_type::longlong;
+	coldef.flags.value = column_flags::unsigned_;
+	std::pmr::vector<boost::mysql::field_metadata> fields { boost::mysql::field_metadata(coldef) };
+	resultset_metadata meta ({}, {}, std::move(fields));
+	ASSERT_EQ(meta.binary_plan().size(), 1);
+	EXPECT_EQ(meta.binary_plan()[0], get_binary_value_decoder(protocol_field_type::longlong, true));
+	EXPECT_NE(meta.binary_plan()[0], get_binary_value_decoder(protocol_field_type::longlong, false));
+}
+
+TEST(BinaryRowPlanTest, DefaultResultsetMetadata_EmptyPlan)
+{
+	EXPECT_TRUE(resultset_metadata().binary_plan().empty());
+}
+
+TEST(BinaryRowPlanTest, Projection_SkipsFieldsNotProjected)
+{
+	auto meta = make_meta({
+		protocol_field_type::tiny,
+		protocol_field_type::var_string,
+		protocol_field_type::datetime,
+		protocol_field_type::double_
+	});
+	meta.set_projection({true, false, false, true});
+	EXPECT_EQ(meta.binary_plan()[0], get_binary_value_decoder(protocol_field_type::tiny, false));
+	EXPECT_EQ(meta.binary_plan()[1], get_binary_value_skipper(protocol_field_type::var_string));
+	std::vector<std::uint8_t> buffer {
+		0x00, 0x00, // header, null bitmap
+		0x14, // tiny
+		0x02, 0x61, 0x62, // var_string
+		0x04, 0xda, 0x07, 0x0a, 0x01, // datetime
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x3f // double
+	};
+	deserialization_context ctx (buffer.data(), buffer.data() + buffer.size(), capabilities());
+	std::pmr::vector<value> actual;
+	auto err = deserialize_binary_row(ctx, meta, actual);
+	EXPECT_EQ(err, error_code());
+	EXPECT_EQ(actual, makerow(std::int32_t(20), nullptr, nullptr, 1.0).values());
+}
+
+TEST(BinaryRowPlanTest, EmptyProjection_DecodesAllFields)
+{
+	auto meta = make_meta({protocol_field_type::tiny, protocol_field_type::var_string});
+	meta.set_projection({false, true});
+	meta.set_projection({});
+	EXPECT_EQ(meta.binary_plan()[0], get_binary_value_decoder(protocol_field_type::tiny, false));
+	EXPECT_TRUE(meta.is_projected(0));
+}
 
 } // anon namespace
 
@@ -11,6 +11,7 @@
 #include <boost/asio/buffer.hpp>
 #include <algorithm>
 #include "boost/mysql/detail/protocol/channel.hpp"
+#include "boost/mysql/row_batch.hpp"
 #include "test_common.hpp"
 
 using namespace testing;
@@ -263,6 +264,397 @@ TEST_F(MysqlChannelReadTest, SyncRead_SequenceNumberFF_SequenceNumberWraps)
 }
 
 
+TEST_F(MysqlChannelReadTest, SyncRead_SeveralPacketsInOneRead_ReadsStreamOnce)
+{
+	bytes_to_read = {
+		0x02, 0x00, 0x00, 0x00, 0x01, 0x02,
+		0x03, 0x00, 0x00, 0x01, 0x03, 0x04, 0x05,
+		0x00, 0x00, 0x00, 0x02
+	};
+	EXPECT_CALL(stream, read_buffer)
+		.WillOnce(Invoke(make_read_handler()));
+	chan.read(buffer, code);
+	EXPECT_EQ(code, error_code());
+	verify_buffer({0x01, 0x02});
+	chan.read(buffer, code);
+	EXPECT_EQ(code, error_code());
+	verify_buffer({0x03, 0x04, 0x05});
+	chan.read(buffer, code);
+	EXPECT_EQ(code, error_code());
+	verify_buffer({});
+	EXPECT_EQ(chan.pending_read_size(), 0);
+}
+
+TEST_F(MysqlChannelReadTest, SyncRead_ReadContainsNextPacket_KeepsItPending)
+{
+	bytes_to_read = {
+		0x02, 0x00, 0x00, 0x00, 0x01, 0x02,
+		0x03, 0x00
+	};
+	EXPECT_CALL(stream, read_buffer)
+		.WillOnce(Invoke(make_read_handler()));
+	chan.read(buffer, code);
+	EXPECT_EQ(code, error_code());
+	verify_buffer({0x01, 0x02});
+	EXPECT_EQ(chan.pending_read_size(), 2);
+}
+
+TEST_F(MysqlChannelReadTest, SyncRead_HeaderSplitAcrossReads_JoinsHeader)
+{
+	EXPECT_CALL(stream, read_buffer)
+		.WillOnce(Invoke(buffer_copier({0x02, 0x00, 0x00, 0x00, 0x01, 0x02, 0x02, 0x00})))
+		.WillOnce(Invoke(buffer_copier({0x00, 0x01, 0x03, 0x04})));
+	chan.read(buffer, code);
+	EXPECT_EQ(code, error_code());
+	verify_buffer({0x01, 0x02});
+	chan.read(buffer, code);
+	EXPECT_EQ(code, error_code());
+	verify_buffer({0x03, 0x04});
+}
+
+TEST_F(MysqlChannelReadTest, SyncRead_PacketBiggerThanReadBuffer_ReadsDirectlyIntoDestination)
+{
+	MockChannel small_chan (stream, 8);
+	bytes_to_read = {0x0a, 0x00, 0x00, 0x00};
+	concat(bytes_to_read, std::vector<uint8_t>(10, 0x20));
+	ON_CALL(stream, read_buffer)
+		.WillByDefault(Invoke(make_read_handler()));
+	small_chan.read(buffer, code);
+	EXPECT_EQ(code, error_code());
+	verify_buffer(std::vector<uint8_t>(10, 0x20));
+	EXPECT_EQ(small_chan.pending_read_size(), 0);
+}
+
+TEST_F(MysqlChannelReadTest, SyncRead_RowBatchPacketBuffer_ReadsStraightIntoBatch)
+{
+	bytes_to_read = {0x02, 0x00, 0x00, 0x00, 0x61, 0x62, 0x03, 0x00, 0x00, 0x01, 0x63, 0x64, 0x65};
+	ON_CALL(stream, read_buffer)
+		.WillByDefault(Invoke(make_read_handler()));
+	boost::mysql::row_batch batch (1);
+	boost::mysql::row_batch::packet_buffer packet (batch);
+	chan.read(packet, code);
+	EXPECT_EQ(code, error_code());
+	auto packet1 = batch.pending_packet();
+	ASSERT_EQ(packet1.size(), 2);
+	batch.append_row(boost::mysql::test::makerow("ab").values());
+	chan.read(packet, code);
+	EXPECT_EQ(code, error_code());
+	auto packet2 = batch.pending_packet();
+	auto first2 = static_cast<const std::uint8_t*>(packet2.data());
+	EXPECT_EQ(bytestring(first2, first2 + packet2.size()), (bytestring{0x63, 0x64, 0x65}));
+	EXPECT_EQ(static_cast<const std::uint8_t*>(packet1.data()) + 2, packet2.data()); // same chunk, no copies
+}
+
+// Compressed protocol
+bytestring make_compressed_frame(const bytestring& packets, std::uint8_t seqnum = 0)
+{
+	bytestring res;
+	compressor(boost::mysql::compression_algorithm::zlib, 0).append_frames(buffer(packets), seqnum, res);
+	return res;
+}
+
+TEST_F(MysqlChannelReadTest, SyncRead_CompressedUncompressedFrame_ReadsAllPackets)
+{
+	chan.enable_compression(boost::mysql::compression_algorithm::zlib, 50);
+	bytes_to_read = {
+		0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // frame header, not compressed
+		0x02, 0x00, 0x00, 0x00, 0x01, 0x02,
+		0x03, 0x00, 0x00, 0x01, 0x03, 0x04, 0x05
+	};
+	EXPECT_CALL(stream, read_buffer)
+		.WillOnce(Invoke(make_read_handler()));
+	chan.read(buffer, code);
+	EXPECT_EQ(code, error_code());
+	verify_buffer({0x01, 0x02});
+	chan.read(buffer, code);
+	EXPECT_EQ(code, error_code());
+	verify_buffer({0x03, 0x04, 0x05});
+	EXPECT_EQ(chan.pending_read_size(), 0);
+}
+
+TEST_F(MysqlChannelReadTest, SyncRead_CompressedFrame_Decompresses)
+{
+	chan.enable_compression(boost::mysql::compression_algorithm::zlib, 50);
+	bytestring packet {0xc8, 0x00, 0x00, 0x00};
+	concat(packet, bytestring(200, 0x61));
+	bytes_to_read = make_compressed_frame(packet);
+	ASSERT_LT(bytes_to_read.size(), packet.size()); // it was actually compressed
+	ON_CALL(stream, read_buffer)
+		.WillByDefault(Invoke(make_read_handler()));
+	chan.read(buffer, code);
+	EXPECT_EQ(code, error_code());
+	verify_buffer(bytestring(200, 0x61));
+}
+
+TEST_F(MysqlChannelReadTest, SyncRead_CompressedPacketSplitAcrossFrames_JoinsPacket)
+{
+	chan.enable_compression(boost::mysql::compression_algorithm::zlib, 50);
+	bytestring packet {0xc8, 0x00, 0x00, 0x00};
+	concat(packet, bytestring(200, 0x61));
+	bytes_to_read = make_compressed_frame(bytestring(packet.begin(), packet.begin() + 100), 0);
+	concat(bytes_to_read, make_compressed_frame(bytestring(packet.begin() + 100, packet.end()), 1));
+	ON_CALL(stream, read_buffer)
+		.WillByDefault(Invoke(make_read_handler()));
+	chan.read(buffer, code);
+	EXPECT_EQ(code, error_code());
+	verify_buffer(bytestring(200, 0x61));
+}
+
+TEST_F(MysqlChannelReadTest, SyncRead_CompressedFrameBiggerThanReadBuffer_ReadsAllPackets)
+{
+	MockChannel small_chan (stream, 8);
+	small_chan.enable_compression(boost::mysql::compression_algorithm::zlib, 50);
+	bytestring packets {0x0a, 0x00, 0x00, 0x00};
+	concat(packets, bytestring(10, 0x20));
+	concat(packets, {0x02, 0x00, 0x00, 0x01, 0x01, 0x02});
+	bytes_to_read = make_compressed_frame(packets);
+	ON_CALL(stream, read_buffer)
+		.WillByDefault(Invoke(make_read_handler()));
+	small_chan.read(buffer, code);
+	EXPECT_EQ(code, error_code());
+	verify_buffer(bytestring(10, 0x20));
+	small_chan.read(buffer, code);
+	EXPECT_EQ(code, error_code());
+	verify_buffer({0x01, 0x02});
+}
+
+TEST_F(MysqlChannelReadTest, SyncRead_CompressedFrameSequenceNumberMismatch_ReturnsError)
+{
+	chan.enable_compression(boost::mysql::compression_algorithm::zlib, 50);
+	bytes_to_read = {
+		0x05, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, // frame header, sequence number should be 0
+		0x01, 0x00, 0x00, 0x00, 0x01
+	};
+	ON_CALL(stream, read_buffer)
+		.WillByDefault(Invoke(make_read_handler()));
+	chan.read(buffer, code);
+	EXPECT_EQ(code, make_error_code(errc::sequence_number_mismatch));
+}
+
+TEST_F(MysqlChannelReadTest, SyncRead_CompressedPacketSequenceNumbers_NotChecked)
+{
+	// As libmysql does, the server resyncs packet sequence numbers to the
+	// frame ones when it flushes a frame: the second frame's packet repeats 0x01
+	chan.enable_compression(boost::mysql::compression_algorithm::zlib, 50);
+	bytes_to_read = {
+		0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x01, 0x00, 0x00, 0x00, 0x01,
+		0x01, 0x00, 0x00, 0x01, 0x02,
+		0x05, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+		0x01, 0x00, 0x00, 0x01, 0x03
+	};
+	ON_CALL(stream, read_buffer)
+		.WillByDefault(Invoke(make_read_handler()));
+	for (std::uint8_t expected: {0x01, 0x02, 0x03})
+	{
+		chan.read(buffer, code);
+		EXPECT_EQ(code, error_code());
+		verify_buffer({expected});
+	}
+}
+
+TEST_F(MysqlChannelReadTest, SyncWrite_CompressedAfterRead_ContinuesFrameSequenceNumber)
+{
+	chan.enable_compression(boost::mysql::compression_algorithm::zlib, 50);
+	bytes_to_read = {
+		0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x01, 0x00, 0x00, 0x00, 0x01,
+		0x01, 0x00, 0x00, 0x01, 0x02
+	};
+	bytestring bytes_written;
+	ON_CALL(stream, read_buffer)
+		.WillByDefault(Invoke(make_read_handler()));
+	ON_CALL(stream, write_buffer)
+		.WillByDefault(Invoke([&bytes_written](boost::asio::const_buffer b, error_code& ec) {
+			auto first = static_cast<const std::uint8_t*>(b.data());
+			bytes_written.insert(bytes_written.end(), first, first + b.size());
+			ec.clear();
+			return b.size();
+		}));
+	chan.read(buffer, code);
+	chan.read(buffer, code);
+	EXPECT_EQ(code, error_code());
+	chan.write(boost::asio::buffer(bytestring{0xaa}), code);
+	EXPECT_EQ(code, error_code());
+	EXPECT_EQ(bytes_written, (bytestring{
+		0x05, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, // one frame was read
+		0x01, 0x00, 0x00, 0x01, 0xaa
+	}));
+	EXPECT_EQ(chan.sequence_number(), 0x02);
+}
+
+TEST_F(MysqlChannelReadTest, SyncRead_CompressedFrameCorrupted_ReturnsError)
+{
+	chan.enable_compression(boost::mysql::compression_algorithm::zlib, 50);
+	bytes_to_read = {
+		0x03, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, // compressed frame header
+		0x01, 0x02, 0x03 // not valid zlib data
+	};
+	ON_CALL(stream, read_buffer)
+		.WillByDefault(Invoke(make_read_handler()));
+	chan.read(buffer, code);
+	EXPECT_EQ(code, make_error_code(errc::protocol_value_error));
+}
+
+// Incremental packet reads
+TEST_F(MysqlChannelReadTest, SyncReadPacketSome_SmallChunks_ReadsWholePacket)
+{
+	bytes_to_read = {0x05, 0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x03, 0x00, 0x00, 0x01};
+	ON_CALL(stream, read_buffer)
+		.WillByDefault(Invoke(make_read_handler()));
+	EXPECT_EQ(chan.begin_read_packet(code), 5);
+	EXPECT_EQ(code, error_code());
+	EXPECT_FALSE(chan.packet_complete());
+	std::array<std::uint8_t, 2> chunk {};
+	EXPECT_EQ(chan.read_packet_some(boost::asio::buffer(chunk), code), 2);
+	EXPECT_EQ(chunk, (std::array<std::uint8_t, 2>{0x01, 0x02}));
+	EXPECT_EQ(chan.read_packet_some(boost::asio::buffer(chunk), code), 2);
+	EXPECT_EQ(chunk, (std::array<std::uint8_t, 2>{0x03, 0x04}));
+	EXPECT_EQ(chan.read_packet_some(boost::asio::buffer(chunk), code), 1);
+	EXPECT_EQ(chunk[0], 0x05);
+	EXPECT_TRUE(chan.packet_complete());
+	EXPECT_EQ(chan.read_packet_some(boost::asio::buffer(chunk), code), 0);
+	EXPECT_EQ(code, error_code());
+	EXPECT_EQ(chan.pending_read_size(), 4); // the next packet's header is kept
+}
+
+TEST_F(MysqlChannelReadTest, SyncReadPacketSome_MoreThan16M_CrossesFrames)
+{
+	concat(bytes_to_read, {0xff, 0xff, 0xff, 0x00});
+	concat(bytes_to_read, std::vector<uint8_t>(0xffffff, 0x20));
+	concat(bytes_to_read, {0x02, 0x00, 0x00, 0x01, 0x21, 0x21});
+	ON_CALL(stream, read_buffer)
+		.WillByDefault(Invoke(make_read_handler()));
+	EXPECT_EQ(chan.begin_read_packet(code), 0xffffff);
+	std::vector<uint8_t> contents;
+	std::vector<uint8_t> chunk (100000);
+	while (std::size_t size = chan.read_packet_some(boost::asio::buffer(chunk), code))
+	{
+		ASSERT_EQ(code, error_code());
+		contents.insert(contents.end(), chunk.begin(), chunk.begin() + size);
+	}
+	EXPECT_EQ(code, error_code());
+	std::vector<uint8_t> expected (0xffffff, 0x20);
+	concat(expected, {0x21, 0x21});
+	EXPECT_EQ(contents, expected);
+	EXPECT_TRUE(chan.packet_complete());
+}
+
+TEST_F(MysqlChannelReadTest, SyncReadPacketSome_MultipleOf16M_ReadsEmptyLastFrame)
+{
+	concat(bytes_to_read, {0xff, 0xff, 0xff, 0x00});
+	concat(bytes_to_read, std::vector<uint8_t>(0xffffff, 0x20));
+	concat(bytes_to_read, {0x00, 0x00, 0x00, 0x01});
+	ON_CALL(stream, read_buffer)
+		.WillByDefault(Invoke(make_read_handler()));
+	chan.begin_read_packet(code);
+	std::vector<uint8_t> chunk (0xffffff);
+	std::size_t total = 0;
+	while (total < 0xffffff)
+	{
+		std::size_t size = chan.read_packet_some(boost::asio::buffer(chunk) + total, code);
+		ASSERT_NE(size, 0);
+		total += size;
+	}
+	EXPECT_FALSE(chan.packet_complete());
+	EXPECT_EQ(chan.read_packet_some(boost::asio::buffer(chunk), code), 0);
+	EXPECT_EQ(code, error_code());
+	EXPECT_TRUE(chan.packet_complete());
+	EXPECT_EQ(chan.sequence_number(), 2);
+}
+
+TEST_F(MysqlChannelReadTest, SyncReadPacketSome_BiggerThanReadBuffer_ReadsDirectlyIntoDestination)
+{
+	MockChannel small_chan (stream, 8);
+	bytes_to_read = {0x14, 0x00, 0x00, 0x00};
+	concat(bytes_to_read, std::vector<uint8_t>(20, 0x20));
+	ON_CALL(stream, read_buffer)
+		.WillByDefault(Invoke(make_read_handler()));
+	small_chan.begin_read_packet(code);
+	std::size_t pending = small_chan.pending_read_size();
+	std::vector<uint8_t> chunk (20);
+	EXPECT_EQ(small_chan.read_packet_some(boost::asio::buffer(chunk), code), pending); // buffered bytes go first
+	EXPECT_CALL(stream, read_buffer(Property(&mutable_buffer::size, 20 - pending), _))
+		.WillOnce(Invoke(make_read_handler()));
+	EXPECT_EQ(small_chan.read_packet_some(boost::asio::buffer(chunk) + pending, code), 20 - pending);
+	EXPECT_EQ(chunk, std::vector<uint8_t>(20, 0x20));
+	EXPECT_TRUE(small_chan.packet_complete());
+}
+
+TEST_F(MysqlChannelReadTest, SyncReadPacketSome_Compressed_ReadsWholePacket)
+{
+	chan.enable_compression(boost::mysql::compression_algorithm::zlib, 50);
+	bytestring packet {0xc8, 0x00, 0x00, 0x00};
+	concat(packet, bytestring(200, 0x61));
+	bytes_to_read = make_compressed_frame(packet);
+	ON_CALL(stream, read_buffer)
+		.WillByDefault(Invoke(make_read_handler()));
+	EXPECT_EQ(chan.begin_read_packet(code), 200);
+	std::vector<uint8_t> chunk (300);
+	EXPECT_EQ(chan.read_packet_some(boost::asio::buffer(chunk), code), 200);
+	EXPECT_EQ(std::vector<uint8_t>(chunk.begin(), chunk.begin() + 200), bytestring(200, 0x61));
+	EXPECT_TRUE(chan.packet_complete());
+}
+
+TEST_F(MysqlChannelReadTest, SyncReadPacketSome_ReadError_ReturnsFailureErrorCode)
+{
+	EXPECT_CALL(stream, read_buffer)
+		.WillOnce(Invoke(buffer_copier({0x05, 0x00, 0x00, 0x00, 0x01})))
+		.WillOnce(Invoke(read_failer(make_error_code(boost::system::errc::timed_out))));
+	chan.begin_read_packet(code);
+	std::vector<uint8_t> chunk (5);
+	EXPECT_EQ(chan.read_packet_some(boost::asio::buffer(chunk), code), 1);
+	EXPECT_EQ(chan.read_packet_some(boost::asio::buffer(chunk), code), 0);
+	EXPECT_EQ(code, make_error_code(boost::system::errc::timed_out));
+}
+
+TEST_F(MysqlChannelReadTest, Stats_SeveralPacketsInOneRead_CountsPacketsAndReads)
+{
+	bytes_to_read = {
+		0x02, 0x00, 0x00, 0x00, 0x01, 0x02,
+		0x03, 0x00, 0x00, 0x01, 0x03, 0x04, 0x05
+	};
+	EXPECT_CALL(stream, read_buffer)
+		.WillOnce(Invoke(make_read_handler()));
+	chan.read(buffer, code);
+	chan.read(buffer, code);
+	EXPECT_EQ(code, error_code());
+	auto stats = chan.stats();
+	EXPECT_EQ(stats.packets_read, 2);
+	EXPECT_EQ(stats.bytes_read, 13);
+	EXPECT_EQ(stats.read_calls, 1);
+	EXPECT_EQ(stats.multiframe_packets_read, 0);
+	EXPECT_EQ(stats.packets_written, 0);
+	EXPECT_EQ(stats.read_buffer_capacity, default_read_buffer_size);
+}
+
+TEST_F(MysqlChannelReadTest, Stats_MoreThan16M_CountsMultiframePacket)
+{
+	ON_CALL(stream, read_buffer)
+		.WillByDefault(Invoke(make_read_handler()));
+	concat(bytes_to_read, {0xff, 0xff, 0xff, 0x00});
+	concat(bytes_to_read, std::vector<uint8_t>(0xffffff, 0x20));
+	concat(bytes_to_read, {0x00, 0x00, 0x00, 0x01});
+	chan.read(buffer, code);
+	EXPECT_EQ(code, error_code());
+	auto stats = chan.stats();
+	EXPECT_EQ(stats.packets_read, 1);
+	EXPECT_EQ(stats.multiframe_packets_read, 1);
+	EXPECT_EQ(stats.bytes_read, bytes_to_read.size());
+	EXPECT_GE(stats.buffer_reallocations, 1);
+}
+
+TEST_F(MysqlChannelReadTest, Stats_BufferBigEnough_NoReallocations)
+{
+	ON_CALL(stream, read_buffer)
+		.WillByDefault(Invoke(make_read_handler()));
+	bytes_to_read = {0x03, 0x00, 0x00, 0x00, 0xfe, 0x03, 0x02};
+	buffer.reserve(16);
+	chan.read(buffer, code);
+	EXPECT_EQ(code, error_code());
+	EXPECT_EQ(chan.stats().buffer_reallocations, 0);
+}
+
 struct MysqlChannelWriteTest : public MysqlChannelFixture
 {
 	std::vector<uint8_t> bytes_written;
@@ -385,5 +777,159 @@ TEST_F(MysqlChannelWriteTest, SyncWrite_SequenceIsFF_WrapsSequenceNumber)
 	EXPECT_EQ(chan.sequence_number(), 0);
 }
 
-} // anon namespace
+TEST_F(MysqlChannelWriteTest, SyncWriteFramed_SeveralPackets_WritesBufferUnmodified)
+{
+	ON_CALL(stream, write_buffer)
+		.WillByDefault(Invoke(make_write_handler()));
+	chan.reset_sequence_number(0x05);
+	chan.write_framed(buffer(std::vector<uint8_t>{
+		0x01, 0x00, 0x00, 0x00, 0xaa,
+		0x01, 0x00, 0x00, 0x00, 0xab
+	}), code);
+	verify_buffer({
+		0x01, 0x00, 0x00, 0x00, 0xaa,
+		0x01, 0x00, 0x00, 0x00, 0xab
+	});
+	EXPECT_EQ(code, error_code());
+	EXPECT_EQ(chan.sequence_number(), 0x05); // not modified
+}
+
+TEST_F(MysqlChannelWriteTest, SyncWriteFramed_WriteError_ReturnsErrorCode)
+{
+	ON_CALL(stream, write_buffer)
+		.WillByDefault(Invoke(write_failer(boost::system::errc::broken_pipe)));
+	chan.write_framed(buffer(std::vector<uint8_t>(10, 0x01)), code);
+	EXPECT_EQ(code, make_error_code(boost::system::errc::broken_pipe));
+}
+
+TEST(MysqlChannelAppendFramed, SeveralMessages_AppendsHeadersAndBodies)
+{
+	bytestring output;
+	auto seqnum1 = append_framed(buffer(bytestring{0xaa, 0xab}), 0, output);
+	auto seqnum2 = append_framed(buffer(bytestring{0xac}), 0, output);
+	EXPECT_EQ(output, (bytestring{
+		0x02, 0x00, 0x00, 0x00, 0xaa, 0xab,
+		0x01, 0x00, 0x00, 0x00, 0xac
+	}));
+	EXPECT_EQ(seqnum1, 1);
+	EXPECT_EQ(seqnum2, 1);
+}
+
+TEST(MysqlChannelAppendFramed, EmptyMessage_AppendsHeader)
+{
+	bytestring output {0x01};
+	auto seqnum = append_framed(buffer(bytestring{}), 3, output);
+	EXPECT_EQ(output, (bytestring{0x01, 0x00, 0x00, 0x00, 0x03}));
+	EXPECT_EQ(seqnum, 4);
+}
+
+TEST(MysqlChannelAppendFramed, MoreThan16M_SplitsInPackets)
+{
+	bytestring output;
+	auto seqnum = append_framed(buffer(bytestring(0xffffff + 4, 0xab)), 0, output);
+	bytestring expected {0xff, 0xff, 0xff, 0x00};
+	concat(expected, bytestring(0xffffff, 0xab));
+	concat(expected, {0x04, 0x00, 0x00, 0x01});
+	concat(expected, bytestring(4, 0xab));
+	EXPECT_EQ(output, expected);
+	EXPECT_EQ(seqnum, 2);
+}
+
+TEST_F(MysqlChannelWriteTest, SyncWrite_CompressedBelowThreshold_WritesUncompressedFrame)
+{
+	chan.enable_compression(boost::mysql::compression_algorithm::zlib, 50);
+	chan.reset_sequence_number(0x02);
+	ON_CALL(stream, write_buffer)
+		.WillByDefault(Invoke(make_write_handler()));
+	chan.write(buffer(std::vector<uint8_t>{0xaa, 0xab, 0xac}), code);
+	verify_buffer({
+		0x07, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, // frame header
+		0x03, 0x00, 0x00, 0x02, // packet header
+		0xaa, 0xab, 0xac // body
+	});
+	EXPECT_EQ(code, error_code());
+	EXPECT_EQ(chan.sequence_number(), 0x03);
+}
 
+TEST_F(MysqlChannelWriteTest, SyncWrite_CompressedAboveThreshold_WritesCompressedFrame)
+{
+	chan.enable_compression(boost::mysql::compression_algorithm::zlib, 50);
+	ON_CALL(stream, write_buffer)
+		.WillByDefault(Invoke(make_write_handler()));
+	chan.write(buffer(std::vector<uint8_t>(200, 0x61)), code);
+	EXPECT_EQ(code, error_code());
+
+	// Header
+	ASSERT_GT(bytes_written.size(), 7);
+	std::size_t compressed_size = bytes_written[0] | (bytes_written[1] << 8) | (bytes_written[2] << 16);
+	EXPECT_EQ(compressed_size, bytes_written.size() - 7);
+	EXPECT_LT(compressed_size, 200);
+	EXPECT_EQ(bytes_written[3], 0x00); // sequence number
+	EXPECT_EQ(std::vector<uint8_t>(bytes_written.begin() + 4, bytes_written.begin() + 7),
+			(std::vector<uint8_t>{0xcc, 0x00, 0x00})); // uncompressed size
+
+	// Payload
+	bytestring decompressed (204);
+	auto err = compressor(boost::mysql::compression_algorithm::zlib, 50).decompress(
+		buffer(bytes_written.data() + 7, compressed_size), buffer(decompressed));
+	EXPECT_EQ(err, error_code());
+	bytestring expected {0xc8, 0x00, 0x00, 0x00};
+	concat(expected, bytestring(200, 0x61));
+	EXPECT_EQ(decompressed, expected);
+}
+
+TEST_F(MysqlChannelWriteTest, SyncWriteFramed_Compressed_WritesFramesPerCommand)
+{
+	chan.enable_compression(boost::mysql::compression_algorithm::zlib, 50);
+	ON_CALL(stream, write_buffer)
+		.WillByDefault(Invoke(make_write_handler()));
+	chan.write_framed(buffer(std::vector<uint8_t>{
+		0x01, 0x00, 0x00, 0x00, 0xaa,
+		0x01, 0x00, 0x00, 0x01, 0xab,
+		0x01, 0x00, 0x00, 0x00, 0xac
+	}), code);
+	verify_buffer({
+		0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // first command
+		0x01, 0x00, 0x00, 0x00, 0xaa,
+		0x01, 0x00, 0x00, 0x01, 0xab,
+		0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // second command
+		0x01, 0x00, 0x00, 0x00, 0xac
+	});
+	EXPECT_EQ(code, error_code());
+}
+
+TEST_F(MysqlChannelWriteTest, Stats_Write_CountsPacketsAndBytes)
+{
+	ON_CALL(stream, write_buffer)
+		.WillByDefault(Invoke(make_write_handler()));
+	chan.write(buffer(std::vector<uint8_t>{0xaa, 0xab, 0xac}), code);
+	chan.write(buffer(std::vector<uint8_t>(0xffffff, 0xab)), code);
+	EXPECT_EQ(code, error_code());
+	auto stats = chan.stats();
+	EXPECT_EQ(stats.packets_written, 2);
+	EXPECT_EQ(stats.multiframe_packets_written, 1);
+	EXPECT_EQ(stats.bytes_written, bytes_written.size());
+	EXPECT_EQ(stats.packets_read, 0);
+	EXPECT_EQ(stats.read_calls, 0);
+}
+
+TEST_F(MysqlChannelWriteTest, Stats_WriteFramed_CountsEveryPacket)
+{
+	ON_CALL(stream, write_buffer)
+		.WillByDefault(Invoke(make_write_handler()));
+	std::vector<uint8_t> framed {
+		0x01, 0x00, 0x00, 0x00, 0xaa,
+		0x00, 0x00, 0x00, 0x00,
+		0xff, 0xff, 0xff, 0x00
+	};
+	concat(framed, std::vector<uint8_t>(0xffffff, 0xab));
+	concat(framed, {0x01, 0x00, 0x00, 0x01, 0xac});
+	chan.write_framed(buffer(framed), code);
+	EXPECT_EQ(code, error_code());
+	auto stats = chan.stats();
+	EXPECT_EQ(stats.packets_written, 3);
+	EXPECT_EQ(stats.multiframe_packets_written, 1);
+	EXPECT_EQ(stats.bytes_written, framed.size());
+}
+
+} // anon namespace
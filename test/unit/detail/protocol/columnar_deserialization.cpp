@@ -0,0 +1,159 @@
+#include <gtest/gtest.h>
+#include "boost/mysql/detail/protocol/columnar_deserialization.hpp"
+#include "test_common.hpp"
+
+using namespace boost::mysql::detail;
+using namespace boost::mysql::test;
+using boost::mysql::column_batch;
+using boost::mysql::error_code;
+using boost::mysql::errc;
+using boost::mysql::field_metadata;
+
+namespace
+{
+
+struct ColumnarDeserializationTest : public testing::Test
+{
+	resultset_metadata meta;
+	column_batch batch;
+
+	void set_fields(std::pmr::vector<field_metadata> fields)
+	{
+		meta = resultset_metadata({}, {}, std::move(fields));
+		batch = column_batch(meta.fields());
+	}
+
+	error_code deserialize(const bytestring& buffer, bool binary)
+	{
+		deserialization_context ctx (buffer.data(), buffer.data() + buffer.size(), capabilities());
+		auto plan = make_binary_columnar_plan(meta.fields());
+		return deserialize_columnar_row(ctx, meta, binary ? &plan : nullptr, batch);
+	}
+};
+
+TEST_F(ColumnarDeserializationTest, Text_AllKinds_DecodesIntoColumns)
+{
+	set_fields({
+		makefield(protocol_field_type::long_),
+		makefield(protocol_field_type::longlong, column_flags::unsigned_),
+		makefield(protocol_field_type::float_),
+		makefield(protocol_field_type::date),
+		makefield(protocol_field_type::datetime, 0, 6),
+		makefield(protocol_field_type::time),
+		makefield(protocol_field_type::var_string)
+	});
+	bytestring row {0x02, 0x2d, 0x37}; // -7
+	concat(row, {0x14}); // 18446744073709551615
+	concat(row, boost::asio::buffer(std::string_view("18446744073709551615")));
+	concat(row, {0x04, 0x2d, 0x34, 0x2e, 0x32}); // -4.2
+	concat(row, {0x0a});
+	concat(row, boost::asio::buffer(std::string_view("2010-03-28")));
+	concat(row, {0x1a});
+	concat(row, boost::asio::buffer(std::string_view("2010-05-02 23:01:50.100000")));
+	concat(row, {0x0a});
+	concat(row, boost::asio::buffer(std::string_view("-120:02:03")));
+	concat(row, {0x03, 0x61, 0x62, 0x63});
+	EXPECT_EQ(deserialize(row, false), error_code());
+	ASSERT_EQ(batch.size(), 1);
+	EXPECT_EQ(batch[0].int64_values()[0], -7);
+	EXPECT_EQ(batch[1].uint64_values()[0], 0xffffffffffffffff);
+	EXPECT_EQ(batch[2].double_values()[0], double(-4.2f));
+	EXPECT_EQ(batch[3].int64_values()[0], makedate(2010, 3, 28).time_since_epoch().count());
+	EXPECT_EQ(batch[4].int64_values()[0], makedt(2010, 5, 2, 23, 1, 50, 100000).time_since_epoch().count());
+	EXPECT_EQ(batch[5].int64_values()[0], (-maket(120, 2, 3)).count());
+	EXPECT_EQ(batch[6].string_value(0), "abc");
+	for (const auto& col: batch.columns())
+	{
+		ASSERT_EQ(col.size(), 1);
+		EXPECT_FALSE(col.is_null(0));
+	}
+}
+
+TEST_F(ColumnarDeserializationTest, Text_SeveralRows_AppendsWithNulls)
+{
+	set_fields({ makefield(protocol_field_type::long_), makefield(protocol_field_type::var_string) });
+	EXPECT_EQ(deserialize({0x01, 0x31, 0xfb}, false), error_code());
+	EXPECT_EQ(deserialize({0xfb, 0x01, 0x61}, false), error_code());
+	ASSERT_EQ(batch.size(), 2);
+	EXPECT_EQ(batch[0].int64_values(), std::pmr::vector<std::int64_t>({1, 0}));
+	EXPECT_FALSE(batch[0].is_null(0));
+	EXPECT_TRUE(batch[0].is_null(1));
+	EXPECT_TRUE(batch[1].is_null(0));
+	EXPECT_EQ(batch[1].string_value(1), "a");
+}
+
+TEST_F(ColumnarDeserializationTest, Text_InvalidValue_DiscardsRow)
+{
+	set_fields({ makefield(protocol_field_type::var_string), makefield(protocol_field_type::long_) });
+	EXPECT_EQ(deserialize({0x01, 0x61, 0x01, 0x31}, false), error_code());
+	EXPECT_EQ(deserialize({0x01, 0x62, 0x01, 0x78}, false), make_error_code(errc::protocol_value_error));
+	EXPECT_EQ(deserialize({0x01, 0x63, 0x01, 0x32, 0x00}, false), make_error_code(errc::extra_bytes));
+	EXPECT_EQ(batch.size(), 1);
+	EXPECT_EQ(batch[0].size(), 1);
+	EXPECT_EQ(batch[0].string_data().size(), 1);
+	EXPECT_EQ(batch[1].size(), 1);
+}
+
+TEST_F(ColumnarDeserializationTest, Text_Projection_SkipsFields)
+{
+	set_fields({ makefield(protocol_field_type::long_), makefield(protocol_field_type::long_) });
+	meta.set_projection({false, true});
+	EXPECT_EQ(deserialize({0x01, 0x78, 0x01, 0x35}, false), error_code()); // first one is invalid
+	EXPECT_TRUE(batch[0].is_null(0));
+	EXPECT_EQ(batch[1].int64_values()[0], 5);
+}
+
+TEST_F(ColumnarDeserializationTest, Binary_AllKinds_DecodesIntoColumns)
+{
+	set_fields({
+		makefield(protocol_field_type::tiny),
+		makefield(protocol_field_type::tiny, column_flags::unsigned_),
+		makefield(protocol_field_type::year, column_flags::unsigned_),
+		makefield(protocol_field_type::double_),
+		makefield(protocol_field_type::date),
+		makefield(protocol_field_type::datetime),
+		makefield(protocol_field_type::time),
+		makefield(protocol_field_type::var_string),
+		makefield(protocol_field_type::long_)
+	});
+	bytestring row {0x00, 0x00, 0x04}; // header, null bitmap (last field is NULL)
+	concat(row, {0xff}); // -1
+	concat(row, {0xff}); // 255
+	concat(row, {0xe3, 0x07}); // 2019
+	concat(row, {0xcd, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0x10, 0xc0}); // -4.2
+	concat(row, {0x04, 0xda, 0x07, 0x03, 0x1c});
+	concat(row, {0x0b, 0xda, 0x07, 0x05, 0x02, 0x17, 0x01, 0x32, 0xa0, 0x86, 0x01, 0x00});
+	concat(row, {0x0c, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xa0, 0x86, 0x01, 0x00});
+	concat(row, {0x02, 0x61, 0x62});
+	EXPECT_EQ(deserialize(row, true), error_code());
+	ASSERT_EQ(batch.size(), 1);
+	EXPECT_EQ(batch[0].int64_values()[0], -1);
+	EXPECT_EQ(batch[1].uint64_values()[0], 255);
+	EXPECT_EQ(batch[2].uint64_values()[0], 2019);
+	EXPECT_EQ(batch[3].double_values()[0], -4.2);
+	EXPECT_EQ(batch[4].int64_values()[0], makedate(2010, 3, 28).time_since_epoch().count());
+	EXPECT_EQ(batch[5].int64_values()[0], makedt(2010, 5, 2, 23, 1, 50, 100000).time_since_epoch().count());
+	EXPECT_EQ(batch[6].int64_values()[0], maket(120, 2, 3, 100000).count());
+	EXPECT_EQ(batch[7].string_value(0), "ab");
+	EXPECT_TRUE(batch[8].is_null(0));
+}
+
+TEST_F(ColumnarDeserializationTest, Binary_Projection_SkipsFields)
+{
+	set_fields({ makefield(protocol_field_type::var_string), makefield(protocol_field_type::long_) });
+	meta.set_projection({false, true});
+	EXPECT_EQ(deserialize({0x00, 0x00, 0x02, 0x61, 0x62, 0x05, 0x00, 0x00, 0x00}, true), error_code());
+	EXPECT_TRUE(batch[0].is_null(0));
+	EXPECT_TRUE(batch[0].string_data().empty());
+	EXPECT_EQ(batch[1].int64_values()[0], 5);
+}
+
+TEST_F(ColumnarDeserializationTest, Binary_Truncated_DiscardsRow)
+{
+	set_fields({ makefield(protocol_field_type::tiny), makefield(protocol_field_type::long_) });
+	EXPECT_EQ(deserialize({0x00, 0x00, 0x01, 0x02, 0x00}, true), make_error_code(errc::incomplete_message));
+	EXPECT_TRUE(batch.empty());
+	EXPECT_EQ(batch[0].size(), 0);
+}
+
+} // anon namespace
@@ -0,0 +1,126 @@
+#include <gtest/gtest.h>
+#include "boost/mysql/detail/protocol/compression.hpp"
+#include "test_common.hpp"
+
+using namespace boost::mysql::detail;
+using boost::mysql::compression_algorithm;
+using boost::mysql::error_code;
+using boost::mysql::errc;
+using boost::mysql::test::concat;
+
+namespace
+{
+
+compressed_frame_header read_header(const bytestring& frames, std::size_t offset = 0)
+{
+	compressed_frame_header res;
+	deserialization_context ctx (boost::asio::buffer(frames) + offset, capabilities(0));
+	EXPECT_EQ(deserialize(res, ctx), errc::ok);
+	return res;
+}
+
+bytestring decompress_frame(const compressor& comp, const bytestring& frames, std::size_t offset = 0)
+{
+	auto header = read_header(frames, offset);
+	bytestring res (header.uncompressed_size.value);
+	auto err = comp.decompress(
+		boost::asio::buffer(frames.data() + offset + compressed_frame_header_size, header.compressed_size.value),
+		boost::asio::buffer(res)
+	);
+	EXPECT_EQ(err, error_code());
+	return res;
+}
+
+TEST(Compressor, AppendFrames_BelowThreshold_SendsUncompressed)
+{
+	compressor comp (compression_algorithm::zlib, 50);
+	bytestring output {0xff}; // verify we append
+	comp.append_frames(boost::asio::buffer(bytestring(49, 0x61)), 3, output);
+	bytestring expected {0xff, 0x31, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00};
+	concat(expected, bytestring(49, 0x61));
+	EXPECT_EQ(output, expected);
+}
+
+TEST(Compressor, AppendFrames_Compressible_SendsCompressed)
+{
+	compressor comp (compression_algorithm::zlib, 50);
+	bytestring input (1000, 0x61);
+	bytestring output;
+	comp.append_frames(boost::asio::buffer(input), 0, output);
+	auto header = read_header(output);
+	EXPECT_EQ(header.compressed_size.value, output.size() - compressed_frame_header_size);
+	EXPECT_LT(header.compressed_size.value, 1000);
+	EXPECT_EQ(header.sequence_number.value, 0);
+	EXPECT_EQ(header.uncompressed_size.value, 1000);
+	EXPECT_EQ(decompress_frame(comp, output), input);
+}
+
+TEST(Compressor, AppendFrames_NotCompressible_SendsUncompressed)
+{
+	compressor comp (compression_algorithm::zlib, 0);
+	bytestring input {0x01, 0x02, 0x03}; // zlib overhead makes it bigger
+	bytestring output;
+	comp.append_frames(boost::asio::buffer(input), 0, output);
+	EXPECT_EQ(output, (bytestring{0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x03}));
+}
+
+TEST(Compressor, AppendFrames_Empty_SendsEmptyFrame)
+{
+	compressor comp (compression_algorithm::zlib, 0);
+	bytestring output;
+	comp.append_frames(boost::asio::buffer(bytestring()), 2, output);
+	EXPECT_EQ(output, (bytestring{0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00}));
+}
+
+TEST(Compressor, AppendFrames_MoreThan16M_SplitsInFrames)
+{
+	compressor comp (compression_algorithm::zlib, 50);
+	bytestring input (0xffffff + 100, 0x61);
+	bytestring output;
+	comp.append_frames(boost::asio::buffer(input), 0, output);
+
+	auto header1 = read_header(output);
+	EXPECT_EQ(header1.sequence_number.value, 0);
+	EXPECT_EQ(header1.uncompressed_size.value, 0xffffff);
+	EXPECT_EQ(decompress_frame(comp, output), bytestring(0xffffff, 0x61));
+
+	std::size_t offset = compressed_frame_header_size + header1.compressed_size.value;
+	auto header2 = read_header(output, offset);
+	EXPECT_EQ(header2.sequence_number.value, 1);
+	EXPECT_EQ(header2.uncompressed_size.value, 100);
+	EXPECT_EQ(decompress_frame(comp, output, offset), bytestring(100, 0x61));
+	EXPECT_EQ(offset + compressed_frame_header_size + header2.compressed_size.value, output.size());
+}
+
+TEST(Compressor, NumCompressedFrames_MatchesAppendFrames)
+{
+	EXPECT_EQ(num_compressed_frames(0), 1);
+	EXPECT_EQ(num_compressed_frames(100), 1);
+	EXPECT_EQ(num_compressed_frames(0xffffff), 1);
+	EXPECT_EQ(num_compressed_frames(0xffffff + 1), 2);
+	EXPECT_EQ(num_compressed_frames(2 * 0xffffff + 1), 3);
+}
+
+TEST(Compressor, Decompress_CorruptedPayload_ReturnsError)
+{
+	compressor comp (compression_algorithm::zlib, 50);
+	bytestring payload {0x01, 0x02, 0x03};
+	bytestring output (10);
+	auto err = comp.decompress(boost::asio::buffer(payload), boost::asio::buffer(output));
+	EXPECT_EQ(err, make_error_code(errc::protocol_value_error));
+}
+
+TEST(Compressor, Decompress_SizeMismatch_ReturnsError)
+{
+	compressor comp (compression_algorithm::zlib, 0);
+	bytestring frames;
+	comp.append_frames(boost::asio::buffer(bytestring(100, 0x61)), 0, frames);
+	bytestring output (101); // one more than the actual size
+	auto err = comp.decompress(
+		boost::asio::buffer(frames) + compressed_frame_header_size,
+		boost::asio::buffer(output)
+	);
+	EXPECT_EQ(err, make_error_code(errc::protocol_value_error));
+}
+
+} // anon namespace
@@ -100,7 +100,8 @@ INSTANTIATE_TEST_SUITE_P(HandhsakeResponse, SerializeTest, ::testing::Values(
 		string_null("root"),
 		string_lenenc(makesv(handshake_response_auth_data)),
 		string_null(""), // Irrelevant, not using connect with DB
-		string_null("mysql_native_password") // auth plugin name
+		string_null("mysql_native_password"), // auth plugin name
+		int1(0) // Irrelevant, not using zstd compression
 	}, {
 		0x85, 0xa6, 0xff, 0x01, 0x00, 0x00, 0x00, 0x01,
 		0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
@@ -121,7 +122,8 @@ INSTANTIATE_TEST_SUITE_P(HandhsakeResponse, SerializeTest, ::testing::Values(
 		string_null("root"),
 		string_lenenc(makesv(handshake_response_auth_data)),
 		string_null("database"), // database name
-		string_null("mysql_native_password") // auth plugin name
+		string_null("mysql_native_password"), // auth plugin name
+		int1(0) // Irrelevant, not using zstd compression
 	}, {
 		0x8d, 0xa6, 0xff, 0x01, 0x00, 0x00, 0x00, 0x01,
 		0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
@@ -135,7 +137,44 @@ INSTANTIATE_TEST_SUITE_P(HandhsakeResponse, SerializeTest, ::testing::Values(
 		0x5f, 0x6e, 0x61, 0x74, 0x69, 0x76, 0x65, 0x5f,
 		0x70, 0x61, 0x73, 0x73, 0x77, 0x6f, 0x72, 0x64,
 		0x00
-	}, "with_database", handshake_response_caps | CLIENT_CONNECT_WITH_DB)
+	}, "with_database", handshake_response_caps | CLIENT_CONNECT_WITH_DB),
+
+	serialization_testcase(handshake_response_packet{
+		int4(handshake_response_caps | CLIENT_ZSTD_COMPRESSION_ALGORITHM),
+		int4(16777216), // max packet size
+		int1(static_cast<std::uint8_t>(collation::utf8_general_ci)),
+		string_null("root"),
+		string_lenenc(makesv(handshake_response_auth_data)),
+		string_null(""), // Irrelevant, not using connect with DB
+		string_null("mysql_native_password"), // auth plugin name
+		int1(3) // zstd compression level
+	}, {
+		0x85, 0xa6, 0xff, 0x05, 0x00, 0x00, 0x00, 0x01,
+		0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x72, 0x6f, 0x6f, 0x74, 0x00, 0x14, 0xfe, 0xc6,
+		0x2c, 0x9f, 0xab, 0x43, 0x69, 0x46, 0xc5, 0x51,
+		0x35, 0xa5, 0xff, 0xdb, 0x3f, 0x48, 0xe6, 0xfc,
+		0x34, 0xc9, 0x6d, 0x79, 0x73, 0x71, 0x6c, 0x5f,
+		0x6e, 0x61, 0x74, 0x69, 0x76, 0x65, 0x5f, 0x70,
+		0x61, 0x73, 0x73, 0x77, 0x6f, 0x72, 0x64, 0x00,
+		0x03
+	}, "with_zstd_compression", handshake_response_caps | CLIENT_ZSTD_COMPRESSION_ALGORITHM)
+), test_name_generator);
+
+INSTANTIATE_TEST_SUITE_P(SslRequest, SerializeTest, ::testing::Values(
+	serialization_testcase(ssl_request_packet{
+		int4(handshake_response_caps | CLIENT_SSL),
+		int4(16777216), // max packet size
+		int1(static_cast<std::uint8_t>(collation::utf8_general_ci)),
+		{} // filler
+	}, {
+		0x85, 0xae, 0xff, 0x01, 0x00, 0x00, 0x00, 0x01,
+		0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+	}, "regular", handshake_response_caps | CLIENT_SSL)
 ), test_name_generator);
 
 constexpr std::uint8_t auth_switch_request_auth_data [] = {
@@ -33,7 +33,17 @@ INSTANTIATE_TEST_SUITE_P(ComStmtPrepareResponse, DeserializeSpaceTest, testing::
 	}, {
 		0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x03, 0x00,
 		0x00, 0x00, 0x00
-	}, "regular")
+	}, "regular"),
+	serialization_testcase(com_stmt_prepare_ok_packet{
+		int4(1), // statement id
+		int2(2), // number of fields
+		int2(3), // number of params
+		int2(0), // warnings
+		int1(0) // metadata_follows: none
+	}, {
+		0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x03, 0x00,
+		0x00, 0x00, 0x00, 0x00
+	}, "optional_metadata", CLIENT_OPTIONAL_RESULTSET_METADATA)
 ), test_name_generator);
 
 // Helper for composing ComStmtExecute tests
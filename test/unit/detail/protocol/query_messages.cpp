@@ -17,4 +17,24 @@ INSTANTIATE_TEST_SUITE_P(ComQuery, SerializeTest, testing::Values(
 	}, "regular")
 ), test_name_generator);
 
+INSTANTIATE_TEST_SUITE_P(ResultsetHead, DeserializeSpaceTest, testing::Values(
+	serialization_testcase(resultset_head_packet{
+		int_lenenc(3) // number of columns
+	}, {
+		0x03
+	}, "regular"),
+	serialization_testcase(resultset_head_packet{
+		int_lenenc(0x100), // number of columns
+		int1(1) // metadata_follows: full
+	}, {
+		0xfc, 0x00, 0x01, 0x01
+	}, "optional_metadata_full", CLIENT_OPTIONAL_RESULTSET_METADATA),
+	serialization_testcase(resultset_head_packet{
+		int_lenenc(3), // number of columns
+		int1(0) // metadata_follows: none
+	}, {
+		0x03, 0x00
+	}, "optional_metadata_none", CLIENT_OPTIONAL_RESULTSET_METADATA)
+), test_name_generator);
+
 }
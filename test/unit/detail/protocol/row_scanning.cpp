@@ -0,0 +1,233 @@
+#include <gtest/gtest.h>
+#include "boost/mysql/detail/protocol/row_scanning.hpp"
+#include "test_common.hpp"
+
+using namespace boost::mysql::detail;
+using boost::mysql::errc;
+using boost::mysql::field_metadata;
+using boost::mysql::test::concat;
+using boost::mysql::test::makefield;
+
+namespace
+{
+
+struct RowScanningTest : public testing::Test
+{
+	std::pmr::vector<field_metadata> meta;
+	field_location loc;
+
+	errc locate(const bytestring& prefix, std::size_t field_index, bool binary)
+	{
+		return locate_field(boost::asio::buffer(prefix), meta, field_index, binary, loc);
+	}
+};
+
+TEST_F(RowScanningTest, Text_FirstField_LocatesValue)
+{
+	meta = { makefield(protocol_field_type::var_string), makefield(protocol_field_type::long_) };
+	EXPECT_EQ(locate({0x03, 0x61, 0x62, 0x63, 0x02, 0x34, 0x32}, 0, false), errc::ok);
+	EXPECT_EQ(loc.bytes_needed, 0);
+	EXPECT_EQ(loc.header_offset, 0);
+	EXPECT_EQ(loc.value_offset, 1);
+	EXPECT_EQ(loc.value_size, 3);
+	EXPECT_FALSE(loc.is_null);
+}
+
+TEST_F(RowScanningTest, Text_FieldAfterOthers_SkipsPreviousValues)
+{
+	meta = {
+		makefield(protocol_field_type::long_),
+		makefield(protocol_field_type::var_string),
+		makefield(protocol_field_type::blob)
+	};
+	EXPECT_EQ(locate({0x02, 0x34, 0x32, 0xfb, 0xfc, 0x00, 0x01}, 2, false), errc::ok);
+	EXPECT_EQ(loc.bytes_needed, 0);
+	EXPECT_EQ(loc.header_offset, 4);
+	EXPECT_EQ(loc.value_offset, 7);
+	EXPECT_EQ(loc.value_size, 0x100);
+}
+
+TEST_F(RowScanningTest, Text_Null_LocatesNull)
+{
+	meta = { makefield(protocol_field_type::blob) };
+	EXPECT_EQ(locate({0xfb}, 0, false), errc::ok);
+	EXPECT_TRUE(loc.is_null);
+	EXPECT_EQ(loc.header_offset, 0);
+	EXPECT_EQ(loc.value_offset, 1);
+	EXPECT_EQ(loc.value_size, 0);
+}
+
+TEST_F(RowScanningTest, Text_ShortPrefix_RequestsMissingBytes)
+{
+	meta = { makefield(protocol_field_type::long_), makefield(protocol_field_type::blob) };
+	EXPECT_EQ(locate({}, 1, false), errc::ok);
+	EXPECT_EQ(loc.bytes_needed, 1);
+	EXPECT_EQ(locate({0x02}, 1, false), errc::ok);
+	EXPECT_EQ(loc.bytes_needed, 2);
+	EXPECT_EQ(locate({0x02, 0x34, 0x32}, 1, false), errc::ok);
+	EXPECT_EQ(loc.bytes_needed, 1);
+	EXPECT_EQ(locate({0x02, 0x34, 0x32, 0xfe}, 1, false), errc::ok);
+	EXPECT_EQ(loc.bytes_needed, 8);
+}
+
+TEST_F(RowScanningTest, Text_EightByteLength_LocatesValue)
+{
+	meta = { makefield(protocol_field_type::long_blob) };
+	EXPECT_EQ(locate({0xfe, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00}, 0, false), errc::ok);
+	EXPECT_EQ(loc.bytes_needed, 0);
+	EXPECT_EQ(loc.value_offset, 9);
+	EXPECT_EQ(loc.value_size, 0x1000000);
+}
+
+TEST_F(RowScanningTest, Text_InvalidLength_ReturnsError)
+{
+	meta = { makefield(protocol_field_type::long_), makefield(protocol_field_type::blob) };
+	EXPECT_EQ(locate({0xff, 0x00}, 1, false), errc::protocol_value_error);
+}
+
+TEST_F(RowScanningTest, Binary_FieldAfterOthers_SkipsPreviousValues)
+{
+	meta = {
+		makefield(protocol_field_type::long_),
+		makefield(protocol_field_type::datetime),
+		makefield(protocol_field_type::var_string),
+		makefield(protocol_field_type::blob)
+	};
+	bytestring row {0x00, 0x00}; // header, null bitmap
+	concat(row, {0x01, 0x02, 0x03, 0x04}); // long
+	concat(row, {0x04, 0xda, 0x07, 0x0a, 0x01}); // datetime
+	concat(row, {0x02, 0x61, 0x62}); // var_string
+	concat(row, {0x03, 0x61}); // blob, partial
+	EXPECT_EQ(locate(row, 3, true), errc::ok);
+	EXPECT_EQ(loc.bytes_needed, 0);
+	EXPECT_EQ(loc.header_offset, 14);
+	EXPECT_EQ(loc.value_offset, 15);
+	EXPECT_EQ(loc.value_size, 3);
+	EXPECT_FALSE(loc.is_null);
+}
+
+TEST_F(RowScanningTest, Binary_Nulls_SkipsNullsAndLocatesNull)
+{
+	meta = {
+		makefield(protocol_field_type::longlong),
+		makefield(protocol_field_type::blob),
+		makefield(protocol_field_type::blob)
+	};
+	// field 0 is NULL (bit 2), field 2 is NULL (bit 4)
+	EXPECT_EQ(locate({0x00, 0x14, 0x01, 0x61}, 1, true), errc::ok);
+	EXPECT_EQ(loc.header_offset, 2);
+	EXPECT_EQ(loc.value_size, 1);
+	EXPECT_EQ(locate({0x00, 0x14, 0x01, 0x61}, 2, true), errc::ok);
+	EXPECT_TRUE(loc.is_null);
+	EXPECT_EQ(loc.header_offset, 4);
+	EXPECT_EQ(loc.value_offset, 4);
+}
+
+TEST_F(RowScanningTest, Binary_ShortPrefix_RequestsMissingBytes)
+{
+	meta = { makefield(protocol_field_type::double_), makefield(protocol_field_type::blob) };
+	EXPECT_EQ(locate({0x00}, 1, true), errc::ok);
+	EXPECT_EQ(loc.bytes_needed, 1); // null bitmap
+	EXPECT_EQ(locate({0x00, 0x00, 0x01}, 1, true), errc::ok);
+	EXPECT_EQ(loc.bytes_needed, 7); // rest of the double
+}
+
+// split_row
+struct SplitRowTest : public testing::Test
+{
+	std::pmr::vector<field_metadata> meta;
+	std::vector<field_bounds> bounds;
+	bytestring row;
+
+	errc split(bool binary)
+	{
+		bounds.assign(meta.size(), field_bounds());
+		deserialization_context ctx (row.data(), row.data() + row.size(), capabilities());
+		return split_row(ctx, meta, binary, bounds.data());
+	}
+
+	std::size_t offset(std::size_t field_index) const
+	{
+		return bounds[field_index].data - reinterpret_cast<const char*>(row.data());
+	}
+};
+
+TEST_F(SplitRowTest, Text_SeveralFields_SplitsValues)
+{
+	meta = {
+		makefield(protocol_field_type::long_),
+		makefield(protocol_field_type::var_string),
+		makefield(protocol_field_type::datetime)
+	};
+	row = {0x02, 0x34, 0x32, 0xfb, 0x03, 0x61, 0x62, 0x63};
+	EXPECT_EQ(split(false), errc::ok);
+	EXPECT_EQ(bounds[0].value(), "42");
+	EXPECT_TRUE(bounds[1].is_null());
+	EXPECT_EQ(bounds[2].value(), "abc");
+	EXPECT_EQ(offset(2), 5);
+}
+
+TEST_F(SplitRowTest, Text_ExtraBytes_ReturnsError)
+{
+	meta = { makefield(protocol_field_type::long_) };
+	row = {0x01, 0x34, 0x00};
+	EXPECT_EQ(split(false), errc::extra_bytes);
+}
+
+TEST_F(SplitRowTest, Text_Truncated_ReturnsError)
+{
+	meta = { makefield(protocol_field_type::long_), makefield(protocol_field_type::long_) };
+	row = {0x01, 0x34, 0x02, 0x34};
+	EXPECT_EQ(split(false), errc::incomplete_message);
+}
+
+TEST_F(SplitRowTest, Binary_SeveralFields_BoundsIncludeLengthPrefix)
+{
+	meta = {
+		makefield(protocol_field_type::long_),
+		makefield(protocol_field_type::datetime),
+		makefield(protocol_field_type::var_string),
+		makefield(protocol_field_type::double_),
+		makefield(protocol_field_type::blob)
+	};
+	row = {0x00, 0x20}; // header, null bitmap (field 3 is NULL)
+	concat(row, {0x01, 0x02, 0x03, 0x04}); // long
+	concat(row, {0x04, 0xda, 0x07, 0x0a, 0x01}); // datetime
+	concat(row, {0x02, 0x61, 0x62}); // var_string
+	concat(row, {0x01, 0x61}); // blob
+	EXPECT_EQ(split(true), errc::ok);
+	EXPECT_EQ(offset(0), 2);
+	EXPECT_EQ(bounds[0].size, 4);
+	EXPECT_EQ(offset(1), 6);
+	EXPECT_EQ(bounds[1].size, 5);
+	EXPECT_EQ(offset(2), 11);
+	EXPECT_EQ(bounds[2].size, 3);
+	EXPECT_TRUE(bounds[3].is_null());
+	EXPECT_EQ(offset(4), 14);
+	EXPECT_EQ(bounds[4].size, 2);
+}
+
+TEST_F(SplitRowTest, Binary_Truncated_ReturnsError)
+{
+	meta = { makefield(protocol_field_type::long_), makefield(protocol_field_type::var_string) };
+	row = {0x00, 0x00, 0x01, 0x02, 0x03, 0x04, 0x03, 0x61};
+	EXPECT_EQ(split(true), errc::incomplete_message);
+}
+
+TEST_F(SplitRowTest, Binary_ExtraBytes_ReturnsError)
+{
+	meta = { makefield(protocol_field_type::tiny) };
+	row = {0x00, 0x00, 0x01, 0x02};
+	EXPECT_EQ(split(true), errc::extra_bytes);
+}
+
+TEST(RowScanning, IsStreamableField_StringTypes_ReturnsTrue)
+{
+	EXPECT_TRUE(is_streamable_field(makefield(protocol_field_type::blob)));
+	EXPECT_TRUE(is_streamable_field(makefield(protocol_field_type::var_string)));
+	EXPECT_TRUE(is_streamable_field(makefield(protocol_field_type::newdecimal)));
+	EXPECT_FALSE(is_streamable_field(makefield(protocol_field_type::long_)));
+	EXPECT_FALSE(is_streamable_field(makefield(protocol_field_type::datetime)));
+}
+
+} // anon namespace
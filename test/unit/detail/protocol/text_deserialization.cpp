@@ -8,6 +8,7 @@
 #include <gtest/gtest.h>
 #include "boost/mysql/detail/protocol/text_deserialization.hpp"
 #include "test_common.hpp"
+#include <cstdio>
 
 using namespace boost::mysql::detail;
 using namespace boost::mysql::test;
@@ -168,6 +169,13 @@ INSTANTIATE_TEST_SUITE_P(DOUBLE, DeserializeTextValueTest, Values(
 	TextValueParam("negative_exponent_negative_fractional", "-3.45e-20", -3.45e-20, protocol_field_type::double_)
 ), test_name_generator);
 
+INSTANTIATE_TEST_SUITE_P(DOUBLE_ROUNDING, DeserializeTextValueTest, Values(
+	TextValueParam("shortest_repr", "0.1", 0.1, protocol_field_type::double_),
+	TextValueParam("max_digits", "0.30000000000000004", 0.30000000000000004, protocol_field_type::double_),
+	TextValueParam("denormal", "5e-324", 5e-324, protocol_field_type::double_),
+	TextValueParam("max", "1.7976931348623157e308", 1.7976931348623157e308, protocol_field_type::double_)
+), test_name_generator);
+
 INSTANTIATE_TEST_SUITE_P(DATE, DeserializeTextValueTest, Values(
 	TextValueParam("regular_date", "2019-02-28", boost::mysql::date(2019_y/2/28), protocol_field_type::date),
 	TextValueParam("leap_year", "1788-02-29", boost::mysql::date(1788_y/2/29), protocol_field_type::date),
@@ -293,9 +301,172 @@ INSTANTIATE_TEST_SUITE_P(YEAR, DeserializeTextValueTest, Values(
 	TextValueParam("zero", "0000", std::uint32_t(0), protocol_field_type::year, column_flags::unsigned_)
 ), test_name_generator);
 
+// Malformed values. expected is not used
+struct DeserializeTextValueErrorTest : public TestWithParam<TextValueParam> {};
+
+TEST_P(DeserializeTextValueErrorTest, BadFormat_ReturnsError)
+{
+	column_definition_packet coldef;
+	coldef.type = GetParam().type;
+	coldef.decimals.value = static_cast<std::uint8_t>(GetParam().decimals);
+	coldef.flags.value = GetParam().flags;
+	boost::mysql::field_metadata meta (coldef);
+	value actual_value;
+	auto err = deserialize_text_value(GetParam().from, meta, actual_value);
+	EXPECT_EQ(err, errc::protocol_value_error);
+}
+
+INSTANTIATE_TEST_SUITE_P(Numbers, DeserializeTextValueErrorTest, Values(
+	TextValueParam("int_empty", "", nullptr, protocol_field_type::long_),
+	TextValueParam("int_trailing_chars", "12a", nullptr, protocol_field_type::long_),
+	TextValueParam("int_leading_chars", "a12", nullptr, protocol_field_type::long_),
+	TextValueParam("int_leading_space", " 12", nullptr, protocol_field_type::long_),
+	TextValueParam("int_fractional", "1.5", nullptr, protocol_field_type::long_),
+	TextValueParam("int_sign_only", "-", nullptr, protocol_field_type::long_),
+	TextValueParam("int_overflow", "2147483648", nullptr, protocol_field_type::long_),
+	TextValueParam("uint_overflow", "4294967296", nullptr, protocol_field_type::long_, column_flags::unsigned_),
+	TextValueParam("uint_negative", "-1", nullptr, protocol_field_type::long_, column_flags::unsigned_),
+	TextValueParam("bigint_overflow", "9223372036854775808", nullptr, protocol_field_type::longlong),
+	TextValueParam("ubigint_overflow", "18446744073709551616", nullptr,
+			protocol_field_type::longlong, column_flags::unsigned_),
+	TextValueParam("float_empty", "", nullptr, protocol_field_type::float_),
+	TextValueParam("float_trailing_chars", "3.14x", nullptr, protocol_field_type::float_),
+	TextValueParam("float_overflow", "3.5e38", nullptr, protocol_field_type::float_),
+	TextValueParam("double_empty", "", nullptr, protocol_field_type::double_),
+	TextValueParam("double_trailing_chars", "3.14 ", nullptr, protocol_field_type::double_),
+	TextValueParam("double_exponent_only", "e10", nullptr, protocol_field_type::double_),
+	TextValueParam("double_overflow", "1e309", nullptr, protocol_field_type::double_)
+), test_name_generator);
+
+INSTANTIATE_TEST_SUITE_P(DateTime, DeserializeTextValueErrorTest, Values(
+	TextValueParam("date_zero", "0000-00-00", nullptr, protocol_field_type::date),
+	TextValueParam("date_zero_month", "2019-00-10", nullptr, protocol_field_type::date),
+	TextValueParam("date_zero_day", "2019-10-00", nullptr, protocol_field_type::date),
+	TextValueParam("date_bad_separator", "2019/10/10", nullptr, protocol_field_type::date),
+	TextValueParam("date_sign", "+019-10-10", nullptr, protocol_field_type::date),
+	TextValueParam("date_space", " 019-10-10", nullptr, protocol_field_type::date),
+	TextValueParam("date_short_month", "2019-1-100", nullptr, protocol_field_type::date),
+	TextValueParam("date_below_min", "0099-12-31", nullptr, protocol_field_type::date),
+	TextValueParam("date_too_long", "2019-10-100", nullptr, protocol_field_type::date),
+	TextValueParam("date_non_leap", "2100-02-29", nullptr, protocol_field_type::date),
+	TextValueParam("datetime_zero", "0000-00-00 00:00:00", nullptr, protocol_field_type::datetime),
+	TextValueParam("datetime_bad_separator", "2010-02-15T02:05:30", nullptr, protocol_field_type::datetime),
+	TextValueParam("datetime_hour_24", "2010-02-15 24:00:00", nullptr, protocol_field_type::datetime),
+	TextValueParam("datetime_minute_60", "2010-02-15 02:60:00", nullptr, protocol_field_type::datetime),
+	TextValueParam("datetime_missing_decimals", "2010-02-15 02:05:30", nullptr, protocol_field_type::datetime, 0, 3),
+	TextValueParam("datetime_extra_decimals", "2010-02-15 02:05:30.12", nullptr, protocol_field_type::datetime, 0, 1),
+	TextValueParam("datetime_bad_dot", "2010-02-15 02:05:30,1", nullptr, protocol_field_type::datetime, 0, 1),
+	TextValueParam("time_empty", "", nullptr, protocol_field_type::time),
+	TextValueParam("time_one_hour_digit", "1:00:00", nullptr, protocol_field_type::time),
+	TextValueParam("time_four_hour_digits", "1000:00:00", nullptr, protocol_field_type::time),
+	TextValueParam("time_out_of_range", "839:00:01", nullptr, protocol_field_type::time),
+	TextValueParam("time_negative_out_of_range", "-839:00:01", nullptr, protocol_field_type::time),
+	TextValueParam("time_minute_60", "10:60:00", nullptr, protocol_field_type::time),
+	TextValueParam("time_second_60", "10:00:60", nullptr, protocol_field_type::time),
+	TextValueParam("time_double_sign", "--10:00:00", nullptr, protocol_field_type::time),
+	TextValueParam("time_plus_sign", "+10:00:00", nullptr, protocol_field_type::time),
+	TextValueParam("time_missing_decimals", "10:00:00", nullptr, protocol_field_type::time, 0, 2),
+	TextValueParam("time_unexpected_decimals", "10:00:00.12", nullptr, protocol_field_type::time),
+	TextValueParam("time_bad_decimals", "10:00:00.1a", nullptr, protocol_field_type::time, 0, 2)
+), test_name_generator);
+
+// Checks dates against date::year_month_day, for every month and day
+// (including invalid ones) of years around leap and range boundaries,
+// and for February and December of every year
+TEST(DeserializeTextDateTest, ManyDates_MatchesYearMonthDay)
+{
+	auto check = [](unsigned year, unsigned month, unsigned day) {
+		char buffer [16];
+		snprintf(buffer, sizeof(buffer), "%04u-%02u-%02u", year, month, day);
+		boost::mysql::date actual;
+		auto err = deserialize_text_value_impl(std::string_view(buffer), actual);
+		::date::year_month_day ymd {::date::year(year), ::date::month(month), ::date::day(day)};
+		if (ymd.ok() && ymd >= min_date && ymd <= max_date)
+		{
+			ASSERT_EQ(err, errc::ok) << buffer;
+			ASSERT_EQ(actual, boost::mysql::date(ymd)) << buffer;
+		}
+		else
+		{
+			ASSERT_EQ(err, errc::protocol_value_error) << buffer;
+		}
+	};
+	for (unsigned year: {0u, 1u, 99u, 100u, 101u, 1582u, 1600u, 1900u, 1969u, 1970u, 2000u, 2004u, 2100u, 2400u, 9998u, 9999u})
+	{
+		for (unsigned month = 0; month <= 13; ++month)
+		{
+			for (unsigned day = 0; day <= 32; ++day)
+			{
+				check(year, month, day);
+			}
+		}
+	}
+	for (unsigned year = 0; year <= 9999; ++year)
+	{
+		for (unsigned day: {1u, 28u, 29u, 30u})
+		{
+			check(year, 2, day);
+		}
+		check(year, 12, 31);
+	}
+}
+
+// Checks times with every number of decimals against arithmetic on std::chrono types
+TEST(DeserializeTextTimeTest, ManyTimes_MatchesChronoArithmetic)
+{
+	for (unsigned decimals = 0; decimals <= 6; ++decimals)
+	{
+		for (int hours = 0; hours <= 839; ++hours)
+		{
+			for (int minutes: {0, 1, 30, 59})
+			{
+				for (int seconds: {0, 59})
+				{
+					for (bool negative: {false, true})
+					{
+						int micros = decimals ? 123456 % static_cast<int>(std::pow(10, decimals)) : 0;
+						char buffer [32];
+						int size = snprintf(buffer, sizeof(buffer), "%s%02d:%02d:%02d", negative ? "-" : "", hours, minutes, seconds);
+						if (decimals)
+						{
+							snprintf(buffer + size, sizeof(buffer) - size, ".%0*d", static_cast<int>(decimals), micros);
+						}
+						boost::mysql::time actual;
+						auto err = deserialize_text_value_impl(std::string_view(buffer), actual, decimals);
+						auto expected = maket(hours, minutes, seconds, micros * static_cast<int>(std::pow(10, 6 - decimals)));
+						if (negative) expected = -expected;
+						if (expected >= min_time && expected <= max_time)
+						{
+							ASSERT_EQ(err, errc::ok) << buffer;
+							ASSERT_EQ(actual, expected) << buffer;
+						}
+						else
+						{
+							ASSERT_EQ(err, errc::protocol_value_error) << buffer;
+						}
+					}
+				}
+			}
+		}
+	}
+}
+
+TEST(DeserializeTextDatetimeTest, EveryHourOfLeapDay_MatchesChronoArithmetic)
+{
+	for (int hours = 0; hours < 24; ++hours)
+	{
+		char buffer [32];
+		snprintf(buffer, sizeof(buffer), "2020-02-29 %02d:59:58.000001", hours);
+		boost::mysql::datetime actual;
+		auto err = deserialize_text_value_impl(std::string_view(buffer), actual, 6);
+		ASSERT_EQ(err, errc::ok) << buffer;
+		EXPECT_EQ(actual, makedt(2020, 2, 29, hours, 59, 58, 1)) << buffer;
+	}
+}
+
 struct DeserializeTextRowTest : public Test
 {
-	std::vector<boost::mysql::field_metadata> meta {
+	std::pmr::vector<boost::mysql::field_metadata> meta {
 		column_definition_packet {
 			string_lenenc("def"),
 			string_lenenc("awesome"),
@@ -336,18 +507,19 @@ struct DeserializeTextRowTest : public Test
 			int1(2)
 		}
 	};
-	std::vector<value> values;
+	std::pmr::vector<value> values;
 
 	error_code deserialize(const std::vector<std::uint8_t>& buffer)
 	{
 		deserialization_context ctx (buffer.data(), buffer.data() + buffer.size(), capabilities());
-		return deserialize_text_row(ctx, meta, values);
+		resultset_metadata rs_meta ({}, {}, std::pmr::vector<boost::mysql::field_metadata>(meta));
+		return deserialize_text_row(ctx, rs_meta, values);
 	}
 };
 
 TEST_F(DeserializeTextRowTest, SameNumberOfValuesAsFieldsNonNulls_DeserializesReturnsOk)
 {
-	std::vector<value> expected_values {value("val"), value(std::int32_t(21)), value(makedt(2010, 10, 1))};
+	std::pmr::vector<value> expected_values {value("val"), value(std::int32_t(21)), value(makedt(2010, 10, 1))};
 	std::vector<std::uint8_t> buffer {
 		0x03, 0x76, 0x61, 0x6c, 0x02, 0x32, 0x31, 0x16,
 		0x32, 0x30, 0x31, 0x30, 0x2d, 0x31, 0x30, 0x2d,
@@ -361,7 +533,7 @@ TEST_F(DeserializeTextRowTest, SameNumberOfValuesAsFieldsNonNulls_DeserializesRe
 
 TEST_F(DeserializeTextRowTest, SameNumberOfValuesAsFieldsOneNull_DeserializesReturnsOk)
 {
-	std::vector<value> expected_values {value("val"), value(nullptr), value(makedt(2010, 10, 1))};
+	std::pmr::vector<value> expected_values {value("val"), value(nullptr), value(makedt(2010, 10, 1))};
 	std::vector<std::uint8_t> buffer {
 		0x03, 0x76, 0x61, 0x6c, 0xfb, 0x16, 0x32, 0x30,
 		0x31, 0x30, 0x2d, 0x31, 0x30, 0x2d, 0x30, 0x31,
@@ -375,7 +547,7 @@ TEST_F(DeserializeTextRowTest, SameNumberOfValuesAsFieldsOneNull_DeserializesRet
 
 TEST_F(DeserializeTextRowTest, SameNumberOfValuesAsFieldsAllNull_DeserializesReturnsOk)
 {
-	std::vector<value> expected_values {value(nullptr), value(nullptr), value(nullptr)};
+	std::pmr::vector<value> expected_values {value(nullptr), value(nullptr), value(nullptr)};
 	auto err = deserialize({0xfb, 0xfb, 0xfb});
 	EXPECT_EQ(err, error_code());
 	EXPECT_EQ(values, expected_values);
@@ -411,6 +583,199 @@ TEST_F(DeserializeTextRowTest, ErrorDeserializingContainerValue_ReturnsError)
 	EXPECT_EQ(err, make_error_code(errc::protocol_value_error));
 }
 
+TEST(DeserializeTextRowWideTest, ManyFields_DeserializesReturnsOk)
+{
+	constexpr std::size_t num_fields = 75;
+	column_definition_packet coldef;
+	coldef.type = protocol_field_type::var_string;
+	resultset_metadata meta ({}, {}, std::pmr::vector<boost::mysql::field_metadata>(num_fields, boost::mysql::field_metadata(coldef)));
+	std::vector<std::uint8_t> buffer;
+	std::pmr::vector<value> expected_values;
+	for (std::size_t i = 0; i < num_fields; ++i)
+	{
+		if (i % 7 == 3)
+		{
+			buffer.push_back(0xfb);
+			expected_values.emplace_back(nullptr);
+		}
+		else
+		{
+			buffer.push_back(1);
+			buffer.push_back(static_cast<std::uint8_t>('a' + i % 26));
+			expected_values.emplace_back(std::string_view("abcdefghijklmnopqrstuvwxyz").substr(i % 26, 1));
+		}
+	}
+	deserialization_context ctx (buffer.data(), buffer.data() + buffer.size(), capabilities());
+	std::pmr::vector<value> values;
+	auto err = deserialize_text_row(ctx, meta, values);
+	EXPECT_EQ(err, error_code());
+	EXPECT_EQ(values, expected_values);
+}
+
+TEST(DeserializeTextRowProjectionTest, FieldsNotProjected_ReportedAsNull)
+{
+	column_definition_packet coldef;
+	coldef.type = protocol_field_type::long_;
+	resultset_metadata meta ({}, {}, std::pmr::vector<boost::mysql::field_metadata>(3, boost::mysql::field_metadata(coldef)));
+	meta.set_projection({false, true, false});
+	std::vector<std::uint8_t> buffer {0x02, 0x31, 0x30, 0x02, 0x32, 0x30, 0x03, 0x61, 0x62, 0x63}; // last one is invalid
+	deserialization_context ctx (buffer.data(), buffer.data() + buffer.size(), capabilities());
+	std::pmr::vector<value> values;
+	auto err = deserialize_text_row(ctx, meta, values);
+	EXPECT_EQ(err, error_code());
+	EXPECT_EQ(values, makerow(nullptr, std::int32_t(20), nullptr).values());
+}
+
+// scan_text_field
+struct ScanTextFieldTest : public testing::Test
+{
+	std::vector<field_bounds> bounds;
+
+	// Scans num_fields fields, as deserialize_text_row does
+	errc scan(const std::vector<std::uint8_t>& buffer, std::size_t num_fields)
+	{
+		bounds.assign(num_fields, field_bounds());
+		deserialization_context ctx (buffer.data(), buffer.data() + buffer.size(), capabilities());
+		for (auto& field: bounds)
+		{
+			auto err = scan_text_field(ctx, field);
+			if (err != errc::ok) return err;
+		}
+		return ctx.empty() ? errc::ok : errc::extra_bytes;
+	}
+
+	// Field by field scan, as the deserializer used to do
+	static errc reference_scan(deserialization_context& ctx, std::size_t num_fields, std::vector<field_bounds>& output)
+	{
+		for (std::size_t i = 0; i < num_fields; ++i)
+		{
+			if (ctx.enough_size(1) && *ctx.first() == 0xfb)
+			{
+				ctx.advance(1);
+				output.push_back(field_bounds{nullptr, 0});
+				continue;
+			}
+			string_lenenc value;
+			auto err = deserialize(value, ctx);
+			if (err != errc::ok) return err;
+			output.push_back(field_bounds{value.value.data(), value.value.size()});
+		}
+		return errc::ok;
+	}
+};
+
+TEST_F(ScanTextFieldTest, OneByteLengths_LocatesFields)
+{
+	std::vector<std::uint8_t> buffer {0x02, 0x61, 0x62, 0x00, 0x01, 0x63};
+	EXPECT_EQ(scan(buffer, 3), errc::ok);
+	EXPECT_EQ(bounds[0].value(), "ab");
+	EXPECT_FALSE(bounds[0].is_null());
+	EXPECT_EQ(bounds[1].value(), "");
+	EXPECT_FALSE(bounds[1].is_null());
+	EXPECT_EQ(bounds[2].value(), "c");
+	EXPECT_EQ(bounds[2].value().data(), reinterpret_cast<const char*>(buffer.data() + 5));
+}
+
+TEST_F(ScanTextFieldTest, MultiByteLengths_LocatesFields)
+{
+	for (std::uint8_t marker: {0xfc, 0xfd, 0xfe})
+	{
+		std::size_t num_length_bytes = marker == 0xfc ? 2 : (marker == 0xfd ? 3 : 8);
+		std::vector<std::uint8_t> buffer {marker, 0x2c, 0x01}; // 300
+		buffer.resize(1 + num_length_bytes, 0);
+		buffer.resize(buffer.size() + 300, 0x61);
+		buffer.push_back(0xfb);
+		EXPECT_EQ(scan(buffer, 2), errc::ok) << int(marker);
+		EXPECT_EQ(bounds[0].value(), std::string(300, 'a')) << int(marker);
+		EXPECT_TRUE(bounds[1].is_null()) << int(marker);
+	}
+}
+
+TEST_F(ScanTextFieldTest, LengthByte0xff_TreatedAsOneByteLength)
+{
+	std::vector<std::uint8_t> buffer (256, 0x61);
+	buffer[0] = 0xff;
+	EXPECT_EQ(scan(buffer, 1), errc::ok);
+	EXPECT_EQ(bounds[0].value().size(), 255);
+}
+
+TEST_F(ScanTextFieldTest, NullRuns_LocatesFields)
+{
+	// 19 NULLs, a value, then 9 NULLs
+	std::vector<std::uint8_t> buffer (19, 0xfb);
+	buffer.push_back(0x01);
+	buffer.push_back(0x61);
+	buffer.resize(buffer.size() + 9, 0xfb);
+	EXPECT_EQ(scan(buffer, 29), errc::ok);
+	for (std::size_t i = 0; i < 29; ++i)
+	{
+		EXPECT_EQ(bounds[i].is_null(), i != 19) << i;
+	}
+	EXPECT_EQ(bounds[19].value(), "a");
+}
+
+TEST_F(ScanTextFieldTest, NullRunLongerThanFields_StopsAtLastField)
+{
+	std::vector<std::uint8_t> buffer (16, 0xfb);
+	EXPECT_EQ(scan(buffer, 10), errc::extra_bytes);
+	EXPECT_EQ(scan(buffer, 17), errc::incomplete_message);
+}
+
+TEST_F(ScanTextFieldTest, IncompleteMessage_ReturnsError)
+{
+	EXPECT_EQ(scan({}, 1), errc::incomplete_message);
+	EXPECT_EQ(scan({0x02, 0x61}, 1), errc::incomplete_message);
+	EXPECT_EQ(scan({0xfc, 0x01}, 1), errc::incomplete_message);
+	EXPECT_EQ(scan({0xfd, 0x01, 0x00, 0x00}, 1), errc::incomplete_message);
+	EXPECT_EQ(scan({0xfe, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, 1), errc::incomplete_message);
+	EXPECT_EQ(scan({0xfb, 0x01, 0x61}, 3), errc::incomplete_message);
+}
+
+TEST_F(ScanTextFieldTest, RandomRows_SameAsFieldByFieldScan)
+{
+	std::uint32_t state = 12345;
+	auto rnd = [&state](std::uint32_t max) {
+		state = state * 1103515245 + 12345;
+		return (state >> 16) % max;
+	};
+	for (int row = 0; row < 2000; ++row)
+	{
+		std::vector<std::uint8_t> buffer;
+		std::size_t num_fields = 1 + rnd(80);
+		for (std::size_t i = 0; i < num_fields; ++i)
+		{
+			auto kind = rnd(10);
+			if (kind < 4) buffer.push_back(0xfb);
+			else if (kind < 9)
+			{
+				auto len = rnd(40);
+				buffer.push_back(static_cast<std::uint8_t>(len));
+				buffer.resize(buffer.size() + len, 0xfb); // contents resembling NULL markers
+			}
+			else
+			{
+				buffer.insert(buffer.end(), {0xfc, 0x00, 0x01});
+				buffer.resize(buffer.size() + 256, 0x61);
+			}
+		}
+		buffer.resize(buffer.size() - std::min<std::size_t>(rnd(3), buffer.size())); // sometimes, truncated
+
+		deserialization_context ref_ctx (buffer.data(), buffer.data() + buffer.size(), capabilities());
+		std::vector<field_bounds> expected;
+		auto expected_err = reference_scan(ref_ctx, num_fields, expected);
+		if (expected_err == errc::ok && !ref_ctx.empty()) expected_err = errc::extra_bytes;
+
+		ASSERT_EQ(scan(buffer, num_fields), expected_err) << row;
+		if (expected_err != errc::ok) continue;
+		for (std::size_t i = 0; i < num_fields; ++i)
+		{
+			EXPECT_EQ(bounds[i].is_null(), expected[i].is_null()) << row << ", " << i;
+			EXPECT_EQ(bounds[i].data, expected[i].data) << row << ", " << i;
+			EXPECT_EQ(bounds[i].size, expected[i].size) << row << ", " << i;
+		}
+	}
+}
+
 }
 
 
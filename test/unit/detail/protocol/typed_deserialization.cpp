@@ -0,0 +1,241 @@
+#include <gtest/gtest.h>
+#include "boost/mysql/detail/protocol/typed_deserialization.hpp"
+#include "test_common.hpp"
+
+using namespace boost::mysql::detail;
+using namespace boost::mysql::test;
+using boost::mysql::error_code;
+using boost::mysql::error_info;
+using boost::mysql::errc;
+using boost::mysql::field_metadata;
+namespace mysql = boost::mysql;
+
+namespace
+{
+
+struct employee
+{
+	std::int64_t id;
+	std::optional<std::string> name;
+	double salary;
+};
+
+TEST(IsCompatibleField, Integers_DependOnWidthAndSignedness)
+{
+	EXPECT_TRUE(is_compatible_field<std::int8_t>(makefield(protocol_field_type::tiny)));
+	EXPECT_FALSE(is_compatible_field<std::uint8_t>(makefield(protocol_field_type::tiny)));
+	EXPECT_TRUE(is_compatible_field<std::uint8_t>(makefield(protocol_field_type::tiny, column_flags::unsigned_)));
+	EXPECT_FALSE(is_compatible_field<std::int8_t>(makefield(protocol_field_type::tiny, column_flags::unsigned_)));
+	EXPECT_TRUE(is_compatible_field<std::int16_t>(makefield(protocol_field_type::tiny, column_flags::unsigned_)));
+	EXPECT_TRUE(is_compatible_field<std::uint16_t>(makefield(protocol_field_type::year, column_flags::unsigned_)));
+	EXPECT_TRUE(is_compatible_field<std::int32_t>(makefield(protocol_field_type::int24, column_flags::unsigned_)));
+	EXPECT_TRUE(is_compatible_field<std::int32_t>(makefield(protocol_field_type::long_)));
+	EXPECT_FALSE(is_compatible_field<std::int32_t>(makefield(protocol_field_type::long_, column_flags::unsigned_)));
+	EXPECT_TRUE(is_compatible_field<std::int64_t>(makefield(protocol_field_type::long_, column_flags::unsigned_)));
+	EXPECT_FALSE(is_compatible_field<std::int64_t>(makefield(protocol_field_type::longlong, column_flags::unsigned_)));
+	EXPECT_TRUE(is_compatible_field<std::optional<std::uint64_t>>(makefield(protocol_field_type::longlong, column_flags::unsigned_)));
+	EXPECT_FALSE(is_compatible_field<std::int64_t>(makefield(protocol_field_type::double_)));
+	EXPECT_FALSE(is_compatible_field<std::int64_t>(makefield(protocol_field_type::var_string)));
+}
+
+TEST(IsCompatibleField, OtherTypes_RequireMatchingField)
+{
+	EXPECT_TRUE(is_compatible_field<float>(makefield(protocol_field_type::float_)));
+	EXPECT_FALSE(is_compatible_field<float>(makefield(protocol_field_type::double_)));
+	EXPECT_TRUE(is_compatible_field<double>(makefield(protocol_field_type::float_)));
+	EXPECT_TRUE(is_compatible_field<double>(makefield(protocol_field_type::double_)));
+	EXPECT_FALSE(is_compatible_field<double>(makefield(protocol_field_type::longlong)));
+	EXPECT_TRUE(is_compatible_field<mysql::date>(makefield(protocol_field_type::date)));
+	EXPECT_FALSE(is_compatible_field<mysql::date>(makefield(protocol_field_type::datetime)));
+	EXPECT_TRUE(is_compatible_field<mysql::datetime>(makefield(protocol_field_type::datetime)));
+	EXPECT_TRUE(is_compatible_field<mysql::datetime>(makefield(protocol_field_type::timestamp)));
+	EXPECT_TRUE(is_compatible_field<mysql::time>(makefield(protocol_field_type::time)));
+	EXPECT_TRUE(is_compatible_field<std::string_view>(makefield(protocol_field_type::var_string)));
+	EXPECT_TRUE(is_compatible_field<std::string>(makefield(protocol_field_type::newdecimal)));
+	EXPECT_FALSE(is_compatible_field<std::string>(makefield(protocol_field_type::long_)));
+}
+
+TEST(CheckRowType, Compatible_ReturnsOk)
+{
+	error_info info;
+	std::pmr::vector<field_metadata> fields {
+		makefield(protocol_field_type::longlong),
+		makefield(protocol_field_type::var_string),
+		makefield(protocol_field_type::float_)
+	};
+	EXPECT_EQ(check_row_type<employee>(fields, info), errc::ok);
+	EXPECT_EQ((check_row_type<std::tuple<std::int64_t, std::string_view, std::optional<float>>>(fields, info)), errc::ok);
+	EXPECT_EQ(info.message(), "");
+}
+
+TEST(CheckRowType, DifferentNumberOfFields_ReturnsMismatch)
+{
+	error_info info;
+	std::pmr::vector<field_metadata> fields { makefield(protocol_field_type::longlong) };
+	EXPECT_EQ(check_row_type<employee>(fields, info), errc::row_type_mismatch);
+	EXPECT_EQ(info.message(), "The resultset has 1 fields, but the row type has 3 members");
+}
+
+TEST(CheckRowType, IncompatibleField_ReturnsMismatch)
+{
+	error_info info;
+	std::pmr::vector<field_metadata> fields {
+		makefield(protocol_field_type::longlong),
+		makefield(protocol_field_type::var_string),
+		makefield(protocol_field_type::longlong, 0, 0, "salary")
+	};
+	EXPECT_EQ(check_row_type<employee>(fields, info), errc::row_type_mismatch);
+	EXPECT_EQ(info.message(), "Field 2 ('salary') can not be read into a member of type double");
+	EXPECT_EQ((check_row_type<std::tuple<std::uint64_t, std::string, std::int64_t>>(fields, info)),
+		errc::row_type_mismatch);
+	EXPECT_EQ(info.message(), "Field 0 ('') can not be read into a member of type uint64");
+}
+
+struct TypedDeserializationTest : public testing::Test
+{
+	resultset_metadata meta;
+
+	void set_fields(std::pmr::vector<field_metadata> fields)
+	{
+		meta = resultset_metadata({}, {}, std::move(fields));
+	}
+
+	template <typename RowType>
+	error_code deserialize(const bytestring& buffer, bool binary, RowType& output)
+	{
+		deserialization_context ctx (buffer.data(), buffer.data() + buffer.size(), capabilities());
+		return deserialize_typed_row(ctx, meta, binary, output);
+	}
+};
+
+TEST_F(TypedDeserializationTest, Text_AllTypes_DecodesIntoMembers)
+{
+	set_fields({
+		makefield(protocol_field_type::tiny),
+		makefield(protocol_field_type::longlong, column_flags::unsigned_),
+		makefield(protocol_field_type::float_),
+		makefield(protocol_field_type::date),
+		makefield(protocol_field_type::datetime),
+		makefield(protocol_field_type::time),
+		makefield(protocol_field_type::var_string),
+		makefield(protocol_field_type::var_string),
+		makefield(protocol_field_type::long_)
+	});
+	bytestring row {0x02, 0x2d, 0x37}; // -7
+	concat(row, {0x14}); // 18446744073709551615
+	concat(row, boost::asio::buffer(std::string_view("18446744073709551615")));
+	concat(row, {0x04, 0x2d, 0x34, 0x2e, 0x32}); // -4.2
+	concat(row, {0x0a});
+	concat(row, boost::asio::buffer(std::string_view("2010-03-28")));
+	concat(row, {0x13});
+	concat(row, boost::asio::buffer(std::string_view("2010-05-02 23:01:50")));
+	concat(row, {0x0a});
+	concat(row, boost::asio::buffer(std::string_view("-120:02:03")));
+	concat(row, {0x03, 0x61, 0x62, 0x63});
+	concat(row, {0x02, 0x64, 0x65});
+	concat(row, {0xfb});
+	std::tuple<std::int8_t, std::uint64_t, double, mysql::date, mysql::datetime, mysql::time,
+		std::string_view, std::string, std::optional<std::int32_t>> output;
+	EXPECT_EQ(deserialize(row, false, output), error_code());
+	EXPECT_EQ(std::get<0>(output), -7);
+	EXPECT_EQ(std::get<1>(output), 0xffffffffffffffff);
+	EXPECT_EQ(std::get<2>(output), double(-4.2f));
+	EXPECT_EQ(std::get<3>(output), makedate(2010, 3, 28));
+	EXPECT_EQ(std::get<4>(output), makedt(2010, 5, 2, 23, 1, 50));
+	EXPECT_EQ(std::get<5>(output), -maket(120, 2, 3));
+	EXPECT_EQ(std::get<6>(output), "abc");
+	EXPECT_EQ(std::get<7>(output), "de");
+	EXPECT_EQ(std::get<8>(output), std::nullopt);
+}
+
+TEST_F(TypedDeserializationTest, Text_Aggregate_DecodesIntoMembers)
+{
+	set_fields({
+		makefield(protocol_field_type::longlong),
+		makefield(protocol_field_type::var_string),
+		makefield(protocol_field_type::double_)
+	});
+	employee output;
+	EXPECT_EQ(deserialize({0x01, 0x35, 0xfb, 0x03, 0x31, 0x2e, 0x35}, false, output), error_code());
+	EXPECT_EQ(output.id, 5);
+	EXPECT_EQ(output.name, std::nullopt);
+	EXPECT_EQ(output.salary, 1.5);
+}
+
+TEST_F(TypedDeserializationTest, Text_Errors)
+{
+	set_fields({ makefield(protocol_field_type::long_), makefield(protocol_field_type::var_string) });
+	std::tuple<std::int32_t, std::string> output;
+	EXPECT_EQ(deserialize({0xfb, 0x01, 0x61}, false, output), make_error_code(errc::unexpected_null));
+	EXPECT_EQ(deserialize({0x01, 0x78, 0x01, 0x61}, false, output), make_error_code(errc::protocol_value_error));
+	EXPECT_EQ(deserialize({0x01, 0x31, 0x01}, false, output), make_error_code(errc::incomplete_message));
+	EXPECT_EQ(deserialize({0x01, 0x31, 0x01, 0x61, 0x00}, false, output), make_error_code(errc::extra_bytes));
+}
+
+TEST_F(TypedDeserializationTest, Text_Projection_ReadsNull)
+{
+	set_fields({ makefield(protocol_field_type::long_), makefield(protocol_field_type::long_) });
+	meta.set_projection({false, true});
+	std::tuple<std::optional<std::int32_t>, std::int32_t> output;
+	EXPECT_EQ(deserialize({0x01, 0x78, 0x01, 0x35}, false, output), error_code()); // first one is invalid
+	EXPECT_EQ(std::get<0>(output), std::nullopt);
+	EXPECT_EQ(std::get<1>(output), 5);
+}
+
+TEST_F(TypedDeserializationTest, Binary_AllTypes_DecodesIntoMembers)
+{
+	set_fields({
+		makefield(protocol_field_type::tiny),
+		makefield(protocol_field_type::tiny, column_flags::unsigned_),
+		makefield(protocol_field_type::year, column_flags::unsigned_),
+		makefield(protocol_field_type::float_),
+		makefield(protocol_field_type::date),
+		makefield(protocol_field_type::datetime),
+		makefield(protocol_field_type::time),
+		makefield(protocol_field_type::var_string),
+		makefield(protocol_field_type::long_)
+	});
+	bytestring row {0x00, 0x00, 0x04}; // header, null bitmap (last field is NULL)
+	concat(row, {0xff}); // -1
+	concat(row, {0xff}); // 255
+	concat(row, {0xe3, 0x07}); // 2019
+	concat(row, {0x66, 0x66, 0x86, 0xc0}); // -4.2
+	concat(row, {0x04, 0xda, 0x07, 0x03, 0x1c});
+	concat(row, {0x0b, 0xda, 0x07, 0x05, 0x02, 0x17, 0x01, 0x32, 0xa0, 0x86, 0x01, 0x00});
+	concat(row, {0x0c, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xa0, 0x86, 0x01, 0x00});
+	concat(row, {0x02, 0x61, 0x62});
+	std::tuple<std::int64_t, std::uint8_t, int, double, mysql::date, mysql::datetime, mysql::time,
+		std::string_view, std::optional<std::int32_t>> output;
+	EXPECT_EQ(deserialize(row, true, output), error_code());
+	EXPECT_EQ(std::get<0>(output), -1);
+	EXPECT_EQ(std::get<1>(output), 255);
+	EXPECT_EQ(std::get<2>(output), 2019);
+	EXPECT_EQ(std::get<3>(output), double(-4.2f));
+	EXPECT_EQ(std::get<4>(output), makedate(2010, 3, 28));
+	EXPECT_EQ(std::get<5>(output), makedt(2010, 5, 2, 23, 1, 50, 100000));
+	EXPECT_EQ(std::get<6>(output), maket(120, 2, 3, 100000));
+	EXPECT_EQ(std::get<7>(output), "ab");
+	EXPECT_EQ(std::get<8>(output), std::nullopt);
+}
+
+TEST_F(TypedDeserializationTest, Binary_Projection_SkipsFields)
+{
+	set_fields({ makefield(protocol_field_type::var_string), makefield(protocol_field_type::long_) });
+	meta.set_projection({false, true});
+	std::tuple<std::optional<std::string>, std::int32_t> output;
+	EXPECT_EQ(deserialize({0x00, 0x00, 0x02, 0x61, 0x62, 0x05, 0x00, 0x00, 0x00}, true, output), error_code());
+	EXPECT_EQ(std::get<0>(output), std::nullopt);
+	EXPECT_EQ(std::get<1>(output), 5);
+}
+
+TEST_F(TypedDeserializationTest, Binary_Errors)
+{
+	set_fields({ makefield(protocol_field_type::tiny), makefield(protocol_field_type::long_) });
+	std::tuple<int, int> output;
+	EXPECT_EQ(deserialize({0x00, 0x08, 0x01}, true, output), make_error_code(errc::unexpected_null));
+	EXPECT_EQ(deserialize({0x00, 0x00, 0x01, 0x02, 0x00}, true, output), make_error_code(errc::incomplete_message));
+	EXPECT_EQ(deserialize({0x00, 0x00, 0x01, 0x02, 0x00, 0x00, 0x00, 0x00}, true, output),
+		make_error_code(errc::extra_bytes));
+}
+
+} // anon namespace
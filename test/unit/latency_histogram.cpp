@@ -0,0 +1,185 @@
+/*
+ * latency_histogram.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: ruben
+ */
+
+#include <gtest/gtest.h>
+#include "boost/mysql/latency_histogram.hpp"
+#include "boost/mysql/detail/auxiliar/latency_timer.hpp"
+
+using namespace testing;
+using boost::mysql::latency_histogram;
+using boost::mysql::latency_histograms;
+using boost::mysql::latency_operation;
+using std::chrono::nanoseconds;
+
+namespace
+{
+
+TEST(LatencyHistogramTest, DefaultConstructor_Empty)
+{
+	latency_histogram hist;
+	EXPECT_EQ(hist.count(), 0);
+	EXPECT_EQ(hist.min(), nanoseconds(0));
+	EXPECT_EQ(hist.max(), nanoseconds(0));
+	EXPECT_EQ(hist.mean(), nanoseconds(0));
+	EXPECT_EQ(hist.percentile(50), nanoseconds(0));
+}
+
+TEST(LatencyHistogramTest, Record_SmallValues_ExactPercentiles)
+{
+	latency_histogram hist;
+	for (int i = 1; i <= 20; ++i)
+	{
+		hist.record(nanoseconds(i));
+	}
+	EXPECT_EQ(hist.count(), 20);
+	EXPECT_EQ(hist.min(), nanoseconds(1));
+	EXPECT_EQ(hist.max(), nanoseconds(20));
+	EXPECT_EQ(hist.mean(), nanoseconds(10));
+	EXPECT_EQ(hist.percentile(0), nanoseconds(1));
+	EXPECT_EQ(hist.percentile(50), nanoseconds(10));
+	EXPECT_EQ(hist.percentile(95), nanoseconds(19));
+	EXPECT_EQ(hist.percentile(100), nanoseconds(20));
+}
+
+TEST(LatencyHistogramTest, Record_NegativeValue_RecordedAsZero)
+{
+	latency_histogram hist;
+	hist.record(nanoseconds(-5));
+	EXPECT_EQ(hist.count(), 1);
+	EXPECT_EQ(hist.min(), nanoseconds(0));
+	EXPECT_EQ(hist.max(), nanoseconds(0));
+}
+
+TEST(LatencyHistogramTest, Percentile_BigValues_BoundedRelativeError)
+{
+	for (std::int64_t value: {33LL, 100LL, 1000LL, 12345LL, 999999LL, 123456789LL, 987654321012LL})
+	{
+		latency_histogram hist;
+		hist.record(nanoseconds(1));
+		hist.record(nanoseconds(value));
+		hist.record(nanoseconds(value * 2));
+		auto p50 = hist.percentile(50).count();
+		EXPECT_GE(p50, value) << value;
+		EXPECT_LE(p50, value + value / 16) << value;
+	}
+}
+
+TEST(LatencyHistogramTest, Percentile_Max_ReturnsMax)
+{
+	latency_histogram hist;
+	hist.record(nanoseconds(1000));
+	hist.record(nanoseconds(1001));
+	EXPECT_EQ(hist.percentile(100), nanoseconds(1001));
+}
+
+TEST(LatencyHistogramTest, Record_OutOfRange_Clamped)
+{
+	latency_histogram hist;
+	auto huge = nanoseconds(std::int64_t(1) << 50);
+	hist.record(huge);
+	EXPECT_EQ(hist.count(), 1);
+	EXPECT_EQ(hist.max(), huge);
+	EXPECT_EQ(hist.percentile(100), huge);
+	EXPECT_LT(hist.percentile(50), huge + nanoseconds(1));
+}
+
+TEST(LatencyHistogramTest, Merge_TwoHistograms_CombinesValues)
+{
+	latency_histogram lhs, rhs;
+	lhs.record(nanoseconds(10));
+	lhs.record(nanoseconds(20));
+	rhs.record(nanoseconds(5));
+	rhs.record(nanoseconds(25));
+	lhs.merge(rhs);
+	EXPECT_EQ(lhs.count(), 4);
+	EXPECT_EQ(lhs.min(), nanoseconds(5));
+	EXPECT_EQ(lhs.max(), nanoseconds(25));
+	EXPECT_EQ(lhs.mean(), nanoseconds(15));
+	EXPECT_EQ(lhs.percentile(50), nanoseconds(10));
+}
+
+TEST(LatencyHistogramTest, Merge_EmptyHistogram_NoChange)
+{
+	latency_histogram lhs, rhs;
+	lhs.record(nanoseconds(10));
+	lhs.merge(rhs);
+	EXPECT_EQ(lhs.count(), 1);
+	EXPECT_EQ(lhs.min(), nanoseconds(10));
+}
+
+TEST(LatencyHistogramTest, Reset_WithValues_Empty)
+{
+	latency_histogram hist;
+	hist.record(nanoseconds(10));
+	hist.reset();
+	EXPECT_EQ(hist.count(), 0);
+	EXPECT_EQ(hist.max(), nanoseconds(0));
+	EXPECT_EQ(hist.percentile(100), nanoseconds(0));
+}
+
+TEST(LatencyHistogramsTest, Reset_SeveralOperations_ResetsAll)
+{
+	latency_histograms hists;
+	hists[latency_operation::query].network.record(nanoseconds(10));
+	hists[latency_operation::fetch].processing.record(nanoseconds(10));
+	EXPECT_EQ(hists[latency_operation::query].network.count(), 1);
+	EXPECT_EQ(hists[latency_operation::query].processing.count(), 0);
+	hists.reset();
+	EXPECT_EQ(hists[latency_operation::query].network.count(), 0);
+	EXPECT_EQ(hists[latency_operation::fetch].processing.count(), 0);
+}
+
+#ifdef BOOST_MYSQL_ENABLE_LATENCY_HISTOGRAMS
+
+using boost::mysql::detail::latency_tracker;
+using boost::mysql::detail::latency_timer;
+using boost::mysql::detail::latency_scope;
+
+TEST(LatencyTimerTest, Finish_WithIo_RecordsNetworkAndProcessing)
+{
+	latency_tracker tracker;
+	latency_timer timer (tracker, latency_operation::query);
+	tracker.io_begin();
+	tracker.io_end();
+	timer.finish();
+	const auto& hist = tracker.histograms()[latency_operation::query];
+	EXPECT_EQ(hist.network.count(), 1);
+	EXPECT_EQ(hist.processing.count(), 1);
+	EXPECT_EQ(hist.network.max().count(), tracker.io_time().count());
+}
+
+TEST(LatencyTimerTest, Finish_CalledTwice_RecordsOnce)
+{
+	latency_tracker tracker;
+	latency_timer timer (tracker, latency_operation::fetch);
+	timer.finish();
+	timer.finish();
+	EXPECT_EQ(tracker.histograms()[latency_operation::fetch].network.count(), 1);
+}
+
+TEST(LatencyTimerTest, Finish_IoBeforeTimer_NotCounted)
+{
+	latency_tracker tracker;
+	tracker.io_begin();
+	tracker.io_end();
+	latency_timer timer (tracker, latency_operation::handshake);
+	timer.finish();
+	EXPECT_EQ(tracker.histograms()[latency_operation::handshake].network.max(), nanoseconds(0));
+}
+
+TEST(LatencyScopeTest, Destructor_RecordsOperation)
+{
+	latency_tracker tracker;
+	{
+		latency_scope scope (tracker, latency_operation::close_statement);
+	}
+	EXPECT_EQ(tracker.histograms()[latency_operation::close_statement].processing.count(), 1);
+}
+
+#endif
+
+} // anon namespace
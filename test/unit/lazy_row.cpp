@@ -0,0 +1,133 @@
+#include <gtest/gtest.h>
+#include "boost/mysql/lazy_row.hpp"
+#include "test_common.hpp"
+
+using namespace boost::mysql::test;
+using boost::mysql::lazy_row;
+using boost::mysql::value;
+using boost::mysql::errc;
+using boost::mysql::error_code;
+using boost::mysql::field_metadata;
+using boost::mysql::detail::make_error_code;
+using boost::mysql::detail::bytestring;
+using boost::mysql::detail::capabilities;
+using boost::mysql::detail::deserialization_context;
+using boost::mysql::detail::protocol_field_type;
+using boost::mysql::detail::resultset_metadata;
+
+namespace
+{
+
+resultset_metadata make_meta(const std::vector<protocol_field_type>& types)
+{
+	std::pmr::vector<field_metadata> res;
+	for (const auto type: types)
+	{
+		res.push_back(makefield(type));
+	}
+	return resultset_metadata({}, {}, std::move(res));
+}
+
+struct LazyRowTest : public testing::Test
+{
+	resultset_metadata meta;
+	bytestring buffer;
+	lazy_row row;
+
+	errc assign(bool binary)
+	{
+		deserialization_context ctx (buffer.data(), buffer.data() + buffer.size(), capabilities());
+		return row.assign(ctx, meta, binary);
+	}
+};
+
+TEST_F(LazyRowTest, DefaultConstructor_Empty)
+{
+	EXPECT_EQ(row.size(), 0);
+}
+
+TEST_F(LazyRowTest, Text_Get_DecodesOnAccess)
+{
+	meta = make_meta({protocol_field_type::long_, protocol_field_type::var_string, protocol_field_type::date});
+	buffer = {0x02, 0x34, 0x32, 0xfb, 0x0a, 0x32, 0x30, 0x31, 0x30, 0x2d, 0x30, 0x33, 0x2d, 0x32, 0x38};
+	ASSERT_EQ(assign(false), errc::ok);
+	ASSERT_EQ(row.size(), 3);
+	EXPECT_FALSE(row.is_decoded(0));
+	EXPECT_FALSE(row.is_null(0));
+	EXPECT_TRUE(row.is_null(1));
+
+	EXPECT_EQ(row.get(2), value(makedate(2010, 3, 28)));
+	EXPECT_TRUE(row.is_decoded(2));
+	EXPECT_FALSE(row.is_decoded(0));
+	EXPECT_EQ(row.get(0), value(std::int32_t(42)));
+	EXPECT_EQ(row.get(1), value(nullptr));
+}
+
+TEST_F(LazyRowTest, Binary_Get_DecodesOnAccess)
+{
+	meta = make_meta({protocol_field_type::tiny, protocol_field_type::var_string, protocol_field_type::long_});
+	buffer = {0x00, 0x10, 0x14, 0x03, 0x61, 0x62, 0x63}; // field 2 is NULL
+	ASSERT_EQ(assign(true), errc::ok);
+	ASSERT_EQ(row.size(), 3);
+	EXPECT_EQ(row.get(1), value("abc"));
+	EXPECT_FALSE(row.is_decoded(0));
+	EXPECT_EQ(row.get(0), value(std::int32_t(20)));
+	EXPECT_TRUE(row.is_null(2));
+	EXPECT_EQ(row.get(2), value(nullptr));
+}
+
+TEST_F(LazyRowTest, ToRow_DecodesAllValues)
+{
+	meta = make_meta({protocol_field_type::long_, protocol_field_type::var_string});
+	buffer = {0x02, 0x34, 0x32, 0x01, 0x61};
+	ASSERT_EQ(assign(false), errc::ok);
+	EXPECT_EQ(row.to_row().values(), makerow(std::int32_t(42), "a").values());
+}
+
+TEST_F(LazyRowTest, Get_InvalidValue_ReturnsErrorAndNull)
+{
+	meta = make_meta({protocol_field_type::long_, protocol_field_type::long_});
+	buffer = {0x02, 0x34, 0x32, 0x03, 0x61, 0x62, 0x63};
+	ASSERT_EQ(assign(false), errc::ok); // splitting doesn't validate values
+	error_code err;
+	EXPECT_EQ(row.get(1, err), value(nullptr));
+	EXPECT_EQ(err, make_error_code(errc::protocol_value_error));
+	EXPECT_FALSE(row.is_decoded(1));
+	EXPECT_EQ(row.get(0, err), value(std::int32_t(42)));
+	EXPECT_EQ(err, error_code());
+	EXPECT_THROW(row.get(1), boost::system::system_error);
+}
+
+TEST_F(LazyRowTest, Assign_MalformedMessage_ReturnsErrorAndEmpty)
+{
+	meta = make_meta({protocol_field_type::long_, protocol_field_type::long_});
+	buffer = {0x02, 0x34, 0x32, 0x03};
+	EXPECT_EQ(assign(false), errc::incomplete_message);
+	EXPECT_EQ(row.size(), 0);
+}
+
+TEST_F(LazyRowTest, Assign_SecondRow_ResetsCache)
+{
+	meta = make_meta({protocol_field_type::long_});
+	buffer = {0x02, 0x34, 0x32};
+	ASSERT_EQ(assign(false), errc::ok);
+	EXPECT_EQ(row.get(0), value(std::int32_t(42)));
+	buffer = {0x01, 0x37};
+	ASSERT_EQ(assign(false), errc::ok);
+	EXPECT_FALSE(row.is_decoded(0));
+	EXPECT_EQ(row.get(0), value(std::int32_t(7)));
+}
+
+TEST_F(LazyRowTest, Projection_FieldsNotProjectedAreNull)
+{
+	meta = make_meta({protocol_field_type::long_, protocol_field_type::double_, protocol_field_type::tiny});
+	meta.set_projection({true, false, true});
+	buffer = {0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05};
+	ASSERT_EQ(assign(true), errc::ok);
+	EXPECT_TRUE(row.is_null(1));
+	EXPECT_EQ(row.get(1), value(nullptr));
+	EXPECT_EQ(row.get(0), value(std::int32_t(1)));
+	EXPECT_EQ(row.get(2), value(std::int32_t(5)));
+}
+
+} // anon namespace
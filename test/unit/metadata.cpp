@@ -8,12 +8,16 @@
 #include "boost/mysql/metadata.hpp"
 #include <gtest/gtest.h>
 #include "boost/mysql/detail/protocol/serialization.hpp"
+#include <cstring>
+#include <memory_resource>
 
 using namespace testing;
 using namespace boost::mysql::detail;
 using boost::mysql::collation;
 using boost::mysql::field_metadata;
 using boost::mysql::field_type;
+using boost::mysql::error_code;
+using boost::mysql::errc;
 
 namespace
 {
@@ -130,4 +134,122 @@ TEST(FieldMetadata, FloatField)
 
 }
 
+TEST(ResultsetMetadata, SharedFields_UsesTheSharedCopy)
+{
+	column_definition_packet msg;
+	msg.name = string_lenenc("field_varchar");
+	msg.type = protocol_field_type::var_string;
+	auto shared = std::make_shared<const resultset_metadata>(
+		resource_bytestring(),
+		std::pmr::vector<std::size_t>(),
+		std::pmr::vector<field_metadata>{field_metadata(msg), field_metadata(msg)}
+	);
+	resultset_metadata meta (shared, std::pmr::get_default_resource());
+	ASSERT_EQ(meta.fields().size(), 2);
+	EXPECT_EQ(&meta.fields(), &shared->fields());
+	EXPECT_EQ(meta.fields()[1].field_name(), "field_varchar");
+	EXPECT_EQ(&meta.binary_plan(), &shared->binary_plan());
+
+	// Projections are per resultset
+	meta.set_projection({true, false});
+	EXPECT_EQ(meta.projection(), std::pmr::vector<bool>({true, false}));
+	EXPECT_TRUE(shared->projection().empty());
+	EXPECT_NE(&meta.binary_plan(), &shared->binary_plan());
+	EXPECT_EQ(meta.binary_plan().size(), 2);
+}
+
+bytestring serialize_field_definition(std::string_view name)
+{
+	bytestring res;
+	for (std::string_view value: {std::string_view("def"), std::string_view("awesome"),
+			std::string_view("test_table"), std::string_view("test_table"), name, name})
+	{
+		res.push_back(static_cast<std::uint8_t>(value.size()));
+		res.insert(res.end(), value.begin(), value.end());
+	}
+	bytestring fixed_fields {
+		0x0c, // length of fixed fields
+		0x21, 0x00, // utf8_general_ci
+		0xfc, 0x03, 0x00, 0x00, // column length
+		0xfd, // var_string
+		0x00, 0x00, // flags
+		0x00, // decimals
+		0x00, 0x00 // padding
+	};
+	res.insert(res.end(), fixed_fields.begin(), fixed_fields.end());
+	return res;
+}
+
+TEST(ResultsetMetadataBuilder, SeveralPackets_StoresAndParsesThem)
+{
+	auto packet0 = serialize_field_definition("id");
+	auto packet1 = serialize_field_definition("field_varchar");
+	resultset_metadata_builder builder (std::pmr::get_default_resource());
+	builder.reserve(2);
+	builder.add_packet(boost::asio::buffer(packet0));
+	builder.add_packet(boost::asio::buffer(packet1));
+	packet0.assign(packet0.size(), 0); // the builder keeps its own copy
+	EXPECT_EQ(builder.num_packets(), 2);
+
+	resultset_metadata meta;
+	EXPECT_EQ(std::move(builder).build(capabilities(), meta), error_code());
+	ASSERT_EQ(meta.fields().size(), 2);
+	EXPECT_EQ(meta.fields()[0].field_name(), "id");
+	EXPECT_EQ(meta.fields()[0].table(), "test_table");
+	EXPECT_EQ(meta.fields()[1].field_name(), "field_varchar");
+	EXPECT_EQ(meta.fields()[1].type(), field_type::varchar);
+	ASSERT_EQ(meta.num_packets(), 2);
+	EXPECT_EQ(meta.packet(1).size(), packet1.size());
+	EXPECT_EQ(std::memcmp(meta.packet(1).data(), packet1.data(), packet1.size()), 0);
+	EXPECT_EQ(
+		static_cast<const std::uint8_t*>(meta.packet(1).data()),
+		static_cast<const std::uint8_t*>(meta.packet(0).data()) + meta.packet(0).size()
+	);
+}
+
+TEST(ResultsetMetadata, NameIndex_OutlivesMetadata_StillFindsFields)
+{
+	auto packet0 = serialize_field_definition("id");
+	auto packet1 = serialize_field_definition("field_varchar");
+	std::shared_ptr<const lazy_field_name_index> index;
+	{
+		resultset_metadata_builder builder (std::pmr::get_default_resource());
+		builder.add_packet(boost::asio::buffer(packet0));
+		builder.add_packet(boost::asio::buffer(packet1));
+		resultset_metadata meta;
+		ASSERT_EQ(std::move(builder).build(capabilities(), meta), error_code());
+		index = meta.name_index();
+		EXPECT_EQ(meta.name_index(), index); // created once
+	}
+	EXPECT_EQ(index->find("field_varchar"), 1);
+	EXPECT_EQ(index->find("id"), 0);
+	EXPECT_EQ(index->find("other"), field_name_index::npos);
+}
+
+TEST(ResultsetMetadataBuilder, Build_AllocatesFromTheResource)
+{
+	auto packet0 = serialize_field_definition("id");
+	auto packet1 = serialize_field_definition("field_varchar");
+	std::pmr::monotonic_buffer_resource resource;
+	resultset_metadata_builder builder (&resource);
+	builder.add_packet(boost::asio::buffer(packet0));
+	builder.add_packet(boost::asio::buffer(packet1));
+	resultset_metadata meta;
+	ASSERT_EQ(std::move(builder).build(capabilities(), meta), error_code());
+	meta.set_projection({true, false});
+	EXPECT_EQ(meta.fields().get_allocator().resource(), &resource);
+	EXPECT_EQ(meta.projection().get_allocator().resource(), &resource);
+	EXPECT_EQ(meta.binary_plan().get_allocator().resource(), &resource);
+}
+
+TEST(ResultsetMetadataBuilder, InvalidPacket_ReturnsError)
+{
+	auto packet = serialize_field_definition("id");
+	packet.push_back(0x00);
+	resultset_metadata_builder builder (std::pmr::get_default_resource());
+	builder.add_packet(boost::asio::buffer(packet));
+	resultset_metadata meta;
+	EXPECT_EQ(std::move(builder).build(capabilities(), meta), make_error_code(errc::extra_bytes));
+}
+
 } // anon namespace
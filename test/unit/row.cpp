@@ -11,7 +11,10 @@
 
 using namespace boost::mysql::test;
 using namespace testing;
+using namespace boost::mysql::detail;
 using boost::mysql::row;
+using boost::mysql::value;
+using boost::mysql::field_metadata;
 
 namespace
 {
@@ -79,5 +82,55 @@ TEST(RowTest, OperatorStream_SeveralElements)
 	EXPECT_EQ((to_string(makerow("value", std::uint32_t(2019), 3.14f))), "{value, 2019, 3.14}");
 }
 
+// Access by position and name
+// fields must outlive the first lookup
+std::shared_ptr<const lazy_field_name_index> make_name_index(const std::pmr::vector<field_metadata>& fields)
+{
+	return std::make_shared<const lazy_field_name_index>(
+		fields.data(), fields.size(), std::pmr::get_default_resource());
+}
+
+field_metadata make_field(std::string_view name)
+{
+	column_definition_packet msg;
+	msg.name = string_lenenc(name);
+	return field_metadata(msg);
+}
+
+TEST(RowTest, OperatorSubscript_Position_ReturnsValue)
+{
+	row r (makevalues("a_value", 42));
+	EXPECT_EQ(r[1], value(42));
+	EXPECT_EQ(r.at(0), value("a_value"));
+	EXPECT_THROW(r.at(2), std::out_of_range);
+}
+
+TEST(RowTest, OperatorSubscript_Name_ReturnsValue)
+{
+	row r (makevalues("a_value", 42));
+	std::pmr::vector<field_metadata> fields {make_field("field_varchar"), make_field("field_int")};
+	r.set_name_index(make_name_index(fields));
+	EXPECT_EQ(r["field_int"], value(42));
+	EXPECT_EQ(r.at("field_varchar"), value("a_value"));
+	EXPECT_THROW(r.at("bad_field"), std::out_of_range);
+}
+
+// Code written when values() returned a std::vector keeps compiling, with a warning
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+TEST(RowTest, Values_BoundToStdVector_CopiesValues)
+{
+	row r (makevalues("a_value", 42));
+	const std::vector<value>& values = r.values();
+	EXPECT_EQ(values, makevalues("a_value", 42));
+}
+#pragma GCC diagnostic pop
+
+TEST(RowTest, At_NameWithoutIndex_Throws)
+{
+	row r (makevalues("a_value", 42));
+	EXPECT_THROW(r.at("field_int"), std::out_of_range);
+}
+
 }
 
@@ -0,0 +1,159 @@
+#include <gtest/gtest.h>
+#include "boost/mysql/row_batch.hpp"
+#include "test_common.hpp"
+#include <cstring>
+#include <memory_resource>
+
+using namespace boost::mysql::test;
+using boost::mysql::row_batch;
+using boost::mysql::value;
+using boost::mysql::detail::bytestring;
+
+namespace
+{
+
+std::string_view to_string_view(boost::asio::const_buffer buff)
+{
+	return std::string_view(static_cast<const char*>(buff.data()), buff.size());
+}
+
+// Reads packet into the batch, as channel::read does
+boost::asio::const_buffer read_packet(row_batch& batch, const bytestring& packet)
+{
+	row_batch::packet_buffer buff (batch);
+	buff.clear();
+	buff.resize(packet.size());
+	std::memcpy(buff.data(), packet.data(), packet.size());
+	return batch.pending_packet();
+}
+
+TEST(RowBatch, DefaultConstructor_Empty)
+{
+	row_batch batch;
+	EXPECT_TRUE(batch.empty());
+	EXPECT_EQ(batch.size(), 0);
+	EXPECT_EQ(batch.num_fields(), 0);
+	EXPECT_TRUE(batch.values().empty());
+}
+
+TEST(RowBatch, ReadPacket_SeveralSmallRows_StoredContiguously)
+{
+	row_batch batch (1);
+	bytestring packet1 {0x61, 0x62};
+	bytestring packet2 {0x63, 0x64, 0x65};
+	auto copy1 = read_packet(batch, packet1);
+	batch.append_row(makerow(to_string_view(copy1)).values());
+	auto copy2 = read_packet(batch, packet2);
+	batch.append_row(makerow(to_string_view(copy2)).values());
+	EXPECT_EQ(to_string_view(copy1), "ab");
+	EXPECT_EQ(to_string_view(copy2), "cde");
+
+	// Packets are stored contiguously within the same chunk
+	EXPECT_EQ(static_cast<const std::uint8_t*>(copy1.data()) + 2, copy2.data());
+}
+
+TEST(RowBatch, ReadPacket_PacketsExceedChunkSize_PreviousRowsRemainValid)
+{
+	row_batch batch (1);
+	bytestring small_packet (10, 0x61);
+	bytestring big_packet (row_batch::default_chunk_size, 0x62);
+	auto copy1 = read_packet(batch, small_packet);
+	batch.append_row(makerow(to_string_view(copy1)).values());
+	auto copy2 = read_packet(batch, big_packet);
+	batch.append_row(makerow(to_string_view(copy2)).values());
+	auto copy3 = read_packet(batch, small_packet);
+	batch.append_row(makerow(to_string_view(copy3)).values());
+	EXPECT_EQ(batch[0][0], value(std::string(10, 'a')));
+	EXPECT_EQ(batch[1][0], value(std::string(row_batch::default_chunk_size, 'b')));
+	EXPECT_EQ(batch[2][0], value(std::string(10, 'a')));
+}
+
+TEST(RowBatch, ReadPacket_GrowsBeyondChunk_MovesPartialPacket)
+{
+	// As happens with packets spanning several frames
+	row_batch batch (1);
+	auto copy1 = read_packet(batch, bytestring {0x61, 0x62});
+	batch.append_row(makerow(to_string_view(copy1)).values());
+	row_batch::packet_buffer buff (batch);
+	buff.resize(3);
+	std::memcpy(buff.data(), "cde", 3);
+	buff.resize(3 + row_batch::default_chunk_size);
+	EXPECT_EQ(to_string_view(batch.pending_packet()).substr(0, 3), "cde");
+	EXPECT_EQ(batch.pending_packet().size(), 3 + row_batch::default_chunk_size);
+	EXPECT_EQ(batch[0][0], value("ab"));
+	EXPECT_EQ(std::get<std::string_view>(batch[0][0]).data(), copy1.data());
+}
+
+TEST(RowBatch, DiscardPacket_AfterRead_ReusesSpace)
+{
+	row_batch batch (1);
+	bytestring packet1 {0x61, 0x62};
+	bytestring packet2 {0x63, 0x64, 0x65};
+	auto copy1 = read_packet(batch, packet1);
+	batch.discard_packet();
+	EXPECT_EQ(batch.pending_packet().size(), 0);
+	auto copy2 = read_packet(batch, packet2);
+	EXPECT_EQ(copy1.data(), copy2.data());
+	EXPECT_EQ(to_string_view(copy2), "cde");
+}
+
+TEST(RowBatch, AppendRow_SeveralRows_AccessibleByIndex)
+{
+	row_batch batch (2);
+	batch.append_row(makerow(1, "abc").values());
+	batch.append_row(makerow(nullptr, 4.2).values());
+	ASSERT_EQ(batch.size(), 2);
+	EXPECT_FALSE(batch.empty());
+	EXPECT_EQ(batch.values(), makerow(1, "abc", nullptr, 4.2).values());
+	EXPECT_EQ(batch[0].to_row(), makerow(1, "abc"));
+	EXPECT_EQ(batch[1].to_row(), makerow(nullptr, 4.2));
+	EXPECT_EQ(batch[1].size(), 2);
+	EXPECT_EQ(batch[1][1], value(4.2));
+}
+
+TEST(RowBatch, MoveConstructor_StringValues_RemainValid)
+{
+	row_batch batch (1);
+	bytestring packet {0x61, 0x62};
+	auto copy = read_packet(batch, packet);
+	batch.append_row(makerow(to_string_view(copy)).values());
+	row_batch other (std::move(batch));
+	ASSERT_EQ(other.size(), 1);
+	EXPECT_EQ(other[0][0], value("ab"));
+	EXPECT_EQ(std::get<std::string_view>(other[0][0]).data(), copy.data());
+}
+
+TEST(RowBatch, MemoryResource_Default_IsDefaultResource)
+{
+	row_batch batch (1);
+	EXPECT_EQ(batch.memory_resource(), std::pmr::get_default_resource());
+}
+
+TEST(RowBatch, MemoryResource_Custom_AllocatesValuesAndChunksFromIt)
+{
+	counting_resource resource;
+	{
+		row_batch batch (1, &resource);
+		EXPECT_EQ(batch.memory_resource(), &resource);
+		bytestring packet {0x61, 0x62};
+		auto copy = read_packet(batch, packet);
+		batch.append_row(makerow(to_string_view(copy)).values());
+		EXPECT_GE(resource.allocations, 2); // at least one chunk and the value vector
+		EXPECT_EQ(batch[0][0], value("ab"));
+	}
+	EXPECT_EQ(resource.allocations, 0);
+}
+
+TEST(RowBatch, MoveConstructor_CustomMemoryResource_PropagatesResource)
+{
+	counting_resource resource;
+	row_batch batch (1, &resource);
+	bytestring packet {0x61, 0x62};
+	auto copy = read_packet(batch, packet);
+	batch.append_row(makerow(to_string_view(copy)).values());
+	row_batch other (std::move(batch));
+	EXPECT_EQ(other.memory_resource(), &resource);
+	EXPECT_EQ(std::get<std::string_view>(other[0][0]).data(), copy.data());
+}
+
+} // anon namespace